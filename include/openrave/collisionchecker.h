@@ -41,6 +41,14 @@ enum CollisionOptions
     CO_ActiveDOFs = 16,
 };
 
+/// \brief options for \ref CollisionCheckerBase::CheckCollisionBatch and \ref CollisionCheckerBase::CreateQueryContext
+enum CollisionBatchOptions
+{
+    CBO_CheckEnv = 1, ///< check each configuration of the body against the environment
+    CBO_CheckSelf = 2, ///< check each configuration of the body for self-collision
+    CBO_StopAtFirstCollision = 4, ///< return as soon as one configuration is in collision
+};
+
 /// \brief action to perform whenever a collision is detected between objects
 enum CollisionAction
 {
@@ -172,6 +180,80 @@ public:
     /// \param[out] report [optional] collision report to be filled with data about the collision. If a body was hit, CollisionReport::plink1 contains the hit link pointer.
     virtual bool CheckCollision(const RAY& ray, CollisionReportPtr report = CollisionReportPtr()) = 0;
 
+    /** \brief Casts a batch of rays and returns the closest hit of every ray.
+
+        Gives the same hits as calling \ref CheckCollision(const RAY&, CollisionReportPtr) for every ray, but the scene is only gathered once for the whole batch, so this should be used by sensors and anything else that casts many rays at the same time. Collision callbacks are not called. If CO_RayAnyHit is set, any hit along a ray can be returned instead of the closest one.
+
+        The default implementation calls \ref CheckCollision for every ray.
+        \param vrays the rays, the length of each ray is the length of its direction
+        \param pbody if not empty, only the links of this body are hit, otherwise all bodies of the environment
+        \param[out] vhitdistances the distance from the ray origin to the hit, or -1 if the ray did not hit anything. Resized to the number of rays.
+        \param[out] vhitnormals the surface normal at the hit, zero if nothing was hit. Resized to the number of rays.
+        \param[out] vhitlinks the hit link, empty if nothing was hit. Resized to the number of rays.
+        \return the number of rays that hit something
+     */
+    virtual int CheckCollisionRays(const std::vector<RAY>& vrays, KinBodyConstPtr pbody, std::vector<dReal>& vhitdistances, std::vector<Vector>& vhitnormals, std::vector<KinBody::LinkConstPtr>& vhitlinks);
+
+    /// \brief Returns true if \ref CheckCollisionRays can be called from several threads at once as long as the environment is not modified. <b>[multi-thread safe]</b>
+    ///
+    /// Used by \ref EnvironmentBase::StepSimulation to decide if the sensors can be stepped in parallel. In that case CheckCollisionRays
+    /// must not modify the checker or the bodies, and must not lock the environment since the thread stepping the simulation holds it.
+    /// Bodies the checker has not initialized yet are then skipped instead of being initialized.
+    virtual bool IsRayBatchConcurrent() const {
+        return false;
+    }
+
+    /** \brief Checks a batch of configurations of a body for collisions.
+
+        For every configuration the dof values are set with KinBody::SetDOFValues and the body is checked against the environment and/or itself depending on batchoptions. Attached bodies are respected and CO_ActiveDOFs is honored like in \ref CheckCollision(KinBodyConstPtr,CollisionReportPtr). The state of the body is restored before returning.
+
+        The default implementation checks the configurations one at a time; checkers should override it to amortize synchronization and the gathering of the static scene over the batch.
+        \param pbody the body whose dof values are set
+        \param dofindices the dof indices each configuration refers to, if empty then all dofs of the body
+        \param vconfigs the configurations stacked together, size must be a multiple of the number of dofs
+        \param[out] vcollisions per-configuration result, 1 if in collision. Resized to the number of configurations checked.
+        \param batchoptions a combination of \ref CollisionBatchOptions
+        \param[out] report [optional] filled with the collision of the first colliding configuration
+        \return the number of configurations checked. If CBO_StopAtFirstCollision is set, the last checked configuration is the colliding one.
+     */
+    virtual int CheckCollisionBatch(KinBodyPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& vconfigs, std::vector<uint8_t>& vcollisions, int batchoptions=CBO_CheckEnv|CBO_CheckSelf|CBO_StopAtFirstCollision, CollisionReportPtr report = CollisionReportPtr());
+
+    /** \brief Checks the straight line motion of a body between two configurations for environment and self collisions.
+
+        Instead of discretizing the segment, the motion is certified continuously, so thin obstacles cannot be skipped. The dofs are linearly interpolated from q0 to q1, so circular joints should already be unwrapped by the caller. Both end configurations are checked. The state of the body is restored before returning.
+        \param pbody the body whose dof values are moved
+        \param dofindices the dof indices q0 and q1 refer to, if empty then all dofs of the body
+        \param[out] report [optional] filled with the colliding links
+        \return true if the motion is in collision or comes closer to collision than the checker can certify
+        \throw openrave_exception with ORE_NotImplemented if the checker or the kinematics of the body is not supported. Callers should then fall back to discretized checks.
+        \throw openrave_exception with ORE_Timeout if the motion could not be certified within the checker's step limit. Callers should discretize this segment.
+     */
+    virtual bool CheckContinuousCollision(KinBodyPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& q0, const std::vector<dReal>& q1, CollisionReportPtr report = CollisionReportPtr()) {
+        throw OPENRAVE_EXCEPTION_FORMAT("collision checker %s does not support continuous collision checking", GetXMLId(), ORE_NotImplemented);
+    }
+
+    /** \brief Creates the scratch state one thread needs to call \ref CheckCollisionInContext.
+
+        The environment should be locked while creating the context. The current transforms of the other bodies are snapshot into the context, so the environment has to stay unchanged for as long as the context is used. Every querying thread needs its own context.
+        \param pbody the body that will be queried at different link transforms. Attached bodies are not supported.
+        \param queryoptions a combination of CBO_CheckEnv and CBO_CheckSelf
+        \throw openrave_exception with ORE_NotImplemented if the checker does not support concurrent queries
+     */
+    virtual UserDataPtr CreateQueryContext(KinBodyConstPtr pbody, int queryoptions=CBO_CheckEnv|CBO_CheckSelf) {
+        throw OPENRAVE_EXCEPTION_FORMAT("collision checker %s does not support concurrent queries", GetXMLId(), ORE_NotImplemented);
+    }
+
+    /** \brief Checks the body of the context placed at the given link transforms. <b>[multi-thread safe]</b>
+
+        Neither the body, the environment, nor the checker are modified, so many threads can query the same environment at once without locking it, as long as each uses its own context. CO_ActiveDOFs is ignored and collision callbacks are not called.
+        \param context created by \ref CreateQueryContext
+        \param vlinktransforms the transforms of all the links of the body, see \ref KinBody::GetLinkTransformations
+        \param[out] report [optional] filled with the colliding links. Contacts and distances are not computed.
+     */
+    virtual bool CheckCollisionInContext(UserDataPtr context, const std::vector<Transform>& vlinktransforms, CollisionReportPtr report = CollisionReportPtr()) {
+        throw OPENRAVE_EXCEPTION_FORMAT("collision checker %s does not support concurrent queries", GetXMLId(), ORE_NotImplemented);
+    }
+
 protected:
     /// \brief Checks self collision only with the links of the passed in body.
     ///
@@ -183,6 +265,13 @@ protected:
         pbody->SetUserData(GetXMLId(), data);
     }
 
+    /// \brief checks the arguments of \ref CheckCollisionBatch, used by all its implementations
+    ///
+    /// \param[out] dof the number of values in each configuration
+    /// \param[out] numconfigs the number of configurations in vconfigs
+    /// \throw openrave_exception with ORE_InvalidArguments if a dof index is out of range or vconfigs does not hold whole configurations
+    virtual void _ValidateCollisionBatch(KinBodyConstPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& vconfigs, size_t& dof, size_t& numconfigs) const;
+
     inline CollisionCheckerBasePtr shared_collisionchecker() {
         return boost::static_pointer_cast<CollisionCheckerBase>(shared_from_this());
     }
@@ -64,9 +64,9 @@ public:
 
     /// \brief Create and return a clone of the current environment.
     ///
-    /// Clones do not share any memory or resource between each other.
+    /// Clones do not share any mutable memory or resource between each other.
     /// or their parent making them ideal for performing separte planning experiments while keeping
-    /// the parent environment unchanged.
+    /// the parent environment unchanged. Immutable data like the collision models of the bodies can be shared by the checkers.
     /// By default a clone only copies the collision checkers and physics engine.
     /// When bodies are cloned, the unique ids are preserved across environments (each body can be referenced with its id in both environments). The attached and grabbed bodies of each body/robot are also copied to the new environment.
     /// \param options A set of \ref CloningOptions describing what is actually cloned.
@@ -76,6 +76,7 @@ public:
     /// \brief Clones the reference environment into the current environment
     ///
     /// Tries to preserve computation by re-using bodies/interfaces that are already similar between the current and reference environments.
+    /// When cloning repeatedly from the same reference environment, the state of a body is only copied if its update stamp changed in either environment since the last clone.
     /// \param[in] cloningoptions The parts of the environment to clone. Parts not specified are left as is.
     virtual void Clone(EnvironmentBaseConstPtr preference, int cloningoptions) = 0;
 
@@ -174,6 +175,33 @@ public:
     ///
     /// See \ref arch_simulation for more about the simulation thread.
     virtual uint64_t GetSimulationTime() = 0;
+
+    /// \brief timing of the \ref SensorBase::SimulationStep calls made by \ref StepSimulation for one sensor
+    struct SensorSimulationStats
+    {
+        SensorSimulationStats() : numsteps(0), totaltime(0), maxtime(0), lasttime(0) {
+        }
+        SensorBasePtr psensor;
+        uint64_t numsteps; ///< number of SimulationStep calls
+        uint64_t totaltime; ///< total time spent in SimulationStep (in microseconds)
+        uint64_t maxtime; ///< longest SimulationStep call (in microseconds)
+        uint64_t lasttime; ///< duration of the last SimulationStep call (in microseconds)
+    };
+
+    /** \brief Sets the number of threads \ref StepSimulation uses to step the sensors. <b>[multi-thread safe]</b>
+
+        The sensors are always stepped last, after the physics, the bodies, and the modules, so when stepped in parallel they all see the same body transforms. The environment stays locked by the calling thread the whole time, so a sensor stepped in parallel must not lock the environment or modify bodies in its SimulationStep. Sensors are stepped serially if the collision checker does not support concurrent ray queries, see \ref CollisionCheckerBase::IsRayBatchConcurrent.
+        \param numthreads the number of threads including the calling thread, 0 uses the number of cores. 1 steps the sensors serially (default).
+     */
+    virtual void SetSensorSimulationThreads(int numthreads) = 0;
+
+    /// \brief Returns the number of threads used to step the sensors. <b>[multi-thread safe]</b>
+    virtual int GetSensorSimulationThreads() const = 0;
+
+    /// \brief Returns the timing of every sensor stepped by \ref StepSimulation, sorted by decreasing total time. <b>[multi-thread safe]</b>
+    ///
+    /// \param bReset if true, resets the counters after returning them
+    virtual void GetSensorSimulationStats(std::vector<SensorSimulationStats>& vstats, bool bReset=false) = 0;
     //@}
 
     /// \name File Loading and Parsing
@@ -411,6 +439,13 @@ public:
     /// \throw openrave_exception with ORE_Timeout error code
     virtual void GetBodies(std::vector<KinBodyPtr>& bodies, uint64_t timeout=0) const = 0;
 
+    /// \brief Get a read-only list of all bodies loaded in the environment (including robots) without copying it. <b>[multi-thread safe]</b>
+    ///
+    /// The list is shared between all callers and never modified; adding, removing, or renaming a body publishes a new list.
+    /// Holding on to the returned pointer keeps its bodies alive, so it should be released once the query is done.
+    /// \param[out] pstamp if not NULL, filled with the version of the list, changes every time a new list is published
+    virtual boost::shared_ptr<std::vector<KinBodyPtr> const> GetBodiesSnapshot(int* pstamp=NULL) const = 0;
+
     /// \brief Fill an array with all robots loaded in the environment. <b>[multi-thread safe]</b>
     ///
     /// A separate **interface mutex** is locked for reading the bodies.
@@ -106,7 +106,7 @@ public:
      */
     typedef boost::function<IkReturn(std::vector<dReal>&, RobotBase::ManipulatorConstPtr, const IkParameterization&)> IkFilterCallbackFn;
 
-    IkSolverBase(EnvironmentBasePtr penv) : InterfaceBase(PT_InverseKinematicsSolver, penv) {
+    IkSolverBase(EnvironmentBasePtr penv) : InterfaceBase(PT_InverseKinematicsSolver, penv), __nUpdateStamp(0), __nextBatchIndex(0) {
     }
     virtual ~IkSolverBase() {
     }
@@ -143,6 +143,16 @@ public:
         new UserDataPtr(RegisterCustomFilter(0,filterfn));
     }
 
+    /// \brief Return a stamp that changes whenever a custom filter is registered or removed, or a command is sent to the solver.
+    ///
+    /// Used to check if previously computed solutions might be different now, see \ref RobotBase::Manipulator::SetIkCache
+    virtual int GetUpdateStamp() const {
+        return __nUpdateStamp;
+    }
+
+    /// \brief calls \ref InterfaceBase::SendCommand and changes the update stamp since the command can change the solver settings
+    virtual bool SendCommand(std::ostream& os, std::istream& is);
+
     /// \brief Number of free parameters defining the null solution space.
     ///
     /// Each parameter is always in the range of [0,1].
@@ -255,6 +265,22 @@ public:
      */
     virtual bool SolveAll(const IkParameterization& param, const std::vector<dReal>& vFreeParameters, int filteroptions, std::vector<IkReturnPtr>& ikreturns);
 
+    /** \brief Return a joint configuration for each of many end effector transforms.
+
+        The parameterizations are distributed to worker threads. Every thread has its own clone of the environment and of the ik solver,
+        so both the ik equations and the filters like collision checking run in parallel. The clones are kept between calls and
+        are only synchronized with the current environment state at the start of each call.
+        Custom filters are bound to the original environment, so if any are registered and IKFO_IgnoreCustomFilters is not set,
+        all parameterizations are solved serially with \ref Solve. Has to be called with the environment locked.
+        \param[in] vparams the poses the end effector has to achieve, in the same coordinate system as \ref Solve
+        \param[in] q0 Return solutions nearest to the given configuration q0 in terms of the joint distance. If q0 is empty, returns the first solutions found
+        \param[in] filteroptions A bitmask of \ref IkFilterOptions values controlling what is checked for each ik solution.
+        \param[out] ikreturns one entry for each of vparams in the same order. The action is IKRA_Success if a solution was found.
+        \param[in] numthreads the maximum number of threads to use, if 0 uses the number of cores
+        \return the number of parameterizations a solution was found for
+     */
+    virtual int SolveBatch(const std::vector<IkParameterization>& vparams, const std::vector<dReal>& q0, int filteroptions, std::vector<IkReturnPtr>& ikreturns, int numthreads=0);
+
     /// \brief returns true if the solver supports a particular ik parameterization as input.
     virtual bool Supports(IkParameterizationType iktype) const OPENRAVE_DUMMY_IMPLEMENTATION;
 
@@ -278,7 +304,15 @@ private:
         return OPENRAVE_IKSOLVER_HASH;
     }
 
+    /// \brief solves vparams[i] for the next unsolved i until all are done, called from the SolveBatch worker threads
+    virtual void __SolveBatchThread(EnvironmentBasePtr penv, IkSolverBasePtr iksolver, const std::vector<IkParameterization>& vparams, const std::vector<dReal>& q0, int filteroptions, std::vector<IkReturnPtr>& ikreturns);
+
     std::list<UserDataWeakPtr> __listRegisteredFilters; ///< internally managed filters
+    int __nUpdateStamp; ///< \see GetUpdateStamp
+    std::vector< std::pair<EnvironmentBasePtr, IkSolverBasePtr> > __vBatchContexts; ///< environment clones and their ik solvers used by SolveBatch threads
+    boost::mutex __mutexBatch; ///< protects the following SolveBatch members
+    size_t __nextBatchIndex;
+    std::string __batcherror; ///< first exception thrown in a SolveBatch thread
 
     friend class CustomIkSolverFilterData;
 };
@@ -364,6 +364,11 @@ protected:
             return _collision;
         }
 
+        /// \brief spheres enclosing the triangles of GetCollisionData, in the link coordinate system
+        inline const SphereTree& GetSphereTree() const {
+            return _spheretree;
+        }
+
         /// \brief Compute the aabb of all the geometries of the link in the link coordinate system
         virtual AABB ComputeLocalAABB() const;
 
@@ -543,6 +548,7 @@ private:
         std::vector<int> _vRigidlyAttachedLinks;         ///< \see IsRigidlyAttached, GetRigidlyAttachedLinks
         TriMesh _collision; ///< triangles for collision checking, triangles are always the triangulation
                             ///< of the body when it is at the identity transformation
+        SphereTree _spheretree; ///< \see GetSphereTree, recomputed whenever _collision changes
         //@}
 #ifdef RAVE_PRIVATE
 #ifdef _MSC_VER
@@ -1430,6 +1436,37 @@ private:
     /// Knowing the dof branches allows the robot to recover the full state of the joints with SetLinkTransformations
     virtual void GetLinkTransformations(std::vector<Transform>& transforms, std::vector<int>& dofbranches) const;
 
+    /** \brief computes the link transformations for many configurations at once without changing the state of the body.
+
+        The base link keeps its current transformation and the joint values are used as is, like SetDOFValues with CLA_Nothing.
+        If the body supports the forward kinematics fast path, the configurations are split among several threads when
+        the body has no mimic joints (their equations cannot be evaluated in parallel). Otherwise every configuration is set
+        in turn and the state is restored afterwards.
+        \param vconfigs numconfigs*GetDOF() joint values, one configuration after another
+        \param[out] vlinktransforms numconfigs*GetLinks().size() transformations, the links of one configuration after another
+        \param numthreads maximum number of threads to use, if 0 uses the number of cores
+     */
+    virtual void ComputeLinkTransformationsBatch(const std::vector<dReal>& vconfigs, std::vector<Transform>& vlinktransforms, int numthreads=0);
+
+    /** \brief computes the link poses for many configurations and writes them directly into a buffer of the caller, like arrays of the python bindings.
+
+        Same as the vector version except for the input and output layout.
+        \param pconfigs numconfigs*GetDOF() joint values, one configuration after another
+        \param[out] pposes the poses of the links of configuration i start at pposes + i*posestride. Every pose is 7 values: the quaternion followed by the translation, like \ref geometry::RaveTransform::rot and \ref geometry::RaveTransform::trans.
+        \param posestride number of values between the poses of two consecutive configurations, at least 7*GetLinks().size()
+        \param numthreads maximum number of threads to use, if 0 uses the number of cores
+     */
+    virtual void ComputeLinkTransformationsBatch(const dReal* pconfigs, size_t numconfigs, dReal* pposes, size_t posestride, int numthreads=0);
+
+    /** \brief enables or disables the precomputed forward kinematics fast path of SetDOFValues and ComputeLinkTransformationsBatch, enabled by default.
+
+        Disabling it forces the general forward kinematics, which is mostly useful for comparing the two. Enabling it has no effect on bodies that cannot use the fast path.
+     */
+    virtual void SetFastKinematics(bool bEnable);
+
+    /// \brief returns true if SetDOFValues uses the precomputed forward kinematics fast path
+    virtual bool IsFastKinematics() const;
+
     /// \deprecated (11/05/26)
     virtual void GetBodyTransformations(std::vector<Transform>& transforms) const RAVE_DEPRECATED {
         GetLinkTransformations(transforms);
@@ -1870,6 +1907,29 @@ protected:
     /// \brief resets cached information dependent on the collision checker (usually called when the collision checker is switched or some big mode is set.
     virtual void _ResetInternalCollisionCache();
 
+    /// \brief fills the joint table of the forward kinematics fast path of SetDOFValues and sets _bFastKinematics if the body can use it
+    ///
+    /// Has to be called whenever the joint offsets or the hierarchy change.
+    virtual void _ComputeFastKinematics();
+
+    /// \brief evaluates the mimic equation of one axis of a joint and clamps the result to the joint limits
+    ///
+    /// \param vdependentvalues the values of the dofs and passive joints the equation depends on, ordered like the dof format of the mimic
+    /// \param veval scratch buffer for the results of the equation
+    /// \param[out] fvalue the joint value, only set if the equation could be evaluated
+    virtual bool _EvaluateMimicValue(Joint& joint, int iaxis, const std::vector<dReal>& vdependentvalues, std::vector<dReal>& veval, uint32_t checklimits, dReal& fvalue);
+
+    /// \brief computes the local transformation of entry ijoint of the forward kinematics fast path table given its joint value
+    void _ComputeFastKinematicsLocalTransform(size_t ijoint, dReal fvalue, Transform& tlocal) const;
+
+    /// \brief computes the link transformations of configurations [istart,iend) for ComputeLinkTransformationsBatch
+    ///
+    /// Writes into ptransforms if it is not NULL, otherwise writes poses into pposes.
+    virtual void _ComputeLinkTransformationsBatchRange(const dReal* pconfigs, const std::vector<Transform>& vinitial, Transform* ptransforms, dReal* pposes, size_t posestride, size_t istart, size_t iend);
+
+    /// \brief implements both versions of ComputeLinkTransformationsBatch, see _ComputeLinkTransformationsBatchRange for the outputs
+    void _ComputeLinkTransformationsBatch(const dReal* pconfigs, size_t numconfigs, Transform* ptransforms, dReal* pposes, size_t posestride, int numthreads);
+
     std::string _name; ///< name of body
     std::vector<JointPtr> _vecjoints; ///< \see GetJoints
     std::vector<JointPtr> _vTopologicallySortedJoints; ///< \see GetDependencyOrderedJoints
@@ -1893,6 +1953,19 @@ protected:
     mutable int _nNonAdjacentLinkCache; ///< specifies what information is currently valid in the AdjacentOptions.  Declared as mutable since data is cached. If 0x80000000 (ie < 0), then everything needs to be recomputed including _setNonAdjacentLinks[0].
     std::vector<Transform> _vInitialLinkTransformations; ///< the initial transformations of each link specifying at least one pose where the robot is collision free
 
+    /// \brief true if SetDOFValues can use the _vFastKinematics* table.
+    ///
+    /// Requires all joints to be single axis revolute or prismatic joints without closed loops. Passive joints have to be static or mimic joints that only depend on dofs.
+    /// The table is indexed like _vTopologicallySortedJointsAll. For a joint value v, the transform of the child link relative to the parent link is
+    /// rot = rot0*cos(v/2) + rot1*sin(v/2), trans = trans0 + trans1*cos(v) + trans2*sin(v) for revolute joints and rot = rot0, trans = trans0 + trans1*v for prismatic joints.
+    bool _bFastKinematics;
+    bool _bFastKinematicsEnabled; ///< false if the fast path was disabled with SetFastKinematics
+    std::vector<uint8_t> _vFastKinematicsRevolute; ///< 1 if the joint is revolute, 0 if prismatic
+    std::vector<int> _vFastKinematicsDOFIndices; ///< the dof index of the joint value, -1 if the value is computed from the mimic equation, -2 if the joint is static and rot0, trans0 already contain the transform
+    std::vector<int> _vFastKinematicsParentLinks, _vFastKinematicsChildLinks;
+    std::vector<Vector> _vFastKinematicsRot0, _vFastKinematicsRot1;
+    std::vector<Vector> _vFastKinematicsTrans0, _vFastKinematicsTrans1, _vFastKinematicsTrans2;
+
     ConfigurationSpecification _spec;
 
     int _environmentid; ///< \see GetEnvironmentId
@@ -1904,6 +1977,7 @@ protected:
 private:
     mutable std::string __hashkinematics;
     mutable std::vector<dReal> _vTempJoints;
+    std::vector<dReal> _vTempMimicValues, _vTempMimicEval;
     virtual const char* GetHash() const {
         return OPENRAVE_KINBODY_HASH;
     }
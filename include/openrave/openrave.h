@@ -2340,6 +2340,41 @@ public:
 OPENRAVE_API std::ostream& operator<<(std::ostream& O, const TriMesh& trimesh);
 OPENRAVE_API std::istream& operator>>(std::istream& I, TriMesh& trimesh);
 
+/** \brief Binary hierarchy of spheres enclosing the triangles of a mesh, used to quickly reject mesh pairs that cannot touch.
+
+    Every sphere encloses all the triangles of its subtree, so if no leaf sphere of one tree overlaps a leaf sphere of another
+    tree, the meshes do not collide. The spheres are stored as flat arrays with the root at index 0 and the two children of a
+    node at consecutive indices.
+ */
+class OPENRAVE_API SphereTree
+{
+public:
+    /// \brief builds the hierarchy top-down by splitting the triangles at the median of their centers along the longest axis
+    ///
+    /// \param maxleaftriangles nodes with this many triangles or fewer become leaves
+    /// \param maxdepth nodes at this depth become leaves
+    void Build(const TriMesh& trimesh, int maxleaftriangles=8, int maxdepth=12);
+
+    void Clear();
+
+    inline bool IsEmpty() const {
+        return vradii.size() == 0;
+    }
+
+    /// \brief returns false if the meshes of the two trees at the given transformations cannot collide.
+    ///
+    /// The check is conservative, true means that two leaf spheres overlap or that more than maxtests sphere pairs had to
+    /// be tested, and the meshes have to be checked. Empty trees never overlap.
+    /// \param maxtests limits the work for meshes that are close, at most s_nMaxOverlapTests
+    bool Overlaps(const TransformMatrix& t, const SphereTree& other, const TransformMatrix& tother, int maxtests=s_nMaxOverlapTests) const;
+
+    static const int s_nMaxOverlapTests = 256;
+
+    std::vector<dReal> vcentersx, vcentersy, vcentersz; ///< centers of the spheres in the mesh coordinate system
+    std::vector<dReal> vradii;
+    std::vector<int> vchildren; ///< index of the first child of every sphere, -1 for leaves
+};
+
 /// \brief Selects which DOFs of the affine transformation to include in the active configuration.
 enum DOFAffine
 {
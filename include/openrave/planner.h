@@ -277,6 +277,11 @@ private:
         /// \brief maximum number of iterations before the planner gives up. If 0 or less, planner chooses best iterations.
         int _nMaxIterations;
 
+        /// \brief if true, the default path constraints certify segments with \ref CollisionCheckerBase::CheckContinuousCollision instead of discretizing them.
+        ///
+        /// \see planningutils::LineCollisionConstraint::SetContinuousCheck
+        bool _bContinuousCheck;
+
         /// \brief Specifies the planner that will perform the post-processing path smoothing before returning.
         ///
         /// If empty, will not path smooth the returned trajectories (used to measure algorithm time)
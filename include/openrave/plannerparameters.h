@@ -611,12 +611,18 @@ typedef boost::shared_ptr<WorkspaceTrajectoryParameters const> WorkspaceTrajecto
 class OPENRAVE_API RRTParameters : public PlannerBase::PlannerParameters
 {
 public:
-    RRTParameters() : _minimumgoalpaths(1), _bProcessing(false) {
+    RRTParameters() : _minimumgoalpaths(1), _sNearestNeighborIndex("gnat"), _bProcessing(false) {
         _vXMLParameters.push_back("minimumgoalpaths");
+        _vXMLParameters.push_back("nearestneighborindex");
     }
 
     size_t _minimumgoalpaths; ///< minimum number of goals to connect to before exiting. the goal with the shortest path is returned.
 
+    /// \brief the nearest-neighbor structure used to search the trees.
+    ///
+    /// "gnat" uses a metric tree that relies on _distmetricfn satisfying the triangle inequality, "bruteforce" scans all nodes and works with any distance metric.
+    std::string _sNearestNeighborIndex;
+
 protected:
     bool _bProcessing;
     virtual bool serialize(std::ostream& O) const
@@ -625,6 +631,7 @@ protected:
             return false;
         }
         O << "<minimumgoalpaths>" << _minimumgoalpaths << "</minimumgoalpaths>" << std::endl;
+        O << "<nearestneighborindex>" << _sNearestNeighborIndex << "</nearestneighborindex>" << std::endl;
         return !!O;
     }
 
@@ -639,7 +646,7 @@ protected:
         case PE_Ignore: return PE_Ignore;
         }
 
-        _bProcessing = name=="minimumgoalpaths";
+        _bProcessing = name=="minimumgoalpaths"||name=="nearestneighborindex";
         return _bProcessing ? PE_Support : PE_Pass;
     }
 
@@ -649,6 +656,9 @@ protected:
             if( name == "minimumgoalpaths") {
                 _ss >> _minimumgoalpaths;
             }
+            else if( name == "nearestneighborindex") {
+                _ss >> _sNearestNeighborIndex;
+            }
             else {
                 RAVELOG_WARN(str(boost::format("unknown tag %s\n")%name));
             }
@@ -676,7 +686,7 @@ protected:
     bool _bProcessing;
     virtual bool serialize(std::ostream& O) const
     {
-        if( !PlannerParameters::serialize(O) ) {
+        if( !RRTParameters::serialize(O) ) {
             return false;
         }
         O << "<goalbias>" << _fGoalBiasProb << "</goalbias>" << std::endl;
@@ -688,7 +698,7 @@ protected:
         if( _bProcessing ) {
             return PE_Ignore;
         }
-        switch( PlannerBase::PlannerParameters::startElement(name,atts) ) {
+        switch( RRTParameters::startElement(name,atts) ) {
         case PE_Pass: break;
         case PE_Support: return PE_Support;
         case PE_Ignore: return PE_Ignore;
@@ -712,7 +722,7 @@ protected:
         }
 
         // give a chance for the default parameters to get processed
-        return PlannerParameters::endElement(name);
+        return RRTParameters::endElement(name);
     }
 };
 
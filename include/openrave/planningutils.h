@@ -169,6 +169,19 @@ OPENRAVE_API TrajectoryBasePtr ReverseTrajectory(TrajectoryBaseConstPtr traj);
 /// \throw openrave_exception throws an exception if the trajectory data is incompatible and cannot be merged.
 OPENRAVE_API TrajectoryBasePtr MergeTrajectories(const std::list<TrajectoryBaseConstPtr>& listtrajectories);
 
+/** \brief returns the waypoints of a trajectory written with \ref TSO_Binary without copying them.
+
+    Meant for trajectories memory mapped from a file or shared memory, the returned pointer points inside pbuffer and
+    is valid as long as pbuffer is.
+    \param pbuffer the start of the serialized trajectory, has to be aligned to sizeof(dReal)
+    \param buffersize the number of bytes available at pbuffer
+    \param[out] spec the configuration specification of the waypoints
+    \param[out] numwaypoints the number of waypoints, the returned block holds numwaypoints*spec.GetDOF() values
+    \param[out] pdescription if not NULL, filled with the description of the trajectory
+    \throw openrave_exception if the buffer is not a binary trajectory, is truncated, is compressed, or was written with a different dReal type or byte order
+ */
+OPENRAVE_API const dReal* GetBinaryTrajectoryWaypoints(const void* pbuffer, size_t buffersize, ConfigurationSpecification& spec, size_t& numwaypoints, std::string* pdescription=NULL);
+
 /** \brief represents the DH parameters for one joint
 
    T = Z_1 X_1 Z_2 X_2 ... X_n Z_n
@@ -224,6 +237,17 @@ public:
     /// \brief checks line collision. Uses the constructor's self-collisions
     virtual bool Check(PlannerBase::PlannerParametersWeakPtr _params, const std::vector<dReal>& pQ0, const std::vector<dReal>& pQ1, IntervalType interval, PlannerBase::ConfigurationListPtr pvCheckedConfigurations);
 
+    /** \brief if set, segments are certified with \ref CollisionCheckerBase::CheckContinuousCollision instead of being discretized.
+
+        Segments are also certified when PlannerParameters::_bContinuousCheck is set in the parameters passed to \ref Check.
+        Only applies when the configuration space is the joint values of the single body being checked and no user check functions are set.
+        Otherwise the segment is discretized. Assumes that the planner moves in straight lines in the configuration space.
+        If the collision checker does not support continuous checks, falls back to discretization for the rest of the queries.
+        A segment whose open end is in collision is discretized so that the open end is not checked.
+        When the intermediate configurations are requested, a free segment is still discretized to fill them.
+     */
+    virtual void SetContinuousCheck(bool bContinuousCheck);
+
     CollisionReportPtr GetReport() const {
         return _report;
     }
@@ -231,10 +255,16 @@ public:
 protected:
     virtual bool _CheckState();
 
+    /// \return 1 if the segment is in collision, 0 if it is free, -1 if continuous checking does not apply
+    virtual int _CheckContinuous(PlannerBase::PlannerParametersPtr params, const std::vector<dReal>& pQ0, const std::vector<dReal>& pQ1, IntervalType interval);
+
     std::vector<dReal> _vtempconfig, dQ;
+    std::vector<int> _vcontinuousdofindices;
     CollisionReportPtr _report;
     std::list<KinBodyPtr> _listCheckSelfCollisions;
     bool _bCheckEnv;
+    bool _bContinuousCheck;
+    bool _bContinuousUnsupported; ///< set once the checker or the body cannot be checked continuously
     boost::array< boost::function<bool() >, 2> _usercheckfns;
 };
 
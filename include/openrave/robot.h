@@ -176,6 +176,24 @@ public:
         virtual bool FindIKSolutions(const IkParameterization& param, int filteroptions, std::vector<IkReturnPtr>& vikreturns) const;
         virtual bool FindIKSolutions(const IkParameterization& param, const std::vector<dReal>& vFreeParameters, int filteroptions, std::vector<IkReturnPtr>& vikreturns) const;
 
+        /** \brief Enables caching of the results of \ref FindIKSolution.
+
+            The goal (in the manipulator base frame), the free parameters, and the filter options form the key of an entry. Every value of
+            the goal and the free parameters is rounded to a multiple of fresolution, so all goals falling in the same cell return the result
+            that was computed for the first of them, including failures. Because of this the solution is not recomputed to be close to the current arm configuration.
+            The cache is cleared whenever a body other than the robot and the bodies it grabs changes, when the robot moves its base or joints outside of the arm,
+            when the geometry or enabled links of the robot or a grabbed body change, or when a body is grabbed, released or moved relative to its grabbing link.
+            Clones of the manipulator do not inherit the cache.
+            \param fresolution the size of a cell in meters/radians. If 0, disables and frees the cache.
+            \param maxentries when exceeded all entries are dropped
+         */
+        virtual void SetIkCache(dReal fresolution, size_t maxentries=10000);
+
+        /// \brief returns statistics of the ik cache, see \ref SetIkCache
+        ///
+        /// \return false if the cache is not enabled
+        virtual bool GetIkCacheStatistics(uint64_t& numhits, uint64_t& nummisses, uint64_t& numinvalidations, size_t& numentries) const;
+
         /** \brief returns the parameterization of a given IK type for the current manipulator position.
 
             Ideally pluging the returned ik parameterization into FindIkSolution should return the a manipulator configuration
@@ -309,6 +327,8 @@ private:
         ConfigurationSpecification __armspec; ///< reflects __varmdofindices
         mutable IkSolverBasePtr __pIkSolver;
         mutable std::string __hashstructure, __hashkinematicsstructure;
+        class IkSolutionCache;
+        boost::shared_ptr<IkSolutionCache> __pIkCache; ///< \see SetIkCache
 
 #ifdef RAVE_PRIVATE
 #ifdef _MSC_VER
@@ -88,6 +88,7 @@ public:
             return ST_Camera;
         }
         std::vector<uint8_t> vimagedata;         ///< rgb image data, if camera only outputs in grayscale, fill each channel with the same value
+        std::vector<float> vdepthdata;         ///< optional depth along the camera +z axis for every pixel, 0 if nothing was seen. Empty if the camera cannot measure depth
         virtual bool serialize(std::ostream& O) const;
     };
 
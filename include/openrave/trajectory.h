@@ -24,6 +24,13 @@
 
 namespace OpenRAVE {
 
+/// \brief options for \ref TrajectoryBase::serialize, can be combined with \ref SerializationOptions
+enum TrajectorySerializationOptions
+{
+    TSO_Binary = 0x10000, ///< write the binary format: a header with the \ref ConfigurationSpecification followed by a raw little-endian block of the waypoints
+    TSO_Compressed = 0x20000, ///< if TSO_Binary is set, compress the waypoint block with zlib. The compressed form cannot be read in-place.
+};
+
 /** \brief <b>[interface]</b> Encapsulate a time-parameterized trajectories of robot configurations. <b>If not specified, method is not multi-thread safe.</b> \arch_trajectory
     \ingroup interfaces
  */
@@ -77,6 +84,33 @@ public:
      */
     virtual void Sample(std::vector<dReal>& data, dReal time, const ConfigurationSpecification& spec) const;
 
+    /** \brief samples the trajectory at many times at once and stores the points consecutively.
+
+        Equivalent to calling \ref Sample for every time, but the default implementation is slow, so interface developers
+        should override it. Sampling is fastest when the times are increasing.
+        \param data[out] the sampled points, resized to times.size()*GetConfigurationSpecification().GetDOF(). Reusing the same vector avoids allocations.
+        \param times[in] the times to sample
+     */
+    virtual void SamplePoints(std::vector<dReal>& data, const std::vector<dReal>& times) const;
+
+    /** \brief samples the trajectory at many times at once and returns the data in the specified format.
+
+        \param data[out] the sampled points, resized to times.size()*spec.GetDOF()
+        \param times[in] the times to sample
+        \param spec[in] the specification format to return the data in
+     */
+    virtual void SamplePoints(std::vector<dReal>& data, const std::vector<dReal>& times, const ConfigurationSpecification& spec) const;
+
+    /** \brief samples the trajectory at every time starttime + i*deltatime that is <= stoptime.
+
+        \param data[out] the sampled points, stored consecutively
+        \param deltatime[in] the time step, has to be > 0
+     */
+    virtual void SampleRange(std::vector<dReal>& data, dReal starttime, dReal stoptime, dReal deltatime) const;
+
+    /// \brief samples the trajectory at every time starttime + i*deltatime that is <= stoptime and returns the data in the specified format.
+    virtual void SampleRange(std::vector<dReal>& data, dReal starttime, dReal stoptime, dReal deltatime, const ConfigurationSpecification& spec) const;
+
     virtual const ConfigurationSpecification& GetConfigurationSpecification() const = 0;
 
     /// \brief return the number of waypoints
@@ -133,10 +167,19 @@ public:
     /// \brief return the duration of the trajectory in seconds
     virtual dReal GetDuration() const = 0;
 
-    /// \brief output the trajectory in XML format
+    /** \brief output the trajectory in XML format, or in binary if TSO_Binary is set
+
+        The binary format starts with the magic "ORTB", a version, the size of dReal, flags, the lengths of the
+        specification and description strings, the number of waypoints and the length of the waypoint block. All
+        integers are little-endian. The specification in its XML form and the description follow, and the waypoint
+        block starts at the next 8 byte boundary. The waypoint block can be read in-place from a memory mapped file with
+        \ref planningutils::GetBinaryTrajectoryWaypoints.
+        \param options \ref TrajectorySerializationOptions
+        \throw openrave_exception if TSO_Compressed is set and OpenRAVE was compiled without zlib
+     */
     virtual void serialize(std::ostream& O, int options=0) const;
 
-    /// \brief initialize the trajectory
+    /// \brief initialize the trajectory from either the XML or the binary format written by \ref serialize
     virtual InterfaceBasePtr deserialize(std::istream& I);
 
     virtual void Clone(InterfaceBaseConstPtr preference, int cloningoptions);
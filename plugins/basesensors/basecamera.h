@@ -33,7 +33,7 @@ public:
                 }
                 return PE_Ignore;
             }
-            static boost::array<string, 13> tags = { { "sensor", "kk", "width", "height", "framerate", "power", "color", "focal_length","image_dimensions","intrinsic","measurement_time", "format", "distortion_model"}};
+            static boost::array<string, 15> tags = { { "sensor", "kk", "width", "height", "framerate", "power", "color", "focal_length","image_dimensions","intrinsic","measurement_time", "format", "distortion_model", "renderer", "renderthreads"}};
             if( find(tags.begin(),tags.end(),name) == tags.end() ) {
                 return PE_Pass;
             }
@@ -88,6 +88,14 @@ public:
             else if( name == "format" ) {
                 ss >> _psensor->_channelformat;
             }
+            else if( name == "renderer" ) {
+                ss >> _psensor->_renderer;
+            }
+            else if( name == "renderthreads" ) {
+                int numthreads = 0;
+                ss >> numthreads;
+                _psensor->_rasterizer.SetNumThreads(numthreads);
+            }
             else if( name == "color" ) {
                 ss >> _psensor->_vColor.x >> _psensor->_vColor.y >> _psensor->_vColor.z;
                 // ok if not everything specified
@@ -127,7 +135,8 @@ public:
     }
 
     BaseCameraSensor(EnvironmentBasePtr penv) : SensorBase(penv) {
-        __description = ":Interface Author: Rosen Diankov\n\nProvides a simulated camera using the standard pinhole projection.";
+        __description = ":Interface Author: Rosen Diankov\n\nProvides a simulated camera using the standard pinhole projection.\n\n\
+Images are taken from the viewer of the environment. When the renderer tag/SetRenderer command is set to 'software', or to 'auto' and the environment has no viewer, a built-in multi-threaded rasterizer renders the collision meshes of the visible geometries and also fills the depth image. Use the renderthreads tag to limit its threads.";
         RegisterCommand("power",boost::bind(&BaseCameraSensor::_Power,this,_1,_2), "deprecated");
         RegisterCommand("render",boost::bind(&BaseCameraSensor::_Render,this,_1,_2),"deprecated");
         RegisterCommand("setintrinsic",boost::bind(&BaseCameraSensor::_SetIntrinsic,this,_1,_2),
@@ -136,6 +145,8 @@ public:
                         "Set the dimensions of the image (width,height)");
         RegisterCommand("SaveImage",boost::bind(&BaseCameraSensor::_SaveImage,this,_1,_2),
                         "Saves the next camera image to the given filename");
+        RegisterCommand("SetRenderer",boost::bind(&BaseCameraSensor::_SetRenderer,this,_1,_2),
+                        "Set how images are rendered: 'viewer' (default) uses the viewer of the environment, 'software' always uses the built-in rasterizer, 'auto' uses the viewer if there is one and the rasterizer otherwise. An optional second value limits the number of rasterizer threads.");
         _pgeom.reset(new CameraGeomData());
         _pdata.reset(new CameraSensorData());
         _bPower = false;
@@ -144,6 +155,7 @@ public:
         _numchannels = 3;
         _bRenderGeometry = true;
         _bRenderData = false;
+        _renderer = "viewer";
         _Reset();
     }
 
@@ -204,6 +216,7 @@ public:
     virtual void _Reset()
     {
         _pdata->vimagedata.resize(0);
+        _pdata->vdepthdata.resize(0);
         _pdata->__stamp = 0;
         _vimagedata.resize(3*_pgeom->width*_pgeom->height);
         _fTimeToImage = 0;
@@ -220,12 +233,28 @@ public:
             _fTimeToImage -= fTimeElapsed;
             if( _fTimeToImage <= 0 ) {
                 _fTimeToImage = 1 / (float)framerate;
-                GetEnv()->UpdatePublishedBodies();
-                if( !!GetEnv()->GetViewer() ) {
-                    if( GetEnv()->GetViewer()->GetCameraImage(_vimagedata, _pgeom->width, _pgeom->height, _trans, _pgeom->KK) ) {
+                ViewerBasePtr pviewer = GetEnv()->GetViewer();
+                if( _renderer == "software" || (_renderer == "auto" && !pviewer) ) {
+                    _rasterizer.Render(GetEnv(), _trans, _pgeom->KK, _pgeom->width, _pgeom->height, _vimagedata, _vdepthdata);
+                    boost::mutex::scoped_lock lock(_mutexdata);
+                    pdata->vimagedata = _vimagedata;
+                    pdata->vdepthdata = _vdepthdata;
+                    pdata->__stamp = GetEnv()->GetSimulationTime();
+                    pdata->__trans = _trans;
+                }
+                else if( !!pviewer ) {
+                    {
+                        // when the sensors are stepped in parallel, the environment is locked by another thread that already published the bodies
+                        EnvironmentMutex::scoped_try_lock lockenv(GetEnv()->GetMutex());
+                        if( lockenv.owns_lock() ) {
+                            GetEnv()->UpdatePublishedBodies();
+                        }
+                    }
+                    if( pviewer->GetCameraImage(_vimagedata, _pgeom->width, _pgeom->height, _trans, _pgeom->KK) ) {
                         // copy the data
                         boost::mutex::scoped_lock lock(_mutexdata);
                         pdata->vimagedata = _vimagedata;
+                        pdata->vdepthdata.resize(0);
                         pdata->__stamp = GetEnv()->GetSimulationTime();
                         pdata->__trans = _trans;
                     }
@@ -300,6 +329,20 @@ public:
         }
         return false;
     }
+    bool _SetRenderer(ostream& sout, istream& sinput)
+    {
+        string renderer;
+        sinput >> renderer;
+        if( !sinput || (renderer != "auto" && renderer != "viewer" && renderer != "software") ) {
+            return false;
+        }
+        _renderer = renderer;
+        int numthreads = 0;
+        if( sinput >> numthreads ) {
+            _rasterizer.SetNumThreads(numthreads);
+        }
+        return true;
+    }
     bool _SaveImage(ostream& sout, istream& sinput)
     {
         RAVELOG_WARN("SaveImage not implemented yet\n");
@@ -327,6 +370,8 @@ public:
         _bRenderGeometry = r->_bRenderGeometry;
         _bRenderData = r->_bRenderData;
         _bPower = r->_bPower;
+        _renderer = r->_renderer;
+        _rasterizer.SetNumThreads(r->_rasterizer.GetNumThreads());
         _Reset();
     }
 
@@ -379,6 +424,9 @@ protected:
 
     // more geom stuff
     vector<uint8_t> _vimagedata;
+    vector<float> _vdepthdata;
+    CameraRasterizer _rasterizer;
+    string _renderer; ///< auto, viewer, or software
     RaveVector<float> _vColor;
 
     Transform _trans;
@@ -205,9 +205,6 @@ public:
         if(( _fTimeToScan <= 0) && _bPower ) {
             _fTimeToScan = _pgeom->time_scan;
 
-            RAY r;
-
-            GetEnv()->GetCollisionChecker()->SetCollisionOptions(CO_Distance);
             Transform t;
 
             {
@@ -216,10 +213,10 @@ public:
                 t = GetTransform();
                 _pdata->__trans = t;
                 _pdata->__stamp = GetEnv()->GetSimulationTime();
-
-                r.pos = t.trans;
                 _pdata->positions.at(0) = t.trans;
 
+                _vrays.resize(_pgeom->width*_pgeom->height);
+                _vraydirs.resize(_vrays.size());
                 for(int w = 0; w < _pgeom->width; ++w) {
                     for(int h = 0; h < _pgeom->height; ++h) {
                         Vector vdir;
@@ -227,32 +224,29 @@ public:
                         vdir.y = (float)h*_iKK[1] + _iKK[3];
                         vdir.z = 1.0f;
                         vdir = t.rotate(vdir.normalize3());
-                        r.dir = _pgeom->max_range*vdir;
-
                         int index = w*_pgeom->height+h;
-
-                        if( GetEnv()->CheckCollision(r, _report)) {
-                            _pdata->ranges[index] = vdir*_report->minDistance;
-                            _pdata->intensity[index] = 1;
-                            // store the colliding bodies
-                            KinBody::LinkConstPtr plink = !!_report->plink1 ? _report->plink1 : _report->plink2;
-                            if( !!plink ) {
-                                _databodyids[index] = plink->GetParent()->GetEnvironmentId();
-                            }
-                        }
-                        else {
-                            _databodyids[index] = 0;
-                            _pdata->ranges[index] = vdir*_pgeom->max_range;
-                            _pdata->intensity[index] = 0;
-                        }
+                        _vraydirs[index] = vdir;
+                        _vrays[index] = RAY(t.trans, _pgeom->max_range*vdir);
                     }
                 }
 
-                _report->Reset();
+                // cast all the pixels in one query so the checker only has to prepare the scene once
+                GetEnv()->GetCollisionChecker()->CheckCollisionRays(_vrays, KinBodyConstPtr(), _vhitdistances, _vhitnormals, _vhitlinks);
+                for(size_t index = 0; index < _vrays.size(); ++index) {
+                    if( _vhitdistances[index] >= 0 ) {
+                        _pdata->ranges[index] = _vraydirs[index]*_vhitdistances[index];
+                        _pdata->intensity[index] = 1;
+                        // store the colliding bodies
+                        _databodyids[index] = !!_vhitlinks[index] ? _vhitlinks[index]->GetParent()->GetEnvironmentId() : 0;
+                    }
+                    else {
+                        _databodyids[index] = 0;
+                        _pdata->ranges[index] = _vraydirs[index]*_pgeom->max_range;
+                        _pdata->intensity[index] = 0;
+                    }
+                }
             }
 
-            GetEnv()->GetCollisionChecker()->SetCollisionOptions(0);
-
             if( _bRenderData ) {
                 // If can render, check if some time passed before last update
                 list<GraphHandlePtr> listhandles;
@@ -426,6 +420,10 @@ protected:
     boost::shared_ptr<LaserSensorData> _pdata;
     vector<int> _databodyids;     ///< if non 0, for each point in _data, specifies the body that was hit
     CollisionReportPtr _report;
+    vector<RAY> _vrays; ///< scratch buffers of the pixels of one scan
+    vector<Vector> _vraydirs, _vhitnormals;
+    vector<dReal> _vhitdistances;
+    vector<KinBody::LinkConstPtr> _vhitlinks;
     // more geom stuff
     RaveVector<float> _vColor;
     dReal _iKK[4];     // inverse of KK
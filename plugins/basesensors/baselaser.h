@@ -198,9 +198,6 @@ public:
         if( _bPower &&( _fTimeToScan <= 0) ) {
             _fTimeToScan = _pgeom->time_scan;
             Vector rotaxis(0,0,1);
-            RAY r;
-
-            GetEnv()->GetCollisionChecker()->SetCollisionOptions(CO_Distance);
             Transform t;
 
             {
@@ -210,34 +207,34 @@ public:
                 _pdata->__stamp = GetEnv()->GetSimulationTime();
                 t = GetLaserPlaneTransform();
                 _pdata->positions.at(0) = t.trans;
-                size_t index = 0;
-                for(dReal frotangle = _pgeom->min_angle[0]; frotangle <= _pgeom->max_angle[0]; frotangle += _pgeom->resolution[0], ++index) {
-                    if( index >= _pdata->ranges.size() ) {
+                _vrays.resize(0);
+                _vraydirs.resize(0);
+                for(dReal frotangle = _pgeom->min_angle[0]; frotangle <= _pgeom->max_angle[0]; frotangle += _pgeom->resolution[0]) {
+                    if( _vrays.size() >= _pdata->ranges.size() ) {
                         break;
                     }
                     Vector vdir(t.rotate(quatRotate(quatFromAxisAngle(rotaxis, (dReal)frotangle),Vector(1,0,0))));
-                    r.pos = t.trans+_pgeom->min_range*vdir;
-                    r.dir = (_pgeom->max_range-_pgeom->min_range)*vdir;
+                    _vraydirs.push_back(vdir);
+                    _vrays.push_back(RAY(t.trans+_pgeom->min_range*vdir, (_pgeom->max_range-_pgeom->min_range)*vdir));
+                }
 
-                    if( GetEnv()->CheckCollision(r, _report)) {
-                        _pdata->ranges[index] = vdir*(_report->minDistance+_pgeom->min_range);
+                // cast all the beams in one query so the checker only has to prepare the scene once
+                GetEnv()->GetCollisionChecker()->CheckCollisionRays(_vrays, KinBodyConstPtr(), _vhitdistances, _vhitnormals, _vhitlinks);
+                for(size_t index = 0; index < _vrays.size(); ++index) {
+                    if( _vhitdistances[index] >= 0 ) {
+                        _pdata->ranges[index] = _vraydirs[index]*(_vhitdistances[index]+_pgeom->min_range);
                         _pdata->intensity[index] = 1;
                         // store the colliding bodies
-                        KinBody::LinkConstPtr plink = !!_report->plink1 ? _report->plink1 : _report->plink2;
-                        if( !!plink ) {
-                            _databodyids[index] = plink->GetParent()->GetEnvironmentId();
-                        }
+                        _databodyids[index] = !!_vhitlinks[index] ? _vhitlinks[index]->GetParent()->GetEnvironmentId() : 0;
                     }
                     else {
                         _databodyids[index] = 0;
-                        _pdata->ranges[index] = vdir*_pgeom->max_range;
+                        _pdata->ranges[index] = _vraydirs[index]*_pgeom->max_range;
                         _pdata->intensity[index] = 0;
                     }
                 }
             }
 
-            GetEnv()->GetCollisionChecker()->SetCollisionOptions(0);
-
             if( _bRenderData ) {
                 // If can render, check if some time passed before last update
                 list<GraphHandlePtr> listhandles;
@@ -420,6 +417,10 @@ protected:
     boost::shared_ptr<LaserSensorData> _pdata;
     vector<int> _databodyids;     ///< if non 0, for each point in _data, specifies the body that was hit
     CollisionReportPtr _report;
+    vector<RAY> _vrays; ///< scratch buffers of the beams of one scan
+    vector<Vector> _vraydirs, _vhitnormals;
+    vector<dReal> _vhitdistances;
+    vector<KinBody::LinkConstPtr> _vhitlinks;
 
     // more geom stuff
     RaveVector<float> _vColor;
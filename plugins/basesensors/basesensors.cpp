@@ -15,6 +15,7 @@
 #include "plugindefs.h"
 #include "baselaser.h"
 #include "baseflashlidar3d.h"
+#include "camerarasterizer.h"
 #include "basecamera.h"
 #include <openrave/plugin.h>
 
@@ -0,0 +1,367 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2011 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef OPENRAVE_CAMERARASTERIZER_H
+#define OPENRAVE_CAMERARASTERIZER_H
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/condition.hpp>
+
+/// \brief renders the depth and a flat shaded color image of the environment from a pinhole camera without a viewer.
+///
+/// The collision meshes of all visible geometries are projected once, binned into square tiles of the image,
+/// and the tiles are rasterized with a z-buffer by the calling thread and helper threads that are kept between renders. Each triangle is shaded with the diffuse color of its geometry
+/// scaled by the angle between its normal and the viewing ray. The camera looks along +z, +x is to the right and +y is down.
+class CameraRasterizer
+{
+public:
+    CameraRasterizer() : _numthreads(0), _nNextTile(0), _nTilesDone(0), _nTilesToRender(0), _bShutdownThreads(false) {
+    }
+    virtual ~CameraRasterizer() {
+        _StopThreads();
+    }
+
+    /// \brief maximum number of threads to render with including the calling thread, if 0 uses the number of cores
+    void SetNumThreads(int numthreads) {
+        _numthreads = numthreads;
+    }
+    int GetNumThreads() const {
+        return _numthreads;
+    }
+
+    /// \brief renders the environment, the bodies are only read.
+    ///
+    /// No thread can modify the environment during the call, which holds when called with the environment locked or from SensorBase::SimulationStep.
+    /// Several rasterizers can render the same environment in parallel.
+    ///
+    /// \param[out] vimagedata 3*width*height rgb values, rows start from the top of the image. Pixels that see nothing are black.
+    /// \param[out] vdepthdata width*height distances along the +z axis of the camera, 0 where nothing was hit
+    void Render(EnvironmentBasePtr penv, const Transform& tcamera, const SensorBase::CameraIntrinsics& KK, int width, int height, std::vector<uint8_t>& vimagedata, std::vector<float>& vdepthdata)
+    {
+        _width = width;
+        _height = height;
+        _fx = KK.fx; _fy = KK.fy; _cx = KK.cx; _cy = KK.cy;
+        _fnear = KK.focal_length > 0 ? KK.focal_length : 0.01f;
+        _fleft = -_cx/_fx; _fright = (width-_cx)/_fx;
+        _ftop = -_cy/_fy; _fbottom = (height-_cy)/_fy;
+        _numtilesx = (width+s_nTileSize-1)/s_nTileSize;
+        _numtilesy = (height+s_nTileSize-1)/s_nTileSize;
+        _vtiletriangles.resize(_numtilesx*_numtilesy);
+        FOREACH(it,_vtiletriangles) {
+            it->resize(0);
+        }
+        _vtriangles.resize(0);
+
+        Transform tcamerainv = tcamera.inverse();
+        std::vector<KinBodyPtr> vbodies;
+        penv->GetBodies(vbodies);
+        FOREACHC(itbody, vbodies) {
+            if( !(*itbody)->IsVisible() ) {
+                continue;
+            }
+            FOREACHC(itlink, (*itbody)->GetLinks()) {
+                FOREACHC(itgeom, (*itlink)->GetGeometries()) {
+                    const KinBody::Link::Geometry& geom = **itgeom;
+                    if( !geom.IsVisible() || geom.GetTransparency() >= 1 || geom.GetCollisionMesh().indices.size() == 0 ) {
+                        continue;
+                    }
+                    const TriMesh& trimesh = geom.GetCollisionMesh();
+                    TransformMatrix t = tcamerainv * (*itlink)->GetTransform() * geom.GetTransform();
+                    _vpoints.resize(trimesh.vertices.size());
+                    for(size_t i = 0; i < trimesh.vertices.size(); ++i) {
+                        _vpoints[i] = t*trimesh.vertices[i];
+                    }
+                    const RaveVector<float>& vcolor = geom.GetDiffuseColor();
+                    for(size_t i = 0; i+2 < trimesh.indices.size(); i += 3) {
+                        _AddTriangle(_vpoints[trimesh.indices[i]], _vpoints[trimesh.indices[i+1]], _vpoints[trimesh.indices[i+2]], vcolor);
+                    }
+                }
+            }
+        }
+
+        vimagedata.resize(3*width*height);
+        vdepthdata.resize(width*height);
+        _pimagedata = vimagedata.size() > 0 ? &vimagedata[0] : NULL;
+        _pdepthdata = vdepthdata.size() > 0 ? &vdepthdata[0] : NULL;
+        int numtiles = _numtilesx*_numtilesy;
+        int numthreads = _numthreads > 0 ? _numthreads : max(1,(int)boost::thread::hardware_concurrency());
+        numthreads = min(numthreads, numtiles);
+        if( numthreads <= 1 ) {
+            for(int itile = 0; itile < numtiles; ++itile) {
+                _RenderTile(itile, _vinvdepth, _vcolor);
+            }
+        }
+        else {
+            if( (int)_vthreads.size() != numthreads-1 ) {
+                _StopThreads();
+                for(int ithread = 0; ithread < numthreads-1; ++ithread) {
+                    _vthreads.push_back(boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&CameraRasterizer::_RenderThread, this))));
+                }
+            }
+
+            // the calling thread renders tiles too
+            boost::mutex::scoped_lock lock(_mutexThreads);
+            _nNextTile = 0;
+            _nTilesDone = 0;
+            _nTilesToRender = numtiles;
+            _condRender.notify_all();
+            while(_nNextTile < _nTilesToRender) {
+                _RenderNextTile(lock, _vinvdepth, _vcolor);
+            }
+            while(_nTilesDone < _nTilesToRender) {
+                _condRenderDone.wait(lock);
+            }
+        }
+    }
+
+    /// \brief the number of triangles that were projected in the last render
+    size_t GetNumTriangles() const {
+        return _vtriangles.size();
+    }
+
+private:
+    /// \brief a projected triangle set up for rasterization
+    struct Triangle
+    {
+        float a[3], b[3], c[3]; ///< barycentric coordinate of vertex i at pixel (x,y) is a[i]*x + b[i]*y + c[i]
+        float inva[3]; ///< -1/a[i], or 0
+        float dinvzdx, dinvzdy, invz0; ///< inverse depth is linear in image space
+        int minx, maxx, miny, maxy; ///< pixels whose centers can be inside, clamped to the image
+        uint8_t color[3];
+    };
+
+    /// \brief clips a camera space triangle to the near plane, projects it and bins it into the tiles it overlaps
+    void _AddTriangle(const Vector& v0, const Vector& v1, const Vector& v2, const RaveVector<float>& vcolor)
+    {
+        if( v0.z < _fnear && v1.z < _fnear && v2.z < _fnear ) {
+            return;
+        }
+        // outside of one of the side planes of the view frustum
+        if( (v0.x < _fleft*v0.z && v1.x < _fleft*v1.z && v2.x < _fleft*v2.z) || (v0.x > _fright*v0.z && v1.x > _fright*v1.z && v2.x > _fright*v2.z) ||
+            (v0.y < _ftop*v0.z && v1.y < _ftop*v1.z && v2.y < _ftop*v2.z) || (v0.y > _fbottom*v0.z && v1.y > _fbottom*v1.z && v2.y > _fbottom*v2.z) ) {
+            return;
+        }
+        // flat shading with the light at the camera
+        Vector vnormal = (v1-v0).cross(v2-v0), vcenter = v0+v1+v2;
+        dReal fnormallength = vnormal.lengthsqr3()*vcenter.lengthsqr3();
+        if( fnormallength <= 0 ) {
+            return;
+        }
+        float fshade = 0.2f + 0.8f*(float)RaveFabs(vnormal.dot3(vcenter)/RaveSqrt(fnormallength));
+        uint8_t color[3];
+        for(int j = 0; j < 3; ++j) {
+            color[j] = (uint8_t)max(0.0f,min(255.0f,255.0f*fshade*vcolor[j]));
+        }
+
+        Vector vpolygon[4];
+        int numpoints = 0;
+        const Vector* pv[3] = { &v0, &v1, &v2};
+        for(int i = 0; i < 3; ++i) {
+            const Vector& va = *pv[i], &vb = *pv[(i+1)%3];
+            bool bainside = va.z >= _fnear, bbinside = vb.z >= _fnear;
+            if( bainside ) {
+                vpolygon[numpoints++] = va;
+            }
+            if( bainside != bbinside ) {
+                dReal f = (_fnear-va.z)/(vb.z-va.z);
+                vpolygon[numpoints++] = va + (vb-va)*f;
+            }
+        }
+        for(int i = 1; i+1 < numpoints; ++i) {
+            _AddProjectedTriangle(vpolygon[0], vpolygon[i], vpolygon[i+1], color);
+        }
+    }
+
+    void _AddProjectedTriangle(const Vector& v0, const Vector& v1, const Vector& v2, const uint8_t color[3])
+    {
+        float x[3], y[3], invz[3];
+        const Vector* pv[3] = { &v0, &v1, &v2};
+        float fminx = 1e30f, fmaxx = -1e30f, fminy = 1e30f, fmaxy = -1e30f;
+        for(int i = 0; i < 3; ++i) {
+            invz[i] = 1/(float)pv[i]->z;
+            x[i] = _fx*(float)pv[i]->x*invz[i] + _cx;
+            y[i] = _fy*(float)pv[i]->y*invz[i] + _cy;
+            fminx = min(fminx,x[i]); fmaxx = max(fmaxx,x[i]);
+            fminy = min(fminy,y[i]); fmaxy = max(fmaxy,y[i]);
+        }
+        if( fmaxx < 0.5f || fmaxy < 0.5f || fminx >= _width-0.5f || fminy >= _height-0.5f ) {
+            return;
+        }
+        Triangle tri;
+        // clamp before converting since vertices close to the near plane can project far outside of the image
+        tri.minx = (int)max(0.0f,fminx+0.5f); tri.maxx = (int)min((float)(_width-1),fmaxx-0.5f);
+        tri.miny = (int)max(0.0f,fminy+0.5f); tri.maxy = (int)min((float)(_height-1),fmaxy-0.5f);
+        if( (float)tri.minx+0.5f < fminx ) {
+            ++tri.minx;
+        }
+        if( (float)tri.miny+0.5f < fminy ) {
+            ++tri.miny;
+        }
+        if( tri.minx > tri.maxx || tri.miny > tri.maxy ) {
+            // too small to cover any pixel center
+            return;
+        }
+        float farea = (x[1]-x[0])*(y[2]-y[0]) - (y[1]-y[0])*(x[2]-x[0]);
+        if( fabsf(farea) < 1e-12f ) {
+            return;
+        }
+        float finvarea = 1/farea;
+        for(int i = 0; i < 3; ++i) {
+            int i1 = (i+1)%3, i2 = (i+2)%3;
+            tri.a[i] = (y[i1]-y[i2])*finvarea;
+            tri.b[i] = (x[i2]-x[i1])*finvarea;
+            tri.c[i] = (x[i1]*y[i2]-x[i2]*y[i1])*finvarea;
+            tri.inva[i] = tri.a[i] != 0 ? -1/tri.a[i] : 0;
+        }
+        tri.dinvzdx = tri.a[0]*invz[0] + tri.a[1]*invz[1] + tri.a[2]*invz[2];
+        tri.dinvzdy = tri.b[0]*invz[0] + tri.b[1]*invz[1] + tri.b[2]*invz[2];
+        tri.invz0 = tri.c[0]*invz[0] + tri.c[1]*invz[1] + tri.c[2]*invz[2];
+        tri.color[0] = color[0]; tri.color[1] = color[1]; tri.color[2] = color[2];
+        int index = (int)_vtriangles.size();
+        _vtriangles.push_back(tri);
+        for(int tiley = tri.miny/s_nTileSize; tiley <= tri.maxy/s_nTileSize; ++tiley) {
+            for(int tilex = tri.minx/s_nTileSize; tilex <= tri.maxx/s_nTileSize; ++tilex) {
+                _vtiletriangles[tiley*_numtilesx+tilex].push_back(index);
+            }
+        }
+    }
+
+    /// \brief renders the next tile of the current render, has to be called with _mutexThreads locked by lock
+    void _RenderNextTile(boost::mutex::scoped_lock& lock, std::vector<float>& vinvdepth, std::vector<uint8_t>& vcolor)
+    {
+        int itile = _nNextTile++;
+        lock.unlock();
+        _RenderTile(itile, vinvdepth, vcolor);
+        lock.lock();
+        if( ++_nTilesDone == _nTilesToRender ) {
+            _condRenderDone.notify_all();
+        }
+    }
+
+    void _RenderThread()
+    {
+        std::vector<float> vinvdepth;
+        std::vector<uint8_t> vcolor;
+        boost::mutex::scoped_lock lock(_mutexThreads);
+        while(!_bShutdownThreads) {
+            if( _nNextTile < _nTilesToRender ) {
+                _RenderNextTile(lock, vinvdepth, vcolor);
+            }
+            else {
+                _condRender.wait(lock);
+            }
+        }
+    }
+
+    void _StopThreads()
+    {
+        {
+            boost::mutex::scoped_lock lock(_mutexThreads);
+            _bShutdownThreads = true;
+            _condRender.notify_all();
+        }
+        FOREACH(itthread, _vthreads) {
+            (*itthread)->join();
+        }
+        _vthreads.clear();
+        _bShutdownThreads = false;
+    }
+
+    /// \brief rasterizes the triangles of one tile
+    ///
+    /// \param vinvdepth, vcolor scratch buffers of the calling thread
+    void _RenderTile(int itile, std::vector<float>& vinvdepth, std::vector<uint8_t>& vcolor)
+    {
+        // inverse depth buffer of a tile, 0 is infinitely far
+        vinvdepth.resize(s_nTileSize*s_nTileSize);
+        vcolor.resize(3*s_nTileSize*s_nTileSize);
+        int startx = (itile%_numtilesx)*s_nTileSize, starty = (itile/_numtilesx)*s_nTileSize;
+        int endx = min(startx+s_nTileSize,_width), endy = min(starty+s_nTileSize,_height);
+        std::fill(vinvdepth.begin(),vinvdepth.end(),0.0f);
+        std::fill(vcolor.begin(),vcolor.end(),0);
+        FOREACHC(ittri, _vtiletriangles[itile]) {
+            const Triangle& tri = _vtriangles[*ittri];
+            int minx = max(startx,tri.minx), maxx = min(endx-1,tri.maxx);
+            int miny = max(starty,tri.miny), maxy = min(endy-1,tri.maxy);
+            for(int y = miny; y <= maxy; ++y) {
+                float fy = y+0.5f;
+                // solve for the span of pixel centers inside all three edges instead of testing every pixel of the bounding box
+                float fspanmin = (float)minx+0.5f, fspanmax = (float)maxx+0.5f;
+                for(int i = 0; i < 3; ++i) {
+                    float r = tri.b[i]*fy+tri.c[i];
+                    if( tri.a[i] > 0 ) {
+                        fspanmin = max(fspanmin,r*tri.inva[i]);
+                    }
+                    else if( tri.a[i] < 0 ) {
+                        fspanmax = min(fspanmax,r*tri.inva[i]);
+                    }
+                    else if( r < 0 ) {
+                        fspanmax = fspanmin-1;
+                    }
+                }
+                if( fspanmin > fspanmax ) {
+                    continue;
+                }
+                // both are at least minx, so the casts round down
+                float fstart = fspanmin-0.5f;
+                int spanmin = (int)fstart, spanmax = (int)(fspanmax-0.5f);
+                if( (float)spanmin < fstart ) {
+                    ++spanmin;
+                }
+                float finvz = tri.invz0 + tri.dinvzdy*fy + tri.dinvzdx*((float)spanmin+0.5f);
+                int index = (y-starty)*s_nTileSize+(spanmin-startx);
+                for(int x = spanmin; x <= spanmax; ++x, ++index, finvz += tri.dinvzdx) {
+                    if( finvz > vinvdepth[index] ) {
+                        vinvdepth[index] = finvz;
+                        vcolor[3*index+0] = tri.color[0];
+                        vcolor[3*index+1] = tri.color[1];
+                        vcolor[3*index+2] = tri.color[2];
+                    }
+                }
+            }
+        }
+        for(int y = starty; y < endy; ++y) {
+            for(int x = startx; x < endx; ++x) {
+                int index = (y-starty)*s_nTileSize+(x-startx), imageindex = y*_width+x;
+                _pdepthdata[imageindex] = vinvdepth[index] > 0 ? 1/vinvdepth[index] : 0;
+                _pimagedata[3*imageindex+0] = vcolor[3*index+0];
+                _pimagedata[3*imageindex+1] = vcolor[3*index+1];
+                _pimagedata[3*imageindex+2] = vcolor[3*index+2];
+            }
+        }
+    }
+
+    static const int s_nTileSize = 32;
+
+    int _numthreads;
+    int _width, _height, _numtilesx, _numtilesy;
+    float _fx, _fy, _cx, _cy, _fnear;
+    float _fleft, _fright, _ftop, _fbottom; ///< slopes of the side planes of the view frustum
+    std::vector<Vector> _vpoints; ///< camera space vertices of the current geometry
+    std::vector<Triangle> _vtriangles;
+    std::vector< std::vector<int> > _vtiletriangles; ///< indices into _vtriangles for every tile
+    uint8_t* _pimagedata;
+    float* _pdepthdata;
+    std::vector<float> _vinvdepth; ///< tile buffers of the calling thread
+    std::vector<uint8_t> _vcolor;
+
+    std::vector<boost::shared_ptr<boost::thread> > _vthreads; ///< helper threads of Render, the calling thread is not included
+    boost::mutex _mutexThreads; ///< protects the tile counters below
+    boost::condition _condRender, _condRenderDone;
+    int _nNextTile, _nTilesDone, _nTilesToRender;
+    bool _bShutdownThreads;
+};
+
+#endif
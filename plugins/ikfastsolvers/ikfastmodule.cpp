@@ -257,8 +257,18 @@ public:
 #endif
         RegisterCommand("PerfTiming",boost::bind(&IkFastModule::PerfTiming,this,_1,_2),
                         "Times the ik call of a given library.\n"
-                        "Usage::\n\n  PerfTiming [options] iklibrarypath\n\n"
-                        "return the set of time measurements made in nano-seconds");
+                        "Usage::\n\n  PerfTiming [options] iklibrarypath\n  PerfTiming [options] freesearch robotname manipname\n\n"
+                        "return the set of time measurements made in nano-seconds. "
+                        "With freesearch, times FindIKSolution with environment collisions for random reachable poses using each free parameter search strategy of the manipulator's ik solver (see its SetFreeSearch command), "
+                        "and returns one line per strategy: strategy numsuccess meantime maxtime");
+        RegisterCommand("SetIkCache",boost::bind(&IkFastModule::SetIkCache,this,_1,_2),
+                        "Enables caching of FindIKSolution results of a manipulator (see RobotBase::Manipulator::SetIkCache).\n"
+                        "Usage::\n\n  SetIkCache robotname manipname resolution [maxentries]\n\n"
+                        "A resolution of 0 disables the cache.");
+        RegisterCommand("GetIkCacheStats",boost::bind(&IkFastModule::GetIkCacheStats,this,_1,_2),
+                        "Returns the statistics of the ik cache of a manipulator.\n"
+                        "Usage::\n\n  GetIkCacheStats robotname manipname\n\n"
+                        "return numhits nummisses numinvalidations numentries hitrate");
         RegisterCommand("IKTest",boost::bind(&IkFastModule::IKtest,this,_1,_2),
                         "Tests for an IK solution if active manipulation has an IK solver attached");
         RegisterCommand("DebugIK",boost::bind(&IkFastModule::DebugIK,this,_1,_2),
@@ -531,6 +541,9 @@ public:
             else if( cmd == "maxtime" ) {
                 sinput >> maxtime;
             }
+            else if( cmd == "freesearch" ) {
+                return _PerfTimingFreeSearch(sout, sinput, num, maxtime);
+            }
             else {
                 sinput.clear();     // have to clear eof bit
                 sinput.seekg(pos);
@@ -599,6 +612,135 @@ public:
         return true;
     }
 
+    bool _PerfTimingFreeSearch(ostream& sout, istream& sinput, int num, dReal maxtime)
+    {
+        RobotBase::ManipulatorPtr pmanip = _GetManipulator(sinput);
+        if( !pmanip || !pmanip->GetIkSolver() ) {
+            return false;
+        }
+        IkSolverBasePtr iksolver = pmanip->GetIkSolver();
+        stringstream ssorig, ssin;
+        ssin << "GetFreeSearch";
+        if( !iksolver->SendCommand(ssorig, ssin) ) {
+            RAVELOG_WARN(str(boost::format("ik solver %s does not support free parameter search strategies\n")%iksolver->GetXMLId()));
+            return false;
+        }
+        string origstrategy;
+        int bWarmStart = 0, bFirstValid = 0;
+        ssorig >> origstrategy >> bWarmStart >> bFirstValid;
+        IkParameterizationType iktype = IKP_None;
+        FOREACHC(itiktype, RaveGetIkParameterizationMap()) {
+            if( iksolver->Supports(itiktype->first) ) {
+                iktype = itiktype->first;
+                break;
+            }
+        }
+
+        RobotBasePtr probot = pmanip->GetRobot();
+        RobotBase::RobotStateSaver saver(probot);
+        probot->SetActiveDOFs(pmanip->GetArmIndices());
+        vector<dReal> vlower, vupper, vinitial, vsample(pmanip->GetArmIndices().size()), vsolution;
+        probot->GetActiveDOFLimits(vlower, vupper);
+        probot->GetActiveDOFValues(vinitial);
+
+        // sample poses the manipulator can reach without colliding
+        vector<IkParameterization> vparams;
+        for(int i = 0; i < 100*num && (int)vparams.size() < num; ++i) {
+            for(size_t j = 0; j < vsample.size(); ++j) {
+                vsample[j] = vlower[j] + (vupper[j]-vlower[j])*RaveRandomFloat();
+            }
+            probot->SetActiveDOFValues(vsample);
+            if( !GetEnv()->CheckCollision(KinBodyConstPtr(probot)) && !probot->CheckSelfCollision() ) {
+                vparams.push_back(pmanip->GetIkParameterization(iktype));
+            }
+        }
+        probot->SetActiveDOFValues(vinitial);
+
+        const char* strategies[] = { "linear", "lowdiscrepancy", "coarsetofine"};
+        uint32_t runmaxtimems = (uint32_t)(1000*maxtime);
+        for(int istrategy = 0; istrategy < 3; ++istrategy) {
+            stringstream ssout;
+            ssin.str(""); ssin.clear();
+            ssin << "SetFreeSearch " << strategies[istrategy] << " warmstart " << bWarmStart << " firstvalid " << bFirstValid;
+            iksolver->SendCommand(ssout, ssin);
+            int numsuccess = 0;
+            size_t i = 0;
+            uint64_t totaltime = 0, maxsolvetime = 0;
+            uint32_t runstarttimems = utils::GetMilliTime();
+            for(i = 0; i < vparams.size(); ++i) {
+                if( (utils::GetMilliTime() - runstarttimems) > runmaxtimems ) {
+                    break;
+                }
+                uint64_t starttime = utils::GetNanoPerformanceTime();
+                if( pmanip->FindIKSolution(vparams[i], vsolution, IKFO_CheckEnvCollisions) ) {
+                    numsuccess++;
+                }
+                uint64_t solvetime = utils::GetNanoPerformanceTime()-starttime;
+                totaltime += solvetime;
+                maxsolvetime = max(maxsolvetime, solvetime);
+            }
+            sout << strategies[istrategy] << " " << numsuccess << " " << (i > 0 ? totaltime/i : 0) << " " << maxsolvetime << endl;
+        }
+
+        stringstream ssout;
+        ssin.str(""); ssin.clear();
+        ssin << "SetFreeSearch " << origstrategy << " warmstart " << bWarmStart << " firstvalid " << bFirstValid;
+        iksolver->SendCommand(ssout, ssin);
+        return true;
+    }
+
+    RobotBase::ManipulatorPtr _GetManipulator(istream& sinput)
+    {
+        string robotname, manipname;
+        sinput >> robotname >> manipname;
+        if( !sinput ) {
+            return RobotBase::ManipulatorPtr();
+        }
+        RobotBasePtr probot = GetEnv()->GetRobot(robotname);
+        if( !probot ) {
+            RAVELOG_WARN(str(boost::format("could not find robot %s\n")%robotname));
+            return RobotBase::ManipulatorPtr();
+        }
+        FOREACHC(itmanip, probot->GetManipulators()) {
+            if( (*itmanip)->GetName() == manipname ) {
+                return *itmanip;
+            }
+        }
+        RAVELOG_WARN(str(boost::format("could not find manipulator %s:%s\n")%robotname%manipname));
+        return RobotBase::ManipulatorPtr();
+    }
+
+    bool SetIkCache(ostream& sout, istream& sinput)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        RobotBase::ManipulatorPtr pmanip = _GetManipulator(sinput);
+        dReal fresolution = 0;
+        sinput >> fresolution;
+        if( !pmanip || !sinput ) {
+            return false;
+        }
+        size_t maxentries = 10000;
+        sinput >> maxentries;
+        if( !sinput || maxentries == 0 ) {
+            maxentries = 10000;
+        }
+        pmanip->SetIkCache(fresolution, maxentries);
+        return true;
+    }
+
+    bool GetIkCacheStats(ostream& sout, istream& sinput)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        RobotBase::ManipulatorPtr pmanip = _GetManipulator(sinput);
+        uint64_t numhits=0, nummisses=0, numinvalidations=0;
+        size_t numentries=0;
+        if( !pmanip || !pmanip->GetIkCacheStatistics(numhits, nummisses, numinvalidations, numentries) ) {
+            return false;
+        }
+        sout << numhits << " " << nummisses << " " << numinvalidations << " " << numentries << " " << (numhits+nummisses > 0 ? (dReal)numhits/(dReal)(numhits+nummisses) : dReal(0));
+        return true;
+    }
+
     bool IKtest(ostream& sout, istream& sinput)
     {
         EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
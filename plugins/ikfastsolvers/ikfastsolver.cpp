@@ -44,10 +44,23 @@ public:
         _kinematicshash = ikfunctions->_GetKinematicsHash();
         __description = ":Interface Author: Rosen Diankov\n\nAn OpenRAVE wrapper for the ikfast generated files.\nIf 6D IK is used, will check if the end effector and other independent links are in collision before manipulator link collisions. If they are, the IK will terminate with failure immediately.\nBecause checking collisions is the slowest part of the IK, the custom filter function run before collision checking.";
         _ikthreshold = 1e-4;
+        _freesearchstrategy = FSS_Linear;
+        _bFreeSearchWarmStart = false;
+        _bFreeSearchFirstValid = false;
         RegisterCommand("SetIkThreshold",boost::bind(&IkFastSolver<IkReal>::_SetIkThresholdCommand,this,_1,_2),
                         "sets the ik threshold for validating returned ik solutions");
         RegisterCommand("SetFreeIncrements",boost::bind(&IkFastSolver<IkReal>::_SetFreeIncrementsCommand,this,_1,_2),
                         "Specify two values. First is the default free increment for revolute joint and second is the number of segment to divide free prismatic joints. ");
+        RegisterCommand("SetFreeSearch",boost::bind(&IkFastSolver<IkReal>::_SetFreeSearchCommand,this,_1,_2),
+                        "Sets the order the free parameters are searched in. Usage::\n\n  SetFreeSearch strategy [warmstart 0|1] [firstvalid 0|1]\n\n"
+                        "strategy is one of:\n\n"
+                        "* linear - (default) step outwards from the current value in increments of the free increment.\n"
+                        "* lowdiscrepancy - visit the same values in van der Corput order starting from the current value, so the whole range is covered evenly early on.\n"
+                        "* coarsetofine - visit the same values by bisecting the range around the current value, coarse steps first.\n\n"
+                        "If warmstart is 1, the free values of the last successful Solve call are tried first. "
+                        "If firstvalid is 1, Solve returns the first valid solution found for a set of free values instead of the closest one to the seed configuration.");
+        RegisterCommand("GetFreeSearch",boost::bind(&IkFastSolver<IkReal>::_GetFreeSearchCommand,this,_1,_2),
+                        "Returns the free parameter search settings: strategy warmstart firstvalid");
         RegisterCommand("GetSolutionIndices",boost::bind(&IkFastSolver<IkReal>::_GetSolutionIndicesCommand,this,_1,_2),
                         "**Can only be called by a custom filter during a Solve function call.** Gets the indices of the current solution being considered. if large-range joints wrap around, (index>>16) holds the index. So (index&0xffff) is unique to robot link pose, while (index>>16) describes the repetition.");
         RegisterCommand("GetRobotLinkStateRepeatCount", boost::bind(&IkFastSolver<IkReal>::_GetRobotLinkStateRepeatCountCommand,this,_1,_2),
@@ -78,6 +91,67 @@ public:
         return !!sinput;
     }
 
+    bool _SetFreeSearchCommand(ostream& sout, istream& sinput)
+    {
+        string strategy, cmd;
+        sinput >> strategy;
+        if( !sinput ) {
+            return false;
+        }
+        std::transform(strategy.begin(), strategy.end(), strategy.begin(), ::tolower);
+        FreeSearchStrategy freesearchstrategy;
+        if( strategy == "linear" ) {
+            freesearchstrategy = FSS_Linear;
+        }
+        else if( strategy == "lowdiscrepancy" ) {
+            freesearchstrategy = FSS_LowDiscrepancy;
+        }
+        else if( strategy == "coarsetofine" ) {
+            freesearchstrategy = FSS_CoarseToFine;
+        }
+        else {
+            RAVELOG_WARN(str(boost::format("unknown free search strategy %s\n")%strategy));
+            return false;
+        }
+        bool bWarmStart = _bFreeSearchWarmStart, bFirstValid = _bFreeSearchFirstValid;
+        while(!sinput.eof()) {
+            sinput >> cmd;
+            if( !sinput ) {
+                break;
+            }
+            std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
+            if( cmd == "warmstart" ) {
+                sinput >> bWarmStart;
+            }
+            else if( cmd == "firstvalid" ) {
+                sinput >> bFirstValid;
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("unrecognized command: %s\n")%cmd));
+                return false;
+            }
+            if( !sinput ) {
+                return false;
+            }
+        }
+        _freesearchstrategy = freesearchstrategy;
+        _bFreeSearchWarmStart = bWarmStart;
+        _bFreeSearchFirstValid = bFirstValid;
+        _vwarmstartfree.resize(0);
+        return true;
+    }
+
+    bool _GetFreeSearchCommand(ostream& sout, istream& sinput)
+    {
+        switch(_freesearchstrategy) {
+        case FSS_LowDiscrepancy: sout << "lowdiscrepancy"; break;
+        case FSS_CoarseToFine: sout << "coarsetofine"; break;
+        default: sout << "linear"; break;
+        }
+        sout << " " << _bFreeSearchWarmStart << " " << _bFreeSearchFirstValid;
+        return true;
+    }
+
     bool _GetSolutionIndicesCommand(ostream& sout, istream& sinput)
     {
         sout << _vsolutionindices.size() << " ";
@@ -203,6 +277,22 @@ public:
         return iktype == _iktype;
     }
 
+    virtual void Clone(InterfaceBaseConstPtr preference, int cloningoptions)
+    {
+        IkSolverBase::Clone(preference,cloningoptions);
+        boost::shared_ptr<IkFastSolver<IkReal> const > r = boost::dynamic_pointer_cast<IkFastSolver<IkReal> const>(preference);
+        if( !!r ) {
+            // Init only resets _vFreeInc when its size is wrong
+            _vFreeInc = r->_vFreeInc;
+            _fFreeIncRevolute = r->_fFreeIncRevolute;
+            _fFreeIncPrismaticNum = r->_fFreeIncPrismaticNum;
+            _ikthreshold = r->_ikthreshold;
+            _freesearchstrategy = r->_freesearchstrategy;
+            _bFreeSearchWarmStart = r->_bFreeSearchWarmStart;
+            _bFreeSearchFirstValid = r->_bFreeSearchFirstValid;
+        }
+    }
+
     /// \brief manages the enabling and disabling of the end effector links depending on the filter options
     class StateCheckEndEffector
     {
@@ -399,10 +489,14 @@ protected:
         std::vector<IkReal> vfree(_vfreeparams.size());
         StateCheckEndEffector stateCheck(probot,_vchildlinks,_vindependentlinks,filteroptions);
         CollisionOptionsStateSaver optionstate(GetEnv()->GetCollisionChecker(),GetEnv()->GetCollisionChecker()->GetCollisionOptions()|CO_ActiveDOFs,false);
-        IkReturnAction retaction = ComposeSolution(_vfreeparams, vfree, 0, q0, boost::bind(&IkFastSolver::_SolveSingle,shared_solver(), boost::ref(param),boost::ref(vfree),boost::ref(q0),filteroptions,ikreturn,boost::ref(stateCheck)), _vFreeInc);
+        IkReturnAction retaction = ComposeSolution(_vfreeparams, vfree, 0, q0, boost::bind(&IkFastSolver::_SolveSingle,shared_solver(), boost::ref(param),boost::ref(vfree),boost::ref(q0),filteroptions,ikreturn,boost::ref(stateCheck)), _vFreeInc, _bFreeSearchWarmStart);
         if( !!ikreturn ) {
             ikreturn->_action = retaction;
         }
+        if( retaction == IKRA_Success && _bFreeSearchWarmStart ) {
+            _vwarmstartfree.resize(vfree.size());
+            std::copy(vfree.begin(), vfree.end(), _vwarmstartfree.begin());
+        }
         return retaction == IKRA_Success;
     }
 
@@ -509,7 +603,54 @@ protected:
     }
 
 private:
-    IkReturnAction ComposeSolution(const std::vector<int>& vfreeparams, vector<IkReal>& vfree, int freeindex, const vector<dReal>& q0, const boost::function<IkReturnAction()>& fn, const std::vector<dReal>& vFreeInc)
+    /// \brief steps outwards from a start value, alternating below and above it, in increments of fFreeInc inside the limits
+    class LinearFreeSearch
+    {
+public:
+        LinearFreeSearch(dReal startphi, dReal lowerphi, dReal upperphi, dReal fFreeInc) : _startphi(startphi), _lowerphi(lowerphi), _upperphi(upperphi), _fFreeInc(fFreeInc), _deltaphi(0), _iter(0) {
+        }
+
+        /// \return false once all values were visited
+        bool Next(dReal& curphi)
+        {
+            while(1) {
+                curphi = _startphi;
+                if( _iter & 1 ) { // increment
+                    curphi += _deltaphi;
+                    if( curphi > _upperphi ) {
+                        if( _startphi-_deltaphi < _lowerphi) {
+                            return false; // reached limit
+                        }
+                        ++_iter;
+                        continue;
+                    }
+                }
+                else { // decrement
+                    curphi -= _deltaphi;
+                    if( curphi < _lowerphi ) {
+                        if( _startphi+_deltaphi > _upperphi ) {
+                            return false; // reached limit
+                        }
+                        _deltaphi += _fFreeInc; // increment
+                        ++_iter;
+                        continue;
+                    }
+
+                    _deltaphi += _fFreeInc; // increment
+                }
+
+                _iter++;
+                return true;
+            }
+        }
+
+private:
+        dReal _startphi, _lowerphi, _upperphi, _fFreeInc, _deltaphi;
+        int _iter;
+    };
+
+    /// \param bWarmStart if true, the value closest to _vwarmstartfree is tried first for every free joint
+    IkReturnAction ComposeSolution(const std::vector<int>& vfreeparams, vector<IkReal>& vfree, int freeindex, const vector<dReal>& q0, const boost::function<IkReturnAction()>& fn, const std::vector<dReal>& vFreeInc, bool bWarmStart=false)
     {
         if( freeindex >= (int)vfreeparams.size()) {
             return fn();
@@ -517,50 +658,74 @@ private:
 
         // start searching for phi close to q0, as soon as a solution is found for the curphi, return it
         dReal startphi = q0.size() == _qlower.size() ? q0.at(vfreeparams.at(freeindex)) : 0;
-        dReal upperphi = _qupper.at(vfreeparams.at(freeindex)), lowerphi = _qlower.at(vfreeparams.at(freeindex)), deltaphi = 0;
-        int iter = 0;
-        dReal fFreeInc = vFreeInc.at(freeindex);
+        dReal upperphi = _qupper.at(vfreeparams.at(freeindex)), lowerphi = _qlower.at(vfreeparams.at(freeindex));
+        bWarmStart &= _vwarmstartfree.size() == vfreeparams.size();
         int allres = IKRA_Reject;
-        while(1) {
-            dReal curphi = startphi;
-            if( iter & 1 ) { // increment
-                curphi += deltaphi;
-                if( curphi > upperphi ) {
-                    if( startphi-deltaphi < lowerphi) {
-                        break; // reached limit
+        if( _freesearchstrategy == FSS_Linear ) {
+            // the default strategy is generated on the fly so that solving does not allocate
+            dReal curphi, warmphi = 0;
+            if( bWarmStart ) {
+                // try the value closest to the last successful one first
+                bool bfound = false;
+                LinearFreeSearch search(startphi, lowerphi, upperphi, vFreeInc.at(freeindex));
+                while(search.Next(curphi)) {
+                    if( !bfound || RaveFabs(curphi-_vwarmstartfree[freeindex]) < RaveFabs(warmphi-_vwarmstartfree[freeindex]) ) {
+                        warmphi = curphi;
+                        bfound = true;
                     }
-                    ++iter;
+                }
+                if( bfound ) {
+                    vfree.at(freeindex) = warmphi;
+                    IkReturnAction res = ComposeSolution(vfreeparams, vfree, freeindex+1, q0, fn, vFreeInc, bWarmStart);
+                    if( !(res & IKRA_Reject) ) {
+                        return res;
+                    }
+                    allres |= res;
+                }
+                bWarmStart = bfound;
+            }
+            LinearFreeSearch search(startphi, lowerphi, upperphi, vFreeInc.at(freeindex));
+            while(search.Next(curphi)) {
+                // the same sequence of operations gives the same value, so the warm start value is skipped exactly
+                if( bWarmStart && curphi == warmphi ) {
                     continue;
                 }
+                vfree.at(freeindex) = curphi;
+                IkReturnAction res = ComposeSolution(vfreeparams, vfree, freeindex+1,q0, fn, vFreeInc, bWarmStart);
+                if( !(res & IKRA_Reject) ) {
+                    return res;
+                }
+                allres |= res;
             }
-            else { // decrement
-                curphi -= deltaphi;
-                if( curphi < lowerphi ) {
-                    if( startphi+deltaphi > upperphi ) {
-                        break; // reached limit
+        }
+        else {
+            std::vector<dReal> vphis;
+            _GetFreeSearchValues(startphi, lowerphi, upperphi, vFreeInc.at(freeindex), vphis);
+            if( bWarmStart && vphis.size() > 1 ) {
+                // try the value closest to the last successful one first
+                dReal warmphi = _vwarmstartfree[freeindex];
+                std::vector<dReal>::iterator itbest = vphis.begin();
+                FOREACH(itphi, vphis) {
+                    if( RaveFabs(*itphi-warmphi) < RaveFabs(*itbest-warmphi) ) {
+                        itbest = itphi;
                     }
-                    deltaphi += fFreeInc; // increment
-                    ++iter;
-                    continue;
                 }
-
-                deltaphi += fFreeInc; // increment
+                std::rotate(vphis.begin(), itbest, itbest+1);
             }
-
-            iter++;
-
-            vfree.at(freeindex) = curphi;
-            IkReturnAction res = ComposeSolution(vfreeparams, vfree, freeindex+1,q0, fn, vFreeInc);
-            if( !(res & IKRA_Reject) ) {
-                return res;
+            FOREACHC(itphi, vphis) {
+                vfree.at(freeindex) = *itphi;
+                IkReturnAction res = ComposeSolution(vfreeparams, vfree, freeindex+1,q0, fn, vFreeInc, bWarmStart);
+                if( !(res & IKRA_Reject) ) {
+                    return res;
+                }
+                allres |= res;
             }
-            allres |= res;
         }
 
         // explicitly test 0 since many edge cases involve 0s
         if( _qlower[vfreeparams[freeindex]] <= 0 && _qupper[vfreeparams[freeindex]] >= 0 ) {
             vfree.at(freeindex) = 0;
-            IkReturnAction res = ComposeSolution(vfreeparams, vfree, freeindex+1,q0, fn, vFreeInc);
+            IkReturnAction res = ComposeSolution(vfreeparams, vfree, freeindex+1,q0, fn, vFreeInc, bWarmStart);
             if( !(res & IKRA_Reject) ) {
                 return res;
             }
@@ -570,6 +735,72 @@ private:
         return static_cast<IkReturnAction>(allres);
     }
 
+    /// \brief computes the values a free joint is set to during the search, in the order of _freesearchstrategy
+    ///
+    /// All strategies visit the same values: startphi plus multiples of fFreeInc inside [lowerphi, upperphi]. Only the order changes.
+    void _GetFreeSearchValues(dReal startphi, dReal lowerphi, dReal upperphi, dReal fFreeInc, std::vector<dReal>& vphis)
+    {
+        vphis.resize(0);
+        dReal curphi;
+        LinearFreeSearch search(startphi, lowerphi, upperphi, fFreeInc);
+        while(search.Next(curphi)) {
+            vphis.push_back(curphi);
+        }
+
+        if( _freesearchstrategy == FSS_Linear || vphis.size() <= 2 ) {
+            return;
+        }
+
+        // order the values along the joint and start from the one closest to startphi
+        std::vector<dReal> vgrid(vphis);
+        std::sort(vgrid.begin(), vgrid.end());
+        int n = (int)vgrid.size(), istart = 0;
+        for(int i = 1; i < n; ++i) {
+            if( RaveFabs(vgrid[i]-startphi) < RaveFabs(vgrid[istart]-startphi) ) {
+                istart = i;
+            }
+        }
+        int nbits = 0;
+        while( (1<<nbits) < n ) {
+            ++nbits;
+        }
+
+        vphis.resize(0);
+        if( _freesearchstrategy == FSS_LowDiscrepancy ) {
+            // base 2 van der Corput sequence over the grid, rotated to start at istart
+            for(int i = 0; i < (1<<nbits); ++i) {
+                int j = 0;
+                for(int ibit = 0; ibit < nbits; ++ibit) {
+                    if( i & (1<<ibit) ) {
+                        j |= 1<<(nbits-1-ibit);
+                    }
+                }
+                if( j < n ) {
+                    vphis.push_back(vgrid[(istart+j)%n]);
+                }
+            }
+        }
+        else {
+            // bisection around istart: first every 2^(nbits-1)th value, then every 2^(nbits-2)th, etc, closest first
+            std::vector<uint8_t> vvisited(n,0);
+            vphis.push_back(vgrid[istart]);
+            vvisited[istart] = 1;
+            for(int step = (1<<nbits)/2; step >= 1; step /= 2) {
+                for(int d = step; istart-d >= 0 || istart+d < n; d += step) {
+                    if( istart+d < n && !vvisited[istart+d] ) {
+                        vphis.push_back(vgrid[istart+d]);
+                        vvisited[istart+d] = 1;
+                    }
+                    if( istart-d >= 0 && !vvisited[istart-d] ) {
+                        vphis.push_back(vgrid[istart-d]);
+                        vvisited[istart-d] = 1;
+                    }
+                }
+            }
+        }
+        BOOST_ASSERT((int)vphis.size() == n);
+    }
+
     bool _CallIK(const IkParameterization& param, const vector<IkReal>& vfree, ikfast::IkSolutionList<IkReal>& solutions)
     {
         try {
@@ -767,7 +998,7 @@ private:
                 return static_cast<IkReturnAction>(allres);
             }
             // stop if there is no solution we are attempting to get close to
-            if( res == IKRA_Success && q0.size() != pmanip->GetArmIndices().size() ) {
+            if( res == IKRA_Success && (q0.size() != pmanip->GetArmIndices().size() || _bFreeSearchFirstValid) ) {
                 break;
             }
         }
@@ -1270,6 +1501,16 @@ private:
     std::string _kinematicshash;
     dReal _ikthreshold;
 
+    enum FreeSearchStrategy {
+        FSS_Linear=0, ///< step outwards from the start value
+        FSS_LowDiscrepancy=1, ///< van der Corput order over the same values
+        FSS_CoarseToFine=2 ///< bisection around the start value
+    };
+    FreeSearchStrategy _freesearchstrategy;
+    bool _bFreeSearchWarmStart; ///< if true, the free values of the last successful Solve call are tried first
+    bool _bFreeSearchFirstValid; ///< if true, _SolveSingle stops at the first valid solution even if q0 is specified
+    std::vector<dReal> _vwarmstartfree; ///< free values of the last successful Solve call
+
     // cache for current Solve call. This has to be saved/restored if any user functions are called (like filters)
     std::vector<unsigned int> _vsolutionindices; ///< holds the indices of the current solution, this is not multi-thread safe
     int _nSameStateRepeatCount;
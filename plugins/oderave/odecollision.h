@@ -39,6 +39,20 @@ class ODECollisionChecker : public OpenRAVE::CollisionCheckerBase
             bActiveDOFs = !!(pchecker->GetCollisionOptions() & OpenRAVE::CO_ActiveDOFs);
         }
 
+        /// \brief clears the collision results so the callback can be reused for another query of the same body, keeps the cached active links.
+        void ResetResults(CollisionReportPtr report)
+        {
+            _bCollision = false;
+            _bOneCollision = false;
+            _report = report;
+            if( _bHasCallbacks && !_report ) {
+                _report.reset(new CollisionReport());
+            }
+            if( !!_report ) {
+                _report->Reset(_pchecker->GetCollisionOptions());
+            }
+        }
+
         const std::list<EnvironmentBase::CollisionCallbackFn>& GetCallbacks() {
             if( _bHasCallbacks &&( _listcallbacks.size() == 0) ) {
                 _pchecker->GetEnv()->GetRegisteredCollisionCallbacks(_listcallbacks);
@@ -216,6 +230,61 @@ public:
         return cb._bCollision;
     }
 
+    virtual int CheckCollisionBatch(KinBodyPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& vconfigs, std::vector<uint8_t>& vcollisions, int batchoptions, CollisionReportPtr report)
+    {
+        size_t dof, numconfigs;
+        _ValidateCollisionBatch(pbody, dofindices, vconfigs, dof, numconfigs);
+        if( (batchoptions & CBO_CheckEnv) && (_options & OpenRAVE::CO_Distance) ) {
+            RAVELOG_WARN("ode doesn't support CO_Distance\n");
+        }
+        vcollisions.resize(0);
+        vcollisions.reserve(numconfigs);
+        KinBody::KinBodyStateSaver saver(pbody);
+        bool bCheckEnv = (batchoptions & CBO_CheckEnv) && pbody->GetLinks().size() > 0 && pbody->IsEnabled() && !(_options & OpenRAVE::CO_Distance);
+
+        // only the attached bodies move during the batch, so the rest of the space is synchronized once
+        std::set<KinBodyPtr> setattached;
+        std::vector<dReal> vvalues(dof);
+        CollisionReportPtr reportcur = report;
+        COLLISIONCALLBACK cb(shared_checker(),report,pbody,KinBody::LinkConstPtr());
+        if( bCheckEnv ) {
+            pbody->GetAttached(setattached);
+#ifndef ODE_USE_MULTITHREAD
+            boost::mutex::scoped_lock lock(_mutexode);
+#endif
+            odespace->Synchronize();
+        }
+        for(size_t iconfig = 0; iconfig < numconfigs; ++iconfig) {
+            std::copy(vconfigs.begin()+iconfig*dof,vconfigs.begin()+(iconfig+1)*dof,vvalues.begin());
+            pbody->SetDOFValues(vvalues,KinBody::CLA_Nothing,dofindices);
+            bool bCollision = false;
+            if( bCheckEnv ) {
+                // self collision checks take the lock themselves, so only hold it for the environment query
+#ifndef ODE_USE_MULTITHREAD
+                boost::mutex::scoped_lock lock(_mutexode);
+#endif
+                FOREACHC(itbody,setattached) {
+                    odespace->Synchronize(KinBodyConstPtr(*itbody));
+                }
+                cb.ResetResults(reportcur);
+                dSpaceCollide(odespace->GetSpace(), &cb, KinBodyCollisionCallback);
+                bCollision = cb._bCollision;
+            }
+            if( !bCollision && (batchoptions & CBO_CheckSelf) ) {
+                bCollision = pbody->CheckSelfCollision(reportcur);
+            }
+            vcollisions.push_back(bCollision);
+            if( bCollision ) {
+                if( batchoptions & CBO_StopAtFirstCollision ) {
+                    break;
+                }
+                // only the first colliding configuration is reported
+                reportcur.reset();
+            }
+        }
+        return (int)vcollisions.size();
+    }
+
     virtual bool CheckCollision(KinBodyConstPtr pbody1, KinBodyConstPtr pbody2, CollisionReportPtr report)
     {
         COLLISIONCALLBACK cb(shared_checker(),report,pbody1,KinBody::LinkConstPtr());
@@ -656,6 +725,54 @@ public:
         return cb._bOneCollision;
     }
 
+    virtual int CheckCollisionRays(const std::vector<RAY>& vrays, KinBodyConstPtr pbody, std::vector<OpenRAVE::dReal>& vhitdistances, std::vector<Vector>& vhitnormals, std::vector<KinBody::LinkConstPtr>& vhitlinks)
+    {
+        vhitdistances.resize(vrays.size());
+        vhitnormals.resize(vrays.size());
+        vhitlinks.resize(0);
+        vhitlinks.resize(vrays.size());
+        if( !!pbody && (pbody->GetLinks().size() == 0 || !pbody->IsEnabled()) ) {
+            std::fill(vhitdistances.begin(),vhitdistances.end(),OpenRAVE::dReal(-1));
+            std::fill(vhitnormals.begin(),vhitnormals.end(),Vector());
+            return 0;
+        }
+
+#ifndef ODE_USE_MULTITHREAD
+        boost::mutex::scoped_lock lock(_mutexode);
+#endif
+        // the space only has to be synchronized once for the entire batch
+        odespace->Synchronize();
+        dGeomID space = !pbody ? (dGeomID)odespace->GetSpace() : (dGeomID)odespace->GetBodySpace(pbody);
+        RAYBATCHCALLBACK cb;
+        cb.bAnyHit = !!(_options&OpenRAVE::CO_RayAnyHit);
+        cb.geomray = geomray;
+        dGeomRaySetClosestHit(geomray, !cb.bAnyHit);
+        dGeomRaySetParams(geomray,0,0);
+        int numhits = 0;
+        for(size_t i = 0; i < vrays.size(); ++i) {
+            const RAY& ray = vrays[i];
+            vhitdistances[i] = -1;
+            vhitnormals[i] = Vector();
+            cb.fmaxdist = OpenRAVE::RaveSqrt(ray.dir.lengthsqr3());
+            if( cb.fmaxdist <= 0 ) {
+                continue;
+            }
+            Vector vnormdir = ray.dir*(1/cb.fmaxdist);
+            cb.fbestdist = cb.fmaxdist;
+            cb.plink.reset();
+            dGeomRaySet(geomray, ray.pos.x, ray.pos.y, ray.pos.z, vnormdir.x, vnormdir.y, vnormdir.z);
+            dGeomRaySetLength(geomray,cb.fmaxdist);
+            dSpaceCollide2(space, geomray, &cb, RayBatchCollisionCallback);
+            if( !!cb.plink ) {
+                vhitdistances[i] = cb.fbestdist;
+                vhitnormals[i] = cb.vnormal;
+                vhitlinks[i] = cb.plink;
+                ++numhits;
+            }
+        }
+        return numhits;
+    }
+
     virtual bool CheckSelfCollision(KinBodyConstPtr pbody, CollisionReportPtr report)
     {
         if( _options & OpenRAVE::CO_Distance ) {
@@ -1020,6 +1137,63 @@ private:
         }
     }
 
+    /// \brief state of one ray of CheckCollisionRays, does not support collision callbacks
+    struct RAYBATCHCALLBACK
+    {
+        RAYBATCHCALLBACK() : geomray(NULL), fmaxdist(0), fbestdist(0), bAnyHit(false) {
+        }
+        dGeomID geomray;
+        OpenRAVE::dReal fmaxdist, fbestdist;
+        KinBody::LinkPtr plink;
+        Vector vnormal;
+        bool bAnyHit;
+    };
+
+    static void RayBatchCollisionCallback (void *data, dGeomID o1, dGeomID o2)
+    {
+        RAYBATCHCALLBACK* pcb = (RAYBATCHCALLBACK*)data;
+        if( pcb->bAnyHit && !!pcb->plink ) {
+            return;
+        }
+        if( !dGeomIsEnabled(o1) || !dGeomIsEnabled(o2) ) {
+            return;
+        }
+        if (dGeomIsSpace(o1) || dGeomIsSpace(o2)) {
+            dSpaceCollide2(o1,o2,pcb,RayBatchCollisionCallback);
+            return;
+        }
+        if(( dGeomGetClass(o1) != dRayClass) &&( dGeomGetClass(o2) != dRayClass) ) {
+            return;
+        }
+        dBodyID b = dGeomGetBody(o1);
+        if( b == NULL ) {
+            b = dGeomGetBody(o2);
+        }
+        if( b == NULL || !dBodyGetData(b) ) {
+            return;
+        }
+        KinBody::LinkPtr plink = ((ODESpace::KinBodyInfo::LINK*)dBodyGetData(b))->GetLink();
+        if( !plink || !plink->IsEnabled() ) {
+            return;
+        }
+
+        dContact contact[2];
+        int N = dCollide (o1,o2,2,&contact[0].geom,sizeof(dContact));
+        for(int index = 0; index < N; ++index) {
+            if( contact[index].geom.depth > pcb->fbestdist || (!!pcb->plink && contact[index].geom.depth >= pcb->fbestdist) ) {
+                continue;
+            }
+            Vector vnorm(contact[index].geom.normal);
+            if( contact[index].geom.g1 != pcb->geomray ) {
+                vnorm = -vnorm;
+            }
+            plink->ValidateContactNormal(Vector(contact[index].geom.pos),vnorm);
+            pcb->fbestdist = contact[index].geom.depth;
+            pcb->vnormal = vnorm;
+            pcb->plink = plink;
+        }
+    }
+
     static void RayCollisionCallback (void *data, dGeomID o1, dGeomID o2)
     {
         COLLISIONCALLBACK* pcb = (COLLISIONCALLBACK*)data;
@@ -18,6 +18,8 @@
 #define  COLPQP_H
 
 #include "pqp/PQP.h"
+#include "pqp/MatVec.h"
+#include "dynamicaabbtree.h"
 
 //wrapper class for PQP, distance and tolerance checking is _off_ by default, collision checking is _on_ by default
 class CollisionCheckerPQP : public CollisionCheckerBase
@@ -26,26 +28,54 @@ public:
     class KinBodyInfo : public OpenRAVE::UserData
     {
 public:
-        KinBodyInfo() : nLastStamp(0) {
+        KinBodyInfo() : nLastStamp(0), bGeometryChanged(false) {
         }
         virtual ~KinBodyInfo() {
         }
         KinBodyPtr GetBody() const {
             return _pbody.lock();
         }
+        void _GeometryChangedCallback() {
+            bGeometryChanged = true;
+        }
         KinBodyWeakPtr _pbody;
-        vector<boost::shared_ptr<PQP_Model> > vlinks;
+        vector<boost::shared_ptr<PQP_Model> > vlinks; ///< never modified after being built, so can be shared by the clones of the body
+        vector<dReal> vlinkradius; ///< max distance of a collision vertex from the link origin
+        vector<AABB> vlinkaabbs; ///< bounding box of the collision mesh of each link in the link frame
         int nLastStamp;
+        bool bGeometryChanged; ///< the models are out of date and cannot be used or shared anymore
+        UserDataPtr _geometrycallback;
+        boost::shared_ptr< std::set<int> const > _psetNeverCollidingLinks; ///< link pairs (i|(j<<16)) skipped by self-collision, see SetNeverCollidingLinks
     };
     typedef boost::shared_ptr<KinBodyInfo> KinBodyInfoPtr;
     typedef boost::shared_ptr<KinBodyInfo const> KinBodyInfoConstPtr;
 
     CollisionCheckerPQP(EnvironmentBasePtr penv) : CollisionCheckerBase(penv)
     {
-        __description = ":Interface Authors: Dmitry Berenson, Rosen Diankov\n\nPQP collision checker, slow but allows distance queries to objects.";
+        __description = ":Interface Authors: Dmitry Berenson, Rosen Diankov\n\nPQP collision checker, slow but allows distance queries to objects.\n\n\
+Link/link checks (and therefore self-collision and grabbed body checks) remember the relative transform of every pair that was found free and do not check the pair again until its relative transform or geometry changes. This is disabled for distance and tolerance queries.\n\n\
+Collision checks of a body or link against the environment only run PQP on the link pairs whose bounding boxes overlap. The boxes of all bodies in the environment are kept in a dynamic AABB tree that is refit when the update stamp of a body changes. Distance and tolerance queries check all pairs.\n\n\
+Before running PQP on a link pair, the sphere trees of the two links (KinBody::Link::GetSphereTree) are checked and the pair is skipped if no leaf spheres overlap. This is disabled for distance and tolerance queries.";
+        RegisterCommand("SetNeverCollidingLinks",boost::bind(&CollisionCheckerPQP::SetNeverCollidingLinksCommand,this,_1,_2),
+                        "[bodyname] [numsamples]. Self-collision checks of all bodies with the kinematics/geometry hash of bodyname skip the link pairs that did not collide in any of numsamples (default 10000) random configurations. The pairs are cached per hash in the OpenRAVE home directory, and sampled again when more samples are requested than the cache was computed with. Returns the number of skipped pairs.");
+        RegisterCommand("GetNeverCollidingLinks",boost::bind(&CollisionCheckerPQP::GetNeverCollidingLinksCommand,this,_1,_2),
+                        "[bodyname]. Returns the link index pairs skipped by the self-collision checks of bodyname.");
+        RegisterCommand("ClearNeverCollidingLinks",boost::bind(&CollisionCheckerPQP::ClearNeverCollidingLinksCommand,this,_1,_2),
+                        "[bodyname]. Self-collision checks of bodies with the hash of bodyname check all non-adjacent link pairs again.");
+        RegisterCommand("SetBroadPhase",boost::bind(&CollisionCheckerPQP::SetBroadPhaseCommand,this,_1,_2),
+                        "[0|1]. Enables (default) or disables the bounding box tree for environment checks. When disabled, every link pair is checked.");
+        RegisterCommand("SetSphereTrees",boost::bind(&CollisionCheckerPQP::SetSphereTreesCommand,this,_1,_2),
+                        "[0|1]. Enables (default) or disables rejecting link pairs with the sphere trees of the links before running PQP.");
+        _options = 0;
         _rel_err = 200.0;     //temporary change
         _abs_err = 0.001;       //temporary change
         _tolerance = 0.0;
+        _fContinuousSeparation = 0.001;
+        _nContinuousMaxSteps = 1000;
+        _fRelativeTransformEpsilon = 1e-14;
+        _bBroadPhase = true;
+        _fBroadPhaseMargin = 0.01;
+        _bSphereTrees = true;
 
         //enable or disable various features
         _benablecol = true;
@@ -56,12 +86,14 @@ public:
     virtual bool InitEnvironment()
     {
         RAVELOG_DEBUG("creating pqp collision\n");
+        _ClearBroadPhase();
         vector<KinBodyPtr> vbodies;
         GetEnv()->GetBodies(vbodies);
         FOREACHC(itbody, vbodies) {
             if( !_InitKinBody(*itbody) ) {
                 RAVELOG_WARN("failed to init kinbody\n");
             }
+            _AddBroadPhaseBody(*itbody);
         }
         return true;
     }
@@ -74,45 +106,178 @@ public:
         FOREACHC(itbody, vbodies) {
             (*itbody)->RemoveUserData("pqpcollision");
         }
+        _ClearBroadPhase();
     }
 
     virtual bool InitKinBody(KinBodyPtr pbody)
     {
-        return _InitKinBody(pbody);
+        if( !_InitKinBody(pbody) ) {
+            return false;
+        }
+        _AddBroadPhaseBody(pbody);
+        return true;
     }
 
     virtual bool _InitKinBody(KinBodyConstPtr pbody)
     {
         KinBodyInfoPtr pinfo = boost::dynamic_pointer_cast<KinBodyInfo>(pbody->GetUserData("pqpcollision"));
         // need the pbody check since kinbodies can be cloned and could have the wrong pointer
-        if( !!pinfo && pinfo->GetBody() == pbody ) {
+        if( !!pinfo && pinfo->GetBody() == pbody && !pinfo->bGeometryChanged ) {
             return true;
         }
 
+        KinBodyInfoPtr pinfosource;
+        if( !!pinfo && pinfo->GetBody() != pbody && !pinfo->bGeometryChanged ) {
+            // a clone carries the info of the body it was cloned from, share its models if the geometry is still the same
+            pinfosource = pinfo;
+        }
         pinfo.reset(new KinBodyInfo());
 
         pinfo->_pbody = boost::const_pointer_cast<KinBody>(pbody);
         pbody->SetUserData("pqpcollision", pinfo);
+        pinfo->_geometrycallback = pbody->RegisterChangeCallback(KinBody::Prop_LinkGeometry, boost::bind(&KinBodyInfo::_GeometryChangedCallback,pinfo.get()));
+        if( _mapNeverCollidingLinks.size() > 0 ) {
+            std::map<std::string, boost::shared_ptr< std::set<int> const > >::const_iterator itnever = _mapNeverCollidingLinks.find(pbody->GetKinematicsGeometryHash());
+            if( itnever != _mapNeverCollidingLinks.end() ) {
+                pinfo->_psetNeverCollidingLinks = itnever->second;
+            }
+        }
+        if( !!pinfosource && _CanShareModels(pbody,pinfosource) ) {
+            pinfo->vlinks = pinfosource->vlinks;
+            pinfo->vlinkradius = pinfosource->vlinkradius;
+            pinfo->vlinkaabbs = pinfosource->vlinkaabbs;
+            return true;
+        }
 
-        PQP_REAL p1[3], p2[3], p3[3];
         pinfo->vlinks.reserve(pbody->GetLinks().size());
+        pinfo->vlinkradius.reserve(pbody->GetLinks().size());
+        pinfo->vlinkaabbs.reserve(pbody->GetLinks().size());
         FOREACHC(itlink, pbody->GetLinks()) {
             const TriMesh& trimesh = (*itlink)->GetCollisionData();
-            boost::shared_ptr<PQP_Model> pm;
-            if( trimesh.indices.size() > 0 ) {
+            dReal fradiussqr = 0;
+            FOREACHC(itv, trimesh.vertices) {
+                fradiussqr = max(fradiussqr, itv->lengthsqr3());
+            }
+            pinfo->vlinkradius.push_back(RaveSqrt(fradiussqr));
+            pinfo->vlinkaabbs.push_back(trimesh.ComputeAABB());
+            pinfo->vlinks.push_back(_GetTriMeshModel(trimesh));
+        }
+
+        return true;
+    }
+
+    /// \brief returns the model of a collision mesh, sharing it with every mesh of the process that has the same triangles.
+    ///
+    /// Models of large meshes are also saved in the OpenRAVE home directory, so other processes load the tree instead of building it.
+    static boost::shared_ptr<PQP_Model> _GetTriMeshModel(const TriMesh& trimesh)
+    {
+        boost::shared_ptr<PQP_Model> pm;
+        if( trimesh.indices.size() == 0 ) {
+            return pm;
+        }
+        std::vector<uint8_t> vdata((trimesh.indices.size()/3)*sizeof(PQP_REAL)*9);
+        PQP_REAL* ptri = (PQP_REAL*)&vdata[0];
+        for(int j = 0; j+2 < (int)trimesh.indices.size(); j+=3) {
+            for(int k = 0; k < 3; ++k) {
+                const Vector& v = trimesh.vertices.at(trimesh.indices[j+k]);
+                *ptri++ = v.x; *ptri++ = v.y; *ptri++ = v.z;
+            }
+        }
+        std::string hash = utils::GetMD5HashString(vdata);
+        ModelCache& cache = _GetModelCache();
+        {
+            boost::mutex::scoped_lock lock(cache._mutex);
+            std::map<std::string, boost::weak_ptr<PQP_Model> >::iterator it = cache._mapModels.find(hash);
+            if( it != cache._mapModels.end() ) {
+                pm = it->second.lock();
+                if( !!pm ) {
+                    return pm;
+                }
+            }
+        }
+
+        // build or load the model without holding the lock so that other meshes are not blocked by the file I/O and the tree construction
+        int numtris = (int)trimesh.indices.size()/3;
+        std::string filename = RaveGetHomeDirectory() + std::string("/pqpcollision.") + hash + std::string(".bvh");
+        if( numtris >= s_nMinSavedTriangles ) {
+            FILE* f = fopen(filename.c_str(), "rb");
+            if( !!f ) {
                 pm.reset(new PQP_Model());
-                pm->BeginModel(trimesh.indices.size()/3);
-                for(int j = 0; j < (int)trimesh.indices.size(); j+=3) {
-                    p1[0] = trimesh.vertices[trimesh.indices[j]].x;     p1[1] = trimesh.vertices[trimesh.indices[j]].y;     p1[2] = trimesh.vertices[trimesh.indices[j]].z;
-                    p2[0] = trimesh.vertices[trimesh.indices[j+1]].x;   p2[1] = trimesh.vertices[trimesh.indices[j+1]].y;     p2[2] = trimesh.vertices[trimesh.indices[j+1]].z;
-                    p3[0] = trimesh.vertices[trimesh.indices[j+2]].x;   p3[1] = trimesh.vertices[trimesh.indices[j+2]].y;     p3[2] = trimesh.vertices[trimesh.indices[j+2]].z;
-                    pm->AddTri(p1, p2, p3, j/3);
+                if( pm->LoadModel(f) != PQP_OK || pm->num_tris != numtris ) {
+                    RAVELOG_WARN(str(boost::format("failed to load %s, rebuilding\n")%filename));
+                    pm.reset();
+                }
+                fclose(f);
+            }
+        }
+        if( !pm ) {
+            pm.reset(new PQP_Model());
+            pm->BeginModel(numtris);
+            ptri = (PQP_REAL*)&vdata[0];
+            for(int j = 0; j < numtris; ++j, ptri += 9) {
+                pm->AddTri(ptri, ptri+3, ptri+6, j);
+            }
+            pm->EndModel();
+            if( numtris >= s_nMinSavedTriangles ) {
+                // write to a temporary file first so that other processes never read a partial file, the name is unique so that processes saving the same model do not write into each other's file
+                std::string tempfilename = str(boost::format("%s.%x.tmp")%filename%utils::GetNanoTime());
+                FILE* f = fopen(tempfilename.c_str(), "wb");
+                if( !!f ) {
+                    bool bsaved = pm->SaveModel(f) == PQP_OK;
+                    bsaved &= fclose(f) == 0;
+                    if( !bsaved || rename(tempfilename.c_str(), filename.c_str()) != 0 ) {
+                        RAVELOG_WARN(str(boost::format("failed to save %s\n")%filename));
+                        remove(tempfilename.c_str());
+                    }
+                }
+            }
+        }
+
+        boost::mutex::scoped_lock lock(cache._mutex);
+        std::map<std::string, boost::weak_ptr<PQP_Model> >::iterator it = cache._mapModels.find(hash);
+        if( it != cache._mapModels.end() ) {
+            // another thread built the same mesh meanwhile, use its model so that the meshes stay shared
+            boost::shared_ptr<PQP_Model> pmother = it->second.lock();
+            if( !!pmother ) {
+                return pmother;
+            }
+        }
+        cache._mapModels[hash] = pm;
+        if( cache._mapModels.size() > 2*cache._nLastSize ) {
+            // drop the models that are not used by any body anymore
+            for(it = cache._mapModels.begin(); it != cache._mapModels.end(); ) {
+                if( it->second.expired() ) {
+                    cache._mapModels.erase(it++);
+                }
+                else {
+                    ++it;
                 }
-                pm->EndModel();
             }
-            pinfo->vlinks.push_back(pm);
+            cache._nLastSize = max(cache._mapModels.size(), size_t(64));
         }
+        return pm;
+    }
 
+    /// \brief sanity check that the models of the source body were built from the same collision meshes
+    bool _CanShareModels(KinBodyConstPtr pbody, KinBodyInfoConstPtr pinfosource)
+    {
+        KinBodyPtr psourcebody = pinfosource->GetBody();
+        if( !psourcebody || psourcebody->GetLinks().size() != pbody->GetLinks().size() || pinfosource->vlinks.size() != pbody->GetLinks().size() ) {
+            return false;
+        }
+        for(size_t i = 0; i < pbody->GetLinks().size(); ++i) {
+            const TriMesh& trimesh = pbody->GetLinks()[i]->GetCollisionData(), &trimeshsource = psourcebody->GetLinks()[i]->GetCollisionData();
+            if( trimesh.vertices.size() != trimeshsource.vertices.size() || trimesh.indices != trimeshsource.indices ) {
+                return false;
+            }
+            // the models store the vertex positions, so a mesh that was only deformed cannot share them
+            for(size_t j = 0; j < trimesh.vertices.size(); ++j) {
+                const Vector& v = trimesh.vertices[j], &vsource = trimeshsource.vertices[j];
+                if( v.x != vsource.x || v.y != vsource.y || v.z != vsource.z ) {
+                    return false;
+                }
+            }
+        }
         return true;
     }
 
@@ -129,6 +294,11 @@ public:
     {
         if( !!pbody ) {
             pbody->RemoveUserData("pqpcollision");
+            std::map<KinBody const*, BroadPhaseBody>::iterator it = _mapBroadPhaseBodies.find(pbody.get());
+            if( it != _mapBroadPhaseBodies.end() ) {
+                _RemoveBroadPhaseProxies(it->second);
+                _mapBroadPhaseBodies.erase(it);
+            }
         }
     }
 
@@ -141,6 +311,16 @@ public:
         PQP_T[0] = Tfm1.trans.x;   PQP_T[1] = Tfm1.trans.y;   PQP_T[2] = Tfm1.trans.z;
     }
 
+    static TransformMatrix GetTransformMatrixFromPQP(const PQP_REAL PQP_R[3][3], const PQP_REAL PQP_T[3])
+    {
+        TransformMatrix t;
+        t.m[0] = PQP_R[0][0];   t.m[1] = PQP_R[0][1];   t.m[2] = PQP_R[0][2];
+        t.m[4] = PQP_R[1][0];   t.m[5] = PQP_R[1][1];   t.m[6] = PQP_R[1][2];
+        t.m[8] = PQP_R[2][0];   t.m[9] = PQP_R[2][1];   t.m[10] = PQP_R[2][2];
+        t.trans.x = PQP_T[0];   t.trans.y = PQP_T[1];   t.trans.z = PQP_T[2];
+        return t;
+    }
+
     virtual bool SetCollisionOptions(int options)
     {
         if(options & CO_Distance) {
@@ -158,6 +338,7 @@ public:
             _benabletol = false;
         }
         _options = options;
+        _mapLinkPairCache.clear();
         return true;
     }
     virtual int GetCollisionOptions() const {
@@ -209,10 +390,7 @@ public:
         _InitKinBody(plink1->GetParent());
         _InitKinBody(plink2->GetParent());
         _pactiverobot.reset();
-        PQP_REAL R1[3][3], R2[3][3], T1[3], T2[3];
-        GetPQPTransformFromTransform(plink1->GetTransform(),R1,T1);
-        GetPQPTransformFromTransform(plink2->GetTransform(),R2,T2);
-        return DoPQP(plink1,R1,T1,plink2,R2,T2,report);
+        return _CheckLinkPair(plink1,GetLinkModel(plink1),plink2,GetLinkModel(plink2),report);
     }
 
     virtual bool CheckCollision(KinBody::LinkConstPtr plink, KinBodyConstPtr pbody, CollisionReportPtr report)
@@ -245,15 +423,18 @@ public:
         bool retval;
 
         _InitKinBody(plink->GetParent());
+        if( _IsBroadPhaseUsable() ) {
+            return _CheckCollisionBroadPhase(plink->GetParent(), plink, vbodyexcluded, vlinkexcluded, report);
+        }
 
-        std::vector<KinBodyPtr> vecbodies;
-        GetEnv()->GetBodies(vecbodies);
+        boost::shared_ptr<std::vector<KinBodyPtr> const> pvecbodies = GetEnv()->GetBodiesSnapshot();
+        const std::vector<KinBodyPtr>& vecbodies = *pvecbodies;
 
         PQP_REAL R1[3][3], R2[3][3], T1[3], T2[3];
 
         std::vector<Transform> vtrans1,vtrans2;
         plink->GetParent()->GetLinkTransformations(vtrans1);
-        FOREACH(itbody,vecbodies) {
+        FOREACHC(itbody,vecbodies) {
             if(!!report) {
                 report->numWithinTol = 0;
                 report->numCols = 0;
@@ -332,15 +513,344 @@ public:
             report->Reset(_options);
         }
         _pactiverobot.reset();
-        throw openrave_exception("PQP collision checker does not support ray collision queries\n");
+        std::vector<RayLink> vraylinks;
+        if( plink->IsEnabled() ) {
+            _InitKinBody(plink->GetParent());
+            KinBodyInfoPtr pinfo = boost::dynamic_pointer_cast<KinBodyInfo>(plink->GetParent()->GetUserData("pqpcollision"));
+            if( !!pinfo->vlinks.at(plink->GetIndex()) ) {
+                vraylinks.push_back(RayLink(plink, pinfo->vlinks[plink->GetIndex()], pinfo->vlinkradius[plink->GetIndex()]));
+            }
+        }
+        return _CheckRayCollision(ray, vraylinks, report);
+    }
+
+    virtual int CheckCollisionBatch(KinBodyPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& vconfigs, std::vector<uint8_t>& vcollisions, int batchoptions, CollisionReportPtr report)
+    {
+        size_t dof, numconfigs;
+        _ValidateCollisionBatch(pbody, dofindices, vconfigs, dof, numconfigs);
+        vcollisions.resize(0);
+        vcollisions.reserve(numconfigs);
+        KinBody::KinBodyStateSaver saver(pbody);
+        _SetActiveBody(pbody);
+        RobotBaseConstPtr pactiverobot = _pactiverobot;
+
+        // the bodies not attached to pbody do not move during the batch, so gather their models and transforms once
+        std::set<KinBodyPtr> setattached;
+        pbody->GetAttached(setattached);
+        std::vector<KinBodyConstPtr> vattached(setattached.begin(),setattached.end());
+        std::vector<StaticBody> vstaticbodies;
+        if( batchoptions & CBO_CheckEnv ) {
+            boost::shared_ptr<std::vector<KinBodyPtr> const> pvecbodies = GetEnv()->GetBodiesSnapshot();
+            const std::vector<KinBodyPtr>& vecbodies = *pvecbodies;
+            std::vector<Transform> vtrans;
+            FOREACHC(itbody,vecbodies) {
+                if( *itbody == pbody || pbody->IsAttached(*itbody) ) {
+                    continue;
+                }
+                _InitKinBody(*itbody);
+                (*itbody)->GetLinkTransformations(vtrans);
+                vstaticbodies.push_back(StaticBody());
+                StaticBody& staticbody = vstaticbodies.back();
+                FOREACHC(itlink,(*itbody)->GetLinks()) {
+                    if( (*itlink)->IsEnabled() ) {
+                        staticbody.vlinks.push_back(StaticLink());
+                        staticbody.vlinks.back().plink = *itlink;
+                        GetPQPTransformFromTransform(vtrans.at((*itlink)->GetIndex()),staticbody.vlinks.back().R,staticbody.vlinks.back().T);
+                    }
+                }
+                if( staticbody.vlinks.size() == 0 ) {
+                    vstaticbodies.pop_back();
+                }
+            }
+            FOREACH(itbody,vattached) {
+                _InitKinBody(*itbody);
+            }
+        }
+
+        std::vector<dReal> vvalues(dof);
+        std::vector<Transform> vtrans1;
+        PQP_REAL R1[3][3], T1[3];
+        CollisionReportPtr reportcur = report;
+        for(size_t iconfig = 0; iconfig < numconfigs; ++iconfig) {
+            std::copy(vconfigs.begin()+iconfig*dof,vconfigs.begin()+(iconfig+1)*dof,vvalues.begin());
+            pbody->SetDOFValues(vvalues,KinBody::CLA_Nothing,dofindices);
+            bool bCollision = false;
+            if( batchoptions & CBO_CheckEnv ) {
+                if( !!reportcur ) {
+                    reportcur->Reset(_options);
+                }
+                int numcols = 0, numwithintol = 0;
+                FOREACHC(itbody1,vattached) {
+                    (*itbody1)->GetLinkTransformations(vtrans1);
+                    const std::vector<KinBody::LinkPtr>& veclinks1 = (*itbody1)->GetLinks();
+                    FOREACHC(itstatic,vstaticbodies) {
+                        if( !!reportcur ) {
+                            reportcur->numWithinTol = 0;
+                            reportcur->numCols = 0;
+                        }
+                        for(size_t i = 0; i < vtrans1.size() && !bCollision; ++i) {
+                            if( !veclinks1[i]->IsEnabled() ) {
+                                continue;
+                            }
+                            GetPQPTransformFromTransform(vtrans1[i],R1,T1);
+                            FOREACH(itlink2,itstatic->vlinks) {
+                                bool retval = DoPQP(veclinks1[i],R1,T1,itlink2->plink,itlink2->R,itlink2->T,reportcur);
+                                if( !reportcur && retval && ((_benablecol && !_benabledis && !_benabletol) || (!_benablecol && !_benabledis && _benabletol)) ) {
+                                    bCollision = true;
+                                    break;
+                                }
+                            }
+                        }
+                        if( !!reportcur ) {
+                            if( reportcur->numWithinTol > 0 ) {
+                                numwithintol++;
+                            }
+                            if( reportcur->numCols > 0 ) {
+                                numcols++;
+                            }
+                        }
+                        if( bCollision ) {
+                            break;
+                        }
+                    }
+                    if( bCollision ) {
+                        break;
+                    }
+                }
+                if( !!reportcur ) {
+                    reportcur->numWithinTol = numwithintol;
+                    reportcur->numCols = numcols;
+                    bCollision = numcols > 0;
+                }
+            }
+            if( !bCollision && (batchoptions & CBO_CheckSelf) ) {
+                bCollision = pbody->CheckSelfCollision(reportcur);
+                // link/link checks reset the active robot, restore it without invalidating the cached active links
+                _pactiverobot = pactiverobot;
+            }
+            vcollisions.push_back(bCollision);
+            if( bCollision ) {
+                if( batchoptions & CBO_StopAtFirstCollision ) {
+                    break;
+                }
+                // only the first colliding configuration is reported
+                reportcur.reset();
+            }
+        }
+        return (int)vcollisions.size();
+    }
+
+    /// \brief conservative advancement: every link pair is certified free up to the time its lower bound distance can be
+    /// closed by the pair's relative motion bound, and the motion only stops at the earliest certified time to recompute the expired pairs.
+    virtual bool CheckContinuousCollision(KinBodyPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& q0, const std::vector<dReal>& q1, CollisionReportPtr report)
+    {
+        if(!!report ) {
+            report->Reset(_options);
+        }
+        size_t dof = dofindices.size() > 0 ? dofindices.size() : (size_t)pbody->GetDOF();
+        if( q0.size() != dof || q1.size() != dof ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("configurations need %d values", dof, ORE_InvalidArguments);
+        }
+        std::set<KinBodyPtr> setattached;
+        pbody->GetAttached(setattached);
+        if( setattached.size() > 1 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("body %s has attached bodies, continuous checking is not supported", pbody->GetName(), ORE_NotImplemented);
+        }
+
+        KinBody::KinBodyStateSaver saver(pbody);
+        pbody->SetDOFValues(q0,KinBody::CLA_Nothing,dofindices);
+        _pactiverobot.reset();
+        _InitKinBody(pbody);
+        KinBodyInfoPtr pinfo = boost::dynamic_pointer_cast<KinBodyInfo>(pbody->GetUserData("pqpcollision"));
+        std::vector<dReal> vdofdelta(pbody->GetDOF(),0);
+        for(size_t i = 0; i < dof; ++i) {
+            vdofdelta.at(dofindices.size() > 0 ? dofindices[i] : (int)i) = RaveFabs(q1[i]-q0[i]);
+        }
+        std::vector<dReal> vlinkbounds(pbody->GetLinks().size());
+        for(size_t i = 0; i < vlinkbounds.size(); ++i) {
+            vlinkbounds[i] = _ComputeChainMotionBound(pbody,pinfo,vdofdelta,0,i);
+        }
+
+        // pairs that do not move relative to each other are only checked at the start
+        if( CheckCollision(KinBodyConstPtr(pbody),report) || CheckSelfCollision(pbody,report) ) {
+            return true;
+        }
+
+        std::vector<LinkPair> vpairs;
+        boost::shared_ptr<std::vector<KinBodyPtr> const> pvecbodies = GetEnv()->GetBodiesSnapshot();
+        const std::vector<KinBodyPtr>& vecbodies = *pvecbodies;
+        FOREACHC(itlink1, pbody->GetLinks()) {
+            if( vlinkbounds.at((*itlink1)->GetIndex()) <= 0 || !(*itlink1)->IsEnabled() || !GetLinkModel(*itlink1) ) {
+                continue;
+            }
+            FOREACHC(itbody, vecbodies) {
+                if( *itbody == pbody ) {
+                    continue;
+                }
+                _InitKinBody(*itbody);
+                KinBodyInfoPtr pinfo2 = boost::dynamic_pointer_cast<KinBodyInfo>((*itbody)->GetUserData("pqpcollision"));
+                FOREACHC(itlink2, (*itbody)->GetLinks()) {
+                    if( (*itlink2)->IsEnabled() && !!GetLinkModel(*itlink2) ) {
+                        vpairs.push_back(LinkPair(*itlink1, *itlink2, vlinkbounds[(*itlink1)->GetIndex()], pinfo->vlinkradius.at((*itlink1)->GetIndex())+pinfo2->vlinkradius.at((*itlink2)->GetIndex())));
+                    }
+                }
+            }
+        }
+        FOREACHC(itset, pbody->GetNonAdjacentLinks(KinBody::AO_Enabled)) {
+            KinBody::LinkPtr plink1 = pbody->GetLinks().at(*itset&0xffff), plink2 = pbody->GetLinks().at(*itset>>16);
+            if( !GetLinkModel(plink1) || !GetLinkModel(plink2) ) {
+                continue;
+            }
+            // only the joints between the two links change their relative transform
+            dReal fbound = _ComputeChainMotionBound(pbody,pinfo,vdofdelta,plink1->GetIndex(),plink2->GetIndex());
+            if( fbound > 0 ) {
+                vpairs.push_back(LinkPair(plink1, plink2, fbound, pinfo->vlinkradius.at(plink1->GetIndex())+pinfo->vlinkradius.at(plink2->GetIndex())));
+            }
+        }
+
+        // the distance is only computed within a relative error, so the returned distance divided by (1+frelerr) is a lower bound
+        const PQP_REAL frelerr = 0.25;
+        PQP_DistanceResult disresult;
+        PQP_REAL R1[3][3], R2[3][3], T1[3], T2[3];
+        std::vector<dReal> q(dof);
+        dReal t = 0;
+        for(int istep = 0;; ++istep) {
+            // grazing motions advance by tiny steps, let the caller discretize them instead
+            if( istep >= _nContinuousMaxSteps ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("continuous check of body %s did not finish in %d steps, stopped at t=%f", pbody->GetName()%_nContinuousMaxSteps%t, ORE_Timeout);
+            }
+            dReal tnext = 2;
+            FOREACH(itpair, vpairs) {
+                // pairs that used up more than half of their interval are recomputed along with the expired one, otherwise
+                // pairs expiring at different times make the motion stop once for every pair
+                if( itpair->fcertified > t && 2*t < itpair->fchecked + itpair->fcertified ) {
+                    tnext = min(tnext, itpair->fcertified);
+                    continue;
+                }
+                Transform t1 = itpair->plink1->GetTransform(), t2 = itpair->plink2->GetTransform();
+                // bounding spheres around the link origins are usually enough for far away pairs
+                dReal fdist = RaveSqrt((t1.trans-t2.trans).lengthsqr3()) - itpair->fradius;
+                if( t + (fdist-_fContinuousSeparation)/itpair->fbound < 1 ) {
+                    GetPQPTransformFromTransform(t1,R1,T1);
+                    GetPQPTransformFromTransform(t2,R2,T2);
+                    PQP_Distance(&disresult,R1,T1,GetLinkModel(itpair->plink1).get(),R2,T2,GetLinkModel(itpair->plink2).get(),frelerr,1e10);
+                    fdist = max(fdist, dReal(disresult.Distance()/(1+frelerr)));
+                }
+                if( fdist <= _fContinuousSeparation ) {
+                    if( !!report ) {
+                        report->plink1 = itpair->plink1;
+                        report->plink2 = itpair->plink2;
+                        report->minDistance = fdist;
+                        report->numCols = 1;
+                    }
+                    RAVELOG_VERBOSE(str(boost::format("continuous collision at t=%f, links %s:%s %s:%s\n")%t%itpair->plink1->GetParent()->GetName()%itpair->plink1->GetName()%itpair->plink2->GetParent()->GetName()%itpair->plink2->GetName()));
+                    return true;
+                }
+                // certify up to half the separation so that every recomputed pair advances by a finite step
+                itpair->fchecked = t;
+                itpair->fcertified = t + (fdist-dReal(0.5)*_fContinuousSeparation)/itpair->fbound;
+                tnext = min(tnext, itpair->fcertified);
+            }
+            if( tnext >= 1 ) {
+                break;
+            }
+            t = tnext;
+            for(size_t i = 0; i < dof; ++i) {
+                q[i] = q0[i] + t*(q1[i]-q0[i]);
+            }
+            pbody->SetDOFValues(q,KinBody::CLA_Nothing,dofindices);
+        }
+        return false;
+    }
+
+    virtual UserDataPtr CreateQueryContext(KinBodyConstPtr pbody, int queryoptions)
+    {
+        std::set<KinBodyPtr> setattached;
+        pbody->GetAttached(setattached);
+        if( setattached.size() > 1 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("body %s has attached bodies, concurrent queries are not supported", pbody->GetName(), ORE_NotImplemented);
+        }
+        _InitKinBody(pbody);
+        KinBodyInfoPtr pinfo = boost::dynamic_pointer_cast<KinBodyInfo>(pbody->GetUserData("pqpcollision"));
+        boost::shared_ptr<QueryContext> context(new QueryContext());
+        context->pbody = pbody;
+        context->queryoptions = queryoptions;
+        std::vector<int> vlinkcontextindices(pbody->GetLinks().size(),-1);
+        FOREACHC(itlink, pbody->GetLinks()) {
+            if( (*itlink)->IsEnabled() && !!pinfo->vlinks.at((*itlink)->GetIndex()) ) {
+                vlinkcontextindices[(*itlink)->GetIndex()] = (int)context->vlinks.size();
+                context->vlinks.push_back(ContextLink(*itlink, pinfo->vlinks[(*itlink)->GetIndex()], pinfo->vlinkradius[(*itlink)->GetIndex()]));
+            }
+        }
+        if( queryoptions & CBO_CheckEnv ) {
+            boost::shared_ptr<std::vector<KinBodyPtr> const> pvecbodies = GetEnv()->GetBodiesSnapshot();
+            const std::vector<KinBodyPtr>& vecbodies = *pvecbodies;
+            FOREACHC(itbody, vecbodies) {
+                if( *itbody == pbody ) {
+                    continue;
+                }
+                _InitKinBody(*itbody);
+                KinBodyInfoPtr pinfo2 = boost::dynamic_pointer_cast<KinBodyInfo>((*itbody)->GetUserData("pqpcollision"));
+                FOREACHC(itlink, (*itbody)->GetLinks()) {
+                    if( (*itlink)->IsEnabled() && !!pinfo2->vlinks.at((*itlink)->GetIndex()) ) {
+                        context->vstaticlinks.push_back(ContextLink(*itlink, pinfo2->vlinks[(*itlink)->GetIndex()], pinfo2->vlinkradius[(*itlink)->GetIndex()]));
+                        GetPQPTransformFromTransform((*itlink)->GetTransform(),context->vstaticlinks.back().R,context->vstaticlinks.back().T);
+                    }
+                }
+            }
+        }
+        if( queryoptions & CBO_CheckSelf ) {
+            FOREACHC(itset, pbody->GetNonAdjacentLinks(KinBody::AO_Enabled)) {
+                if( !!pinfo->_psetNeverCollidingLinks && pinfo->_psetNeverCollidingLinks->find(*itset) != pinfo->_psetNeverCollidingLinks->end() ) {
+                    continue;
+                }
+                int index1 = vlinkcontextindices.at(*itset&0xffff), index2 = vlinkcontextindices.at(*itset>>16);
+                if( index1 >= 0 && index2 >= 0 ) {
+                    context->vselfpairs.push_back(make_pair(index1,index2));
+                }
+            }
+        }
+        return context;
+    }
+
+    virtual bool CheckCollisionInContext(UserDataPtr pcontext, const std::vector<Transform>& vlinktransforms, CollisionReportPtr report)
+    {
+        boost::shared_ptr<QueryContext> context = boost::dynamic_pointer_cast<QueryContext>(pcontext);
+        if( !context ) {
+            throw OPENRAVE_EXCEPTION_FORMAT0("context was not created by the pqp collision checker", ORE_InvalidArguments);
+        }
+        if( vlinktransforms.size() != context->pbody->GetLinks().size() ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("need %d link transforms", context->pbody->GetLinks().size(), ORE_InvalidArguments);
+        }
+        if(!!report ) {
+            report->Reset(_options);
+        }
+        FOREACH(itlink, context->vlinks) {
+            GetPQPTransformFromTransform(vlinktransforms[itlink->plink->GetIndex()],itlink->R,itlink->T);
+        }
+        FOREACH(itlink, context->vlinks) {
+            FOREACH(itstatic, context->vstaticlinks) {
+                if( _CollideContextLinks(*context, *itlink, *itstatic, report) ) {
+                    return true;
+                }
+            }
+        }
+        FOREACHC(itpair, context->vselfpairs) {
+            if( _CollideContextLinks(*context, context->vlinks[itpair->first], context->vlinks[itpair->second], report) ) {
+                return true;
+            }
+        }
+        return false;
     }
     virtual bool CheckCollision(const RAY& ray, KinBodyConstPtr pbody, CollisionReportPtr report = CollisionReportPtr())
     {
         if(!!report ) {
             report->Reset(_options);
         }
-        _SetActiveBody(pbody);
-        throw openrave_exception("PQP collision checker does not support ray collision queries\n");
+        _pactiverobot.reset();
+        std::vector<RayLink> vraylinks;
+        _GetRayLinks(pbody, vraylinks, true);
+        return _CheckRayCollision(ray, vraylinks, report);
     }
     virtual bool CheckCollision(const RAY& ray, CollisionReportPtr report = CollisionReportPtr())
     {
@@ -348,8 +858,42 @@ public:
             report->Reset(_options);
         }
         _pactiverobot.reset();
-        throw openrave_exception("PQP collision checker does not support ray collision queries\n");
+        std::vector<RayLink> vraylinks;
+        _GetRayLinks(KinBodyConstPtr(), vraylinks, true);
+        return _CheckRayCollision(ray, vraylinks, report);
     }
+
+    virtual int CheckCollisionRays(const std::vector<RAY>& vrays, KinBodyConstPtr pbody, std::vector<dReal>& vhitdistances, std::vector<Vector>& vhitnormals, std::vector<KinBody::LinkConstPtr>& vhitlinks)
+    {
+        // only reads the checker state so that several threads can cast at once, see IsRayBatchConcurrent
+        // nothing moves during the batch, so gather the links and their transforms once
+        std::vector<RayLink> vraylinks;
+        _GetRayLinks(pbody, vraylinks, false);
+        vhitdistances.resize(vrays.size());
+        vhitnormals.resize(vrays.size());
+        vhitlinks.resize(0);
+        vhitlinks.resize(vrays.size());
+        int numhits = 0;
+        std::vector<RayStackEntry> vraystack;
+        for(size_t i = 0; i < vrays.size(); ++i) {
+            int ilink = _CastRay(vrays[i], vraylinks, vhitdistances[i], vhitnormals[i], vraystack);
+            if( ilink >= 0 ) {
+                vhitlinks[i] = vraylinks[ilink].plink;
+                ++numhits;
+            }
+            else {
+                vhitdistances[i] = -1;
+                vhitnormals[i] = Vector();
+            }
+        }
+        return numhits;
+    }
+    /// CheckCollisionRays does not initialize bodies, it skips the ones without models. The bodies are initialized when they are added to the environment, so only bodies added while another checker was set are missed.
+    virtual bool IsRayBatchConcurrent() const
+    {
+        return true;
+    }
+
     virtual bool CheckSelfCollision(KinBodyConstPtr pbody, CollisionReportPtr report)
     {
         if( pbody->GetLinks().size() <= 1 ) {
@@ -364,8 +908,19 @@ public:
             adjacentoptions |= KinBody::AO_ActiveDOFs;
         }
         const std::set<int>& nonadjacent = pbody->GetNonAdjacentLinks(adjacentoptions);
+        KinBodyInfoPtr pinfo = boost::dynamic_pointer_cast<KinBodyInfo>(pbody->GetUserData("pqpcollision"));
+        const std::set<int>* psetnevercolliding = !!pinfo->_psetNeverCollidingLinks ? pinfo->_psetNeverCollidingLinks.get() : NULL;
+        _pactiverobot.reset();
+        const std::vector<KinBody::LinkPtr>& vlinks = pbody->GetLinks();
         FOREACHC(itset, nonadjacent) {
-            if( CheckCollision(KinBody::LinkConstPtr(pbody->GetLinks().at(*itset&0xffff)), KinBody::LinkConstPtr(pbody->GetLinks().at(*itset>>16)), report) ) {
+            if( !!psetnevercolliding && psetnevercolliding->find(*itset) != psetnevercolliding->end() ) {
+                continue;
+            }
+            if(!!report) {
+                report->Reset(_options);
+            }
+            int linkindex1 = *itset&0xffff, linkindex2 = *itset>>16;
+            if( _CheckLinkPair(vlinks[linkindex1], pinfo->vlinks.at(linkindex1), vlinks[linkindex2], pinfo->vlinks.at(linkindex2), report) ) {
                 RAVELOG_VERBOSE(str(boost::format("selfcol %s, Links %s %s are colliding\n")%pbody->GetName()%pbody->GetLinks().at(*itset&0xffff)->GetName()%pbody->GetLinks().at(*itset>>16)->GetName()));
                 return true;
             }
@@ -383,18 +938,464 @@ public:
 
     void SetTolerance(dReal tol){
         _benabletol = true; _tolerance = tol;
+        _mapLinkPairCache.clear();
+    }
+
+    bool SetNeverCollidingLinksCommand(std::ostream& sout, std::istream& sinput)
+    {
+        std::string bodyname;
+        int numsamples = 10000;
+        sinput >> bodyname;
+        if( !(sinput >> numsamples) || numsamples <= 0 ) {
+            numsamples = 10000;
+        }
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        KinBodyPtr pbody = GetEnv()->GetKinBody(bodyname);
+        if( !pbody ) {
+            RAVELOG_WARN(str(boost::format("failed to find body %s\n")%bodyname));
+            return false;
+        }
+        const std::string& hash = pbody->GetKinematicsGeometryHash();
+        boost::shared_ptr< std::set<int> > psetnevercolliding(new std::set<int>());
+        std::string filename = RaveGetHomeDirectory() + std::string("/pqpcollision.") + hash + std::string(".nevercolliding");
+        // a cache sampled with at least as many configurations is at least as conservative
+        std::ifstream f(filename.c_str());
+        std::string header;
+        int numfilesamples = 0;
+        if( !!f && (f >> header >> numfilesamples) && header == "nevercolliding" && numfilesamples >= numsamples ) {
+            int linkindex1, linkindex2;
+            while( f >> linkindex1 >> linkindex2 ) {
+                psetnevercolliding->insert(linkindex1|(linkindex2<<16));
+            }
+        }
+        else {
+            f.close();
+            _ComputeNeverCollidingLinks(pbody, numsamples, *psetnevercolliding);
+            // other processes must never read a partial file, see _GetTriMeshModel
+            std::string tempfilename = str(boost::format("%s.%x.tmp")%filename%utils::GetNanoTime());
+            bool bsaved;
+            {
+                std::ofstream fout(tempfilename.c_str());
+                fout << "nevercolliding " << numsamples << std::endl;
+                FOREACHC(it, *psetnevercolliding) {
+                    fout << (*it&0xffff) << " " << (*it>>16) << std::endl;
+                }
+                fout.close();
+                bsaved = !!fout;
+            }
+            if( !bsaved || rename(tempfilename.c_str(), filename.c_str()) != 0 ) {
+                RAVELOG_WARN(str(boost::format("failed to save %s\n")%filename));
+                remove(tempfilename.c_str());
+            }
+        }
+        _mapNeverCollidingLinks[hash] = psetnevercolliding;
+        _UpdateNeverCollidingLinks(hash);
+        sout << psetnevercolliding->size();
+        return true;
+    }
+
+    bool GetNeverCollidingLinksCommand(std::ostream& sout, std::istream& sinput)
+    {
+        std::string bodyname;
+        sinput >> bodyname;
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        KinBodyPtr pbody = GetEnv()->GetKinBody(bodyname);
+        if( !pbody ) {
+            RAVELOG_WARN(str(boost::format("failed to find body %s\n")%bodyname));
+            return false;
+        }
+        std::map<std::string, boost::shared_ptr< std::set<int> const > >::const_iterator itnever = _mapNeverCollidingLinks.find(pbody->GetKinematicsGeometryHash());
+        if( itnever != _mapNeverCollidingLinks.end() ) {
+            FOREACHC(it, *itnever->second) {
+                sout << (*it&0xffff) << " " << (*it>>16) << " ";
+            }
+        }
+        return true;
+    }
+
+    bool SetBroadPhaseCommand(std::ostream& sout, std::istream& sinput)
+    {
+        bool bBroadPhase = true;
+        if( !(sinput >> bBroadPhase) ) {
+            return false;
+        }
+        _bBroadPhase = bBroadPhase;
+        return true;
+    }
+
+    bool SetSphereTreesCommand(std::ostream& sout, std::istream& sinput)
+    {
+        bool bSphereTrees = true;
+        if( !(sinput >> bSphereTrees) ) {
+            return false;
+        }
+        _bSphereTrees = bSphereTrees;
+        return true;
+    }
+
+    bool ClearNeverCollidingLinksCommand(std::ostream& sout, std::istream& sinput)
+    {
+        std::string bodyname;
+        sinput >> bodyname;
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        KinBodyPtr pbody = GetEnv()->GetKinBody(bodyname);
+        if( !pbody ) {
+            RAVELOG_WARN(str(boost::format("failed to find body %s\n")%bodyname));
+            return false;
+        }
+        _mapNeverCollidingLinks.erase(pbody->GetKinematicsGeometryHash());
+        _UpdateNeverCollidingLinks(pbody->GetKinematicsGeometryHash());
+        return true;
     }
 
 private:
+    /// \brief the last relative transform at which a link pair was found free
+    struct LinkPairCache
+    {
+        boost::weak_ptr<KinBody::Link const> _plink1, _plink2; ///< the raw pointers the cache is indexed by could be reused by new links
+        boost::shared_ptr<PQP_Model> _m1, _m2; ///< models of the links when the pair was checked
+        Transform _trelative; ///< transform of the second link in the first link's frame
+    };
+
+    /// \brief checks two links with their models, a pair that was found free before is not checked again until its relative transform changes
+    bool _CheckLinkPair(const KinBody::LinkConstPtr& plink1, const boost::shared_ptr<PQP_Model>& m1, const KinBody::LinkConstPtr& plink2, const boost::shared_ptr<PQP_Model>& m2, CollisionReportPtr report)
+    {
+        if( plink2.get() < plink1.get() ) {
+            // the cache stores every pair once
+            return _CheckLinkPair(plink2,m2,plink1,m1,report);
+        }
+        Transform t1 = plink1->GetTransform(), t2 = plink2->GetTransform();
+        LinkPairCache* pcache = NULL;
+        Transform trelative;
+        // collision callbacks can ignore a collision, which must not be remembered as a free pair
+        if( !_benabledis && !_benabletol && !GetEnv()->HasRegisteredCollisionCallbacks() ) {
+            pcache = &_mapLinkPairCache[std::make_pair(plink1.get(),plink2.get())];
+            trelative = t1.inverse()*t2;
+            // the links are still alive, so they are the ones at the addresses of the key
+            if( pcache->_m1 == m1 && pcache->_m2 == m2 && !pcache->_plink1.expired() && !pcache->_plink2.expired() ) {
+                if( (pcache->_trelative.rot-trelative.rot).lengthsqr4() <= _fRelativeTransformEpsilon && (pcache->_trelative.trans-trelative.trans).lengthsqr3() <= _fRelativeTransformEpsilon ) {
+                    return false;
+                }
+            }
+            else {
+                pcache->_plink1 = plink1;
+                pcache->_plink2 = plink2;
+                pcache->_m1 = m1;
+                pcache->_m2 = m2;
+            }
+        }
+        PQP_REAL R1[3][3], R2[3][3], T1[3], T2[3];
+        GetPQPTransformFromTransform(t1,R1,T1);
+        GetPQPTransformFromTransform(t2,R2,T2);
+        bool bcollision = DoPQP(plink1,m1,R1,T1,plink2,m2,R2,T2,report);
+        if( !!pcache ) {
+            if( !bcollision && plink1->IsEnabled() && plink2->IsEnabled() ) {
+                pcache->_trelative = trelative;
+            }
+            else {
+                // never matches
+                pcache->_trelative.trans.x = std::numeric_limits<dReal>::infinity();
+            }
+            if( _mapLinkPairCache.size() > s_nMaxLinkPairCacheSize ) {
+                _mapLinkPairCache.clear();
+            }
+        }
+        return bcollision;
+    }
+
+    /// \brief samples random configurations of the body and returns all the non-adjacent link pairs that never collided
+    void _ComputeNeverCollidingLinks(KinBodyPtr pbody, int numsamples, std::set<int>& setnevercolliding)
+    {
+        RAVELOG_INFO(str(boost::format("sampling %d configurations of %s for never colliding link pairs\n")%numsamples%pbody->GetName()));
+        KinBody::KinBodyStateSaver saver(pbody);
+        _InitKinBody(pbody);
+        _pactiverobot.reset();
+        std::vector<int> vpairs(pbody->GetNonAdjacentLinks(0).begin(), pbody->GetNonAdjacentLinks(0).end());
+        std::vector<uint8_t> vcollided(vpairs.size(),0);
+        std::vector<dReal> vlower, vupper, vvalues(pbody->GetDOF());
+        pbody->GetDOFLimits(vlower,vupper);
+        for(int isample = 0; isample < numsamples; ++isample) {
+            for(size_t i = 0; i < vvalues.size(); ++i) {
+                vvalues[i] = vlower[i] + (vupper[i]-vlower[i])*RaveRandomFloat();
+            }
+            pbody->SetDOFValues(vvalues,KinBody::CLA_Nothing);
+            for(size_t ipair = 0; ipair < vpairs.size(); ++ipair) {
+                if( vcollided[ipair] ) {
+                    continue;
+                }
+                KinBody::LinkConstPtr plink1 = pbody->GetLinks().at(vpairs[ipair]&0xffff), plink2 = pbody->GetLinks().at(vpairs[ipair]>>16);
+                boost::shared_ptr<PQP_Model> m1 = GetLinkModel(plink1), m2 = GetLinkModel(plink2);
+                if( !m1 || !m2 ) {
+                    continue;
+                }
+                PQP_REAL R1[3][3], R2[3][3], T1[3], T2[3];
+                GetPQPTransformFromTransform(plink1->GetTransform(),R1,T1);
+                GetPQPTransformFromTransform(plink2->GetTransform(),R2,T2);
+                PQP_CollideResult colres;
+                PQP_Collide(&colres,R1,T1,m1.get(),R2,T2,m2.get(),PQP_FIRST_CONTACT);
+                if( colres.Colliding() ) {
+                    vcollided[ipair] = 1;
+                }
+            }
+        }
+        setnevercolliding.clear();
+        for(size_t ipair = 0; ipair < vpairs.size(); ++ipair) {
+            if( !vcollided[ipair] ) {
+                setnevercolliding.insert(vpairs[ipair]);
+            }
+        }
+    }
+
+    /// \brief sets the never colliding link pairs of all the initialized bodies with the hash
+    void _UpdateNeverCollidingLinks(const std::string& hash)
+    {
+        boost::shared_ptr< std::set<int> const > psetnevercolliding;
+        std::map<std::string, boost::shared_ptr< std::set<int> const > >::const_iterator itnever = _mapNeverCollidingLinks.find(hash);
+        if( itnever != _mapNeverCollidingLinks.end() ) {
+            psetnevercolliding = itnever->second;
+        }
+        std::vector<KinBodyPtr> vbodies;
+        GetEnv()->GetBodies(vbodies);
+        FOREACHC(itbody, vbodies) {
+            KinBodyInfoPtr pinfo = boost::dynamic_pointer_cast<KinBodyInfo>((*itbody)->GetUserData("pqpcollision"));
+            if( !!pinfo && (*itbody)->GetKinematicsGeometryHash() == hash ) {
+                pinfo->_psetNeverCollidingLinks = psetnevercolliding;
+            }
+        }
+    }
+
+    /// \brief a link that rays are cast against, the transform is fixed when it is gathered
+    struct RayLink
+    {
+        RayLink(KinBody::LinkConstPtr plink, boost::shared_ptr<PQP_Model> pmodel, dReal fradius) : plink(plink), pmodel(pmodel), fradius(fradius) {
+            t = plink->GetTransform();
+            tinv = t.inverse();
+        }
+        KinBody::LinkConstPtr plink;
+        boost::shared_ptr<PQP_Model> pmodel;
+        dReal fradius;
+        Transform t, tinv;
+    };
+
+    /// \brief the ray in the frame of the parent of a bounding volume
+    struct RayStackEntry
+    {
+        int ibv;
+        PQP_REAL p[3], d[3];
+    };
+
+    /// \brief gathers the enabled links of pbody, or of all bodies in the environment if pbody is empty
+    ///
+    /// \param binit if true, initializes the bodies that do not have collision models yet. Otherwise nothing is modified, so several threads can call it at once, and bodies without models are skipped.
+    void _GetRayLinks(KinBodyConstPtr pbody, std::vector<RayLink>& vraylinks, bool binit)
+    {
+        boost::shared_ptr<std::vector<KinBodyPtr> const> pvecbodies;
+        if( !pbody ) {
+            // shares the published list instead of copying it under the interface mutex, so concurrent casts do not contend
+            pvecbodies = GetEnv()->GetBodiesSnapshot();
+        }
+        else {
+            pvecbodies.reset(new std::vector<KinBodyPtr>(1, boost::const_pointer_cast<KinBody>(pbody)));
+        }
+        FOREACHC(itbody, *pvecbodies) {
+            if( binit ) {
+                _InitKinBody(*itbody);
+            }
+            KinBodyInfoPtr pinfo = boost::dynamic_pointer_cast<KinBodyInfo>((*itbody)->GetUserData("pqpcollision"));
+            if( !pinfo ) {
+                continue;
+            }
+            FOREACHC(itlink, (*itbody)->GetLinks()) {
+                if( (*itlink)->IsEnabled() && !!pinfo->vlinks.at((*itlink)->GetIndex()) ) {
+                    vraylinks.push_back(RayLink(*itlink, pinfo->vlinks[(*itlink)->GetIndex()], pinfo->vlinkradius[(*itlink)->GetIndex()]));
+                }
+            }
+        }
+    }
+
+    bool _CheckRayCollision(const RAY& ray, const std::vector<RayLink>& vraylinks, CollisionReportPtr report)
+    {
+        dReal fdist = 0;
+        Vector vnormal;
+        int ilink = _CastRay(ray, vraylinks, fdist, vnormal, _vraystack);
+        if( ilink < 0 ) {
+            return false;
+        }
+        if( !!report ) {
+            report->numCols = 1;
+            report->minDistance = fdist;
+            report->plink1 = vraylinks[ilink].plink;
+            Vector vpos = ray.pos + ray.dir*(fdist/RaveSqrt(ray.dir.lengthsqr3()));
+            report->contacts.push_back(CollisionReport::CONTACT(vpos, vnormal, fdist));
+        }
+        return true;
+    }
+
+    /// \brief finds the closest link hit by the ray
+    ///
+    /// \param[out] fdist the distance from the ray origin to the hit, only set if a link is hit
+    /// \param[out] vnormal the normal of the hit triangle given by its winding, only set if a link is hit
+    /// \param vraystack scratch space for the traversal of the bounding volumes
+    /// \return the index of the hit link in vraylinks or -1
+    int _CastRay(const RAY& ray, const std::vector<RayLink>& vraylinks, dReal& fdist, Vector& vnormal, std::vector<RayStackEntry>& vraystack)
+    {
+        dReal fmaxdist = RaveSqrt(ray.dir.lengthsqr3());
+        if( fmaxdist <= 0 ) {
+            return -1;
+        }
+        Vector vnormdir = ray.dir*(1/fmaxdist);
+        bool bAnyHit = !!(_options & OpenRAVE::CO_RayAnyHit);
+        PQP_REAL fbest = fmaxdist, p[3], d[3], normal[3];
+        int ibest = -1;
+        for(size_t i = 0; i < vraylinks.size(); ++i) {
+            const RayLink& raylink = vraylinks[i];
+            // reject the link with the sphere around its origin that contains all its vertices
+            Vector voffset = raylink.t.trans - ray.pos;
+            dReal fproj = voffset.dot3(vnormdir);
+            dReal fperpsqr = voffset.lengthsqr3() - fproj*fproj;
+            dReal fradiussqr = raylink.fradius*raylink.fradius;
+            if( fperpsqr > fradiussqr ) {
+                continue;
+            }
+            dReal fhalfchord = RaveSqrt(fradiussqr-fperpsqr);
+            if( fproj+fhalfchord < 0 || fproj-fhalfchord > fbest ) {
+                continue;
+            }
+            Vector vlocalpos = raylink.tinv*ray.pos, vlocaldir = raylink.tinv.rotate(vnormdir);
+            p[0] = vlocalpos.x; p[1] = vlocalpos.y; p[2] = vlocalpos.z;
+            d[0] = vlocaldir.x; d[1] = vlocaldir.y; d[2] = vlocaldir.z;
+            if( _CastRayModel(*raylink.pmodel, p, d, fbest, normal, vraystack) ) {
+                ibest = (int)i;
+                vnormal = raylink.t.rotate(Vector(normal[0],normal[1],normal[2]));
+                if( bAnyHit ) {
+                    break;
+                }
+            }
+        }
+        if( ibest >= 0 ) {
+            fdist = fbest;
+        }
+        return ibest;
+    }
+
+    /// \brief finds the closest triangle of the model hit by the ray before fbest
+    ///
+    /// The bounding volumes of PQP are stored relative to their parents, so the ray is transformed down the tree together with the boxes.
+    /// \param p, d the origin and normalized direction of the ray in the model frame
+    /// \param[inout] fbest the distance of the closest hit so far, updated if a closer hit is found
+    /// \param[out] normal the normalized normal of the hit triangle in the model frame
+    bool _CastRayModel(PQP_Model& model, const PQP_REAL p[3], const PQP_REAL d[3], PQP_REAL& fbest, PQP_REAL normal[3], std::vector<RayStackEntry>& vraystack)
+    {
+        if( model.num_bvs <= 0 ) {
+            return false;
+        }
+        bool bhit = false;
+        vraystack.resize(1);
+        vraystack[0].ibv = 0;
+        VcV(vraystack[0].p,p);
+        VcV(vraystack[0].d,d);
+        while(vraystack.size() > 0) {
+            RayStackEntry entry = vraystack.back();
+            vraystack.pop_back();
+            BV* pbv = model.child(entry.ibv);
+            PQP_REAL temp[3], localp[3], locald[3];
+            VmV(temp,entry.p,pbv->To);
+            MTxV(localp,pbv->R,temp);
+            MTxV(locald,pbv->R,entry.d);
+            if( !_RayIntersectsBox(localp,locald,pbv->d,fbest) ) {
+                continue;
+            }
+            if( pbv->Leaf() ) {
+                // the triangles are stored in the model frame
+                if( _RayIntersectsTriangle(p,d,model.tris[-pbv->first_child-1],fbest,normal) ) {
+                    bhit = true;
+                }
+            }
+            else {
+                for(int ichild = 0; ichild < 2; ++ichild) {
+                    vraystack.push_back(RayStackEntry());
+                    vraystack.back().ibv = pbv->first_child+ichild;
+                    VcV(vraystack.back().p,localp);
+                    VcV(vraystack.back().d,locald);
+                }
+            }
+        }
+        return bhit;
+    }
+
+    /// \brief slab test of the ray segment [0,fmaxdist] against the box centered at the origin with half extents
+    static bool _RayIntersectsBox(const PQP_REAL p[3], const PQP_REAL d[3], const PQP_REAL extents[3], PQP_REAL fmaxdist)
+    {
+        PQP_REAL tmin = 0, tmax = fmaxdist;
+        for(int i = 0; i < 3; ++i) {
+            if( RaveFabs(d[i]) < 1e-12 ) {
+                if( RaveFabs(p[i]) > extents[i] ) {
+                    return false;
+                }
+                continue;
+            }
+            PQP_REAL finv = 1/d[i];
+            PQP_REAL t0 = (-extents[i]-p[i])*finv, t1 = (extents[i]-p[i])*finv;
+            if( t0 > t1 ) {
+                swap(t0,t1);
+            }
+            tmin = max(tmin,t0);
+            tmax = min(tmax,t1);
+            if( tmin > tmax ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// \brief Moller-Trumbore intersection, only accepts hits closer than fbest and updates it
+    static bool _RayIntersectsTriangle(const PQP_REAL p[3], const PQP_REAL d[3], const Tri& tri, PQP_REAL& fbest, PQP_REAL normal[3])
+    {
+        PQP_REAL e1[3], e2[3], pvec[3], tvec[3], qvec[3];
+        VmV(e1,tri.p2,tri.p1);
+        VmV(e2,tri.p3,tri.p1);
+        VcrossV(pvec,d,e2);
+        PQP_REAL det = VdotV(e1,pvec);
+        if( RaveFabs(det) < 1e-15 ) {
+            return false;
+        }
+        PQP_REAL invdet = 1/det;
+        VmV(tvec,p,tri.p1);
+        PQP_REAL u = VdotV(tvec,pvec)*invdet;
+        if( u < 0 || u > 1 ) {
+            return false;
+        }
+        VcrossV(qvec,tvec,e1);
+        PQP_REAL v = VdotV(d,qvec)*invdet;
+        if( v < 0 || u+v > 1 ) {
+            return false;
+        }
+        PQP_REAL t = VdotV(e2,qvec)*invdet;
+        if( t < 0 || t > fbest ) {
+            return false;
+        }
+        fbest = t;
+        VcrossV(normal,e1,e2);
+        PQP_REAL flength = RaveSqrt(VdotV(normal,normal));
+        if( flength > 0 ) {
+            VxS(normal,normal,1/flength);
+        }
+        return true;
+    }
+
     // does not check attached
     bool CheckCollisionP(KinBodyConstPtr pbody1, const std::vector<KinBodyConstPtr>& vbodyexcluded, const std::vector<KinBody::LinkConstPtr>& vlinkexcluded, CollisionReportPtr report)
     {
+        if( _IsBroadPhaseUsable() ) {
+            _InitKinBody(pbody1);
+            return _CheckCollisionBroadPhase(pbody1, KinBody::LinkConstPtr(), vbodyexcluded, vlinkexcluded, report);
+        }
         int tmpnumcols = 0;
         int tmpnumwithintol = 0;
         bool retval;
 
-        std::vector<KinBodyPtr> vecbodies;
-        GetEnv()->GetBodies(vecbodies);
+        boost::shared_ptr<std::vector<KinBodyPtr> const> pvecbodies = GetEnv()->GetBodiesSnapshot();
+        const std::vector<KinBodyPtr>& vecbodies = *pvecbodies;
 
         PQP_REAL R1[3][3], R2[3][3], T1[3], T2[3];
 
@@ -403,7 +1404,7 @@ private:
         _InitKinBody(pbody1);
 
         std::vector<KinBody::LinkPtr> veclinks1 = pbody1->GetLinks();
-        FOREACH(itbody,vecbodies) {
+        FOREACHC(itbody,vecbodies) {
             if(!!report) {
                 report->numWithinTol = 0;
                 report->numCols = 0;
@@ -511,6 +1512,14 @@ private:
     }
 
     bool DoPQP(KinBody::LinkConstPtr link1, PQP_REAL R1[3][3], PQP_REAL T1[3], KinBody::LinkConstPtr link2, PQP_REAL R2[3][3], PQP_REAL T2[3], CollisionReportPtr report)
+    {
+        if( !link1->IsEnabled() || !link2->IsEnabled() ) {
+            return false;
+        }
+        return DoPQP(link1,GetLinkModel(link1),R1,T1,link2,GetLinkModel(link2),R2,T2,report);
+    }
+
+    bool DoPQP(KinBody::LinkConstPtr link1, boost::shared_ptr<PQP_Model> m1, PQP_REAL R1[3][3], PQP_REAL T1[3], KinBody::LinkConstPtr link2, boost::shared_ptr<PQP_Model> m2, PQP_REAL R2[3][3], PQP_REAL T2[3], CollisionReportPtr report)
     {
         if( !link1->IsEnabled() || !link2->IsEnabled() ) {
             return false;
@@ -518,12 +1527,16 @@ private:
         if( !_IsActiveLink(link1->GetParent(),link1->GetIndex()) || !_IsActiveLink(link2->GetParent(),link2->GetIndex()) ) {
             return false;
         }
-        boost::shared_ptr<PQP_Model> m1 = GetLinkModel(link1);
-        boost::shared_ptr<PQP_Model> m2 = GetLinkModel(link2);
         bool bcollision = false;
         if( !m1 || !m2 ) {
             return false;
         }
+        // the spheres enclose the meshes, so separated spheres mean no collision. The callbacks are called for every checked pair with a report, so they always go through PQP
+        if( _bSphereTrees && _benablecol && !_benabledis && !_benabletol && !GetEnv()->HasRegisteredCollisionCallbacks() ) {
+            if( !link1->GetSphereTree().Overlaps(GetTransformMatrixFromPQP(R1,T1), link2->GetSphereTree(), GetTransformMatrixFromPQP(R2,T2), s_nMaxSphereTests) ) {
+                return false;
+            }
+        }
         // collision
         if(_benablecol) {
             if( GetEnv()->HasRegisteredCollisionCallbacks() && !report ) {
@@ -620,6 +1633,13 @@ private:
 
     int _options;
 
+    static const size_t s_nMaxLinkPairCacheSize = 1<<16; ///< the link pair cache is cleared when it grows larger
+    static const int s_nMaxSphereTests = 32; ///< sphere pairs tested before giving up and running PQP, PQP is fast on close pairs too
+    static const int s_nMinSavedTriangles = 2000; ///< models with fewer triangles are cheap to build and are not saved to disk
+    dReal _fRelativeTransformEpsilon; ///< squared distance below which two relative transforms of a link pair are considered equal
+    std::map<std::pair<KinBody::Link const*, KinBody::Link const*>, LinkPairCache> _mapLinkPairCache; ///< indexed by the link pointers, the first is always smaller
+    std::map<std::string, boost::shared_ptr< std::set<int> const > > _mapNeverCollidingLinks; ///< never colliding link pairs indexed by the kinematics/geometry hash
+
     //pqp parameters
     PQP_REAL _tolerance;
     PQP_REAL _rel_err;
@@ -643,8 +1663,370 @@ private:
     PQP_REAL tri1[3][3], tri2[3][3];
     TransformMatrix tmtemp;
 
+    /// \brief upper bound on the distance any point of a link travels relative to a base link while the dofs move by vdofdelta.
+    ///
+    /// A revolute dof moves a point by at most its angle times the distance to the joint anchor. That distance is bounded
+    /// by the anchor-to-anchor lengths down the chain, which are fixed for revolute joints, plus the link radius.
+    dReal _ComputeChainMotionBound(KinBodyConstPtr pbody, KinBodyInfoConstPtr pinfo, const std::vector<dReal>& vdofdelta, int baselinkindex, int linkindex)
+    {
+        std::vector<KinBody::JointPtr> vjoints;
+        if( !pbody->GetChain(baselinkindex,linkindex,vjoints) ) {
+            if( baselinkindex != 0 ) {
+                // separate pieces, both move with respect to the world
+                return _ComputeChainMotionBound(pbody,pinfo,vdofdelta,0,baselinkindex) + _ComputeChainMotionBound(pbody,pinfo,vdofdelta,0,linkindex);
+            }
+            FOREACHC(itjoint, pbody->GetJoints()) {
+                for(int iaxis = 0; iaxis < (*itjoint)->GetDOF(); ++iaxis) {
+                    if( vdofdelta.at((*itjoint)->GetDOFIndex()+iaxis) > 0 && pbody->DoesAffect((*itjoint)->GetJointIndex(),linkindex) ) {
+                        throw OPENRAVE_EXCEPTION_FORMAT("link %s is moved but not connected to the base link", pbody->GetLinks().at(linkindex)->GetName(), ORE_NotImplemented);
+                    }
+                }
+            }
+            return 0;
+        }
+        // walk from the link to the base, accumulating the length from each anchor to the farthest point of the link
+        dReal fbound = 0;
+        dReal flength = pinfo->vlinkradius.at(linkindex);
+        Vector vprev = pbody->GetLinks().at(linkindex)->GetTransform().trans;
+        for(int ijoint = (int)vjoints.size()-1; ijoint >= 0; --ijoint) {
+            KinBody::JointPtr pjoint = vjoints[ijoint];
+            if( pjoint->GetType() & KinBody::JointSpecialBit ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("joint %s type 0x%x is not supported for continuous checking", pjoint->GetName()%pjoint->GetType(), ORE_NotImplemented);
+            }
+            Vector vanchor = pjoint->GetAnchor();
+            flength += RaveSqrt((vprev-vanchor).lengthsqr3());
+            vprev = vanchor;
+            for(int iaxis = 0; iaxis < pjoint->GetDOF(); ++iaxis) {
+                dReal fdelta = 0;
+                if( pjoint->IsMimic(iaxis) ) {
+                    // mimic equations can be arbitrary, so only joints whose source dofs do not move are supported
+                    std::vector<int> vmimicdofs;
+                    pjoint->GetMimicDOFIndices(vmimicdofs, iaxis);
+                    FOREACHC(itdof, vmimicdofs) {
+                        if( vdofdelta.at(*itdof) > 0 ) {
+                            throw OPENRAVE_EXCEPTION_FORMAT("joint %s is a moving mimic joint, continuous checking is not supported", pjoint->GetName(), ORE_NotImplemented);
+                        }
+                    }
+                }
+                else if( pjoint->GetDOFIndex() >= 0 ) {
+                    fdelta = vdofdelta.at(pjoint->GetDOFIndex()+iaxis);
+                }
+                if( fdelta <= 0 ) {
+                    continue;
+                }
+                if( baselinkindex == 0 && !pbody->DoesAffect(pjoint->GetJointIndex(),linkindex) ) {
+                    throw OPENRAVE_EXCEPTION_FORMAT("link %s is not a root link, continuous checking is not supported", pbody->GetLinks().at(0)->GetName(), ORE_NotImplemented);
+                }
+                if( pjoint->IsPrismatic(iaxis) ) {
+                    // translation moves all points by the same amount, but also stretches the chain above it
+                    fbound += fdelta;
+                    flength += fdelta;
+                }
+                else {
+                    fbound += fdelta*flength;
+                }
+            }
+        }
+        return fbound;
+    }
+
+    struct LinkPair
+    {
+        LinkPair(KinBody::LinkPtr plink1, KinBody::LinkPtr plink2, dReal fbound, dReal fradius) : plink1(plink1), plink2(plink2), fbound(fbound), fradius(fradius), fchecked(0), fcertified(0) {
+        }
+        KinBody::LinkPtr plink1, plink2;
+        dReal fbound; ///< max distance the two links can approach each other for the whole motion
+        dReal fradius; ///< sum of the link radii
+        dReal fchecked; ///< time the distance was last computed at
+        dReal fcertified; ///< the pair is known to be free until this time
+    };
+
+    struct ContextLink
+    {
+        ContextLink(KinBody::LinkConstPtr plink, boost::shared_ptr<PQP_Model> pmodel, dReal fradius) : plink(plink), pmodel(pmodel), fradius(fradius) {
+        }
+        KinBody::LinkConstPtr plink;
+        boost::shared_ptr<PQP_Model> pmodel;
+        dReal fradius;
+        PQP_REAL R[3][3], T[3];
+    };
+
+    /// \brief scratch state of one querying thread, the static links are a snapshot of the environment at creation
+    class QueryContext : public OpenRAVE::UserData
+    {
+public:
+        KinBodyConstPtr pbody;
+        int queryoptions;
+        std::vector<ContextLink> vlinks; ///< enabled links of pbody, transforms are set for every query
+        std::vector<ContextLink> vstaticlinks;
+        std::vector< std::pair<int,int> > vselfpairs; ///< indices into vlinks
+        PQP_CollideResult colres;
+    };
+
+    /// \brief only touches the context, so it can be called from several threads at once
+    bool _CollideContextLinks(QueryContext& context, ContextLink& link1, ContextLink& link2, CollisionReportPtr report)
+    {
+        PQP_REAL fradius = link1.fradius+link2.fradius;
+        PQP_REAL dx = link1.T[0]-link2.T[0], dy = link1.T[1]-link2.T[1], dz = link1.T[2]-link2.T[2];
+        if( dx*dx+dy*dy+dz*dz > fradius*fradius ) {
+            return false;
+        }
+        PQP_Collide(&context.colres,link1.R,link1.T,link1.pmodel.get(),link2.R,link2.T,link2.pmodel.get(),PQP_FIRST_CONTACT);
+        if( context.colres.NumPairs() == 0 ) {
+            return false;
+        }
+        if( !!report ) {
+            report->plink1 = link1.plink;
+            report->plink2 = link2.plink;
+            report->numCols = 1;
+        }
+        return true;
+    }
+
+    struct StaticLink
+    {
+        KinBody::LinkPtr plink;
+        PQP_REAL R[3][3], T[3];
+    };
+    struct StaticBody
+    {
+        std::vector<StaticLink> vlinks;
+    };
+
+    /// \brief models of all the checkers of the process indexed by the md5 of their triangles
+    struct ModelCache
+    {
+        ModelCache() : _nLastSize(64) {
+        }
+        boost::mutex _mutex;
+        std::map<std::string, boost::weak_ptr<PQP_Model> > _mapModels;
+        size_t _nLastSize; ///< expired entries are removed when the map doubles in size
+    };
+
+    static ModelCache& _GetModelCache()
+    {
+        static ModelCache s_cache;
+        return s_cache;
+    }
+
+    struct BroadPhaseBody
+    {
+        BroadPhaseBody() : nLastStamp(0) {
+        }
+        KinBodyWeakPtr pbody;
+        boost::weak_ptr<KinBodyInfo> pinfo; ///< the info the proxies were built from
+        int nLastStamp; ///< update stamp of the body when the proxies were last refit
+        std::vector<int> vproxies; ///< tree proxy of every link, -1 if the link has no geometry
+    };
+
+    /// \brief a candidate link pair of the broad phase
+    struct BroadPhasePair
+    {
+        BroadPhasePair(int bodyid, int ilink1, KinBody::Link const* plink2) : bodyid(bodyid), ilink1(ilink1), plink2(plink2) {
+        }
+        /// \brief sorts the pairs in the order the exhaustive loops visit them: by body, then first link, then second link
+        bool operator<(const BroadPhasePair& r) const {
+            if( bodyid != r.bodyid ) {
+                return bodyid < r.bodyid;
+            }
+            if( ilink1 != r.ilink1 ) {
+                return ilink1 < r.ilink1;
+            }
+            return plink2->GetIndex() < r.plink2->GetIndex();
+        }
+        int bodyid, ilink1;
+        KinBody::Link const* plink2;
+    };
+
+    /// \brief the broad phase only prunes pairs that cannot collide, distance and tolerance queries need all of them
+    bool _IsBroadPhaseUsable() const {
+        return _bBroadPhase && _benablecol && !_benabledis && !_benabletol;
+    }
+
+    /// \brief world bounding box of a link from its box in the link frame
+    static void _ComputeLinkBox(const KinBody::Link& link, const AABB& ab, Vector& vmin, Vector& vmax)
+    {
+        TransformMatrix t(link.GetTransform());
+        Vector vcenter = t*ab.pos;
+        Vector vextents(RaveFabs(t.m[0])*ab.extents.x + RaveFabs(t.m[1])*ab.extents.y + RaveFabs(t.m[2])*ab.extents.z,
+                        RaveFabs(t.m[4])*ab.extents.x + RaveFabs(t.m[5])*ab.extents.y + RaveFabs(t.m[6])*ab.extents.z,
+                        RaveFabs(t.m[8])*ab.extents.x + RaveFabs(t.m[9])*ab.extents.y + RaveFabs(t.m[10])*ab.extents.z);
+        vmin = vcenter - vextents;
+        vmax = vcenter + vextents;
+    }
+
+    void _ClearBroadPhase()
+    {
+        _mapBroadPhaseBodies.clear();
+        _broadphasetree.Clear();
+    }
+
+    void _AddBroadPhaseBody(KinBodyPtr pbody)
+    {
+        BroadPhaseBody& bpbody = _mapBroadPhaseBodies[pbody.get()];
+        bpbody.pbody = pbody;
+        _InsertBroadPhaseProxies(pbody, bpbody);
+    }
+
+    void _RemoveBroadPhaseProxies(BroadPhaseBody& bpbody)
+    {
+        FOREACH(itproxy, bpbody.vproxies) {
+            if( *itproxy >= 0 ) {
+                _broadphasetree.Remove(*itproxy);
+            }
+        }
+        bpbody.vproxies.resize(0);
+    }
+
+    /// \brief (re)creates the proxies of all links from the current info and transforms of the body
+    void _InsertBroadPhaseProxies(KinBodyConstPtr pbody, BroadPhaseBody& bpbody)
+    {
+        _RemoveBroadPhaseProxies(bpbody);
+        KinBodyInfoPtr pinfo = boost::dynamic_pointer_cast<KinBodyInfo>(pbody->GetUserData("pqpcollision"));
+        bpbody.pinfo = pinfo;
+        bpbody.nLastStamp = pbody->GetUpdateStamp();
+        if( !pinfo ) {
+            return;
+        }
+        Vector vmin, vmax;
+        bpbody.vproxies.resize(pbody->GetLinks().size(),-1);
+        for(size_t i = 0; i < pbody->GetLinks().size(); ++i) {
+            if( !!pinfo->vlinks.at(i) ) {
+                _ComputeLinkBox(*pbody->GetLinks()[i], pinfo->vlinkaabbs.at(i), vmin, vmax);
+                bpbody.vproxies[i] = _broadphasetree.Insert(vmin, vmax, _fBroadPhaseMargin, pbody->GetLinks()[i].get());
+            }
+        }
+    }
+
+    /// \brief removes the bodies that left the environment, rebuilds the bodies whose geometry changed and refits the ones that moved
+    void _SyncBroadPhase()
+    {
+        Vector vmin, vmax;
+        std::map<KinBody const*, BroadPhaseBody>::iterator it = _mapBroadPhaseBodies.begin();
+        while(it != _mapBroadPhaseBodies.end()) {
+            BroadPhaseBody& bpbody = it->second;
+            KinBodyPtr pbody = bpbody.pbody.lock();
+            if( !pbody || pbody->GetEnvironmentId() == 0 ) {
+                _RemoveBroadPhaseProxies(bpbody);
+                _mapBroadPhaseBodies.erase(it++);
+                continue;
+            }
+            KinBodyInfoPtr pinfo = bpbody.pinfo.lock();
+            if( !pinfo || pinfo->bGeometryChanged || bpbody.vproxies.size() != pbody->GetLinks().size() ) {
+                _InitKinBody(pbody);
+                _InsertBroadPhaseProxies(pbody, bpbody);
+            }
+            else if( bpbody.nLastStamp != pbody->GetUpdateStamp() ) {
+                bpbody.nLastStamp = pbody->GetUpdateStamp();
+                for(size_t i = 0; i < bpbody.vproxies.size(); ++i) {
+                    if( bpbody.vproxies[i] >= 0 ) {
+                        _ComputeLinkBox(*pbody->GetLinks()[i], pinfo->vlinkaabbs[i], vmin, vmax);
+                        _broadphasetree.Update(bpbody.vproxies[i], vmin, vmax, _fBroadPhaseMargin);
+                    }
+                }
+            }
+            ++it;
+        }
+    }
+
+    /// \brief checks the links of pbody1 (or only plink1 if set) against the environment bodies, running PQP only on the link pairs whose boxes overlap.
+    ///
+    /// Returns the same results and report counts as the exhaustive loops of CheckCollision(plink,...) and CheckCollisionP(pbody,...) in collision-only mode.
+    bool _CheckCollisionBroadPhase(KinBodyConstPtr pbody1, KinBody::LinkConstPtr plink1, const std::vector<KinBodyConstPtr>& vbodyexcluded, const std::vector<KinBody::LinkConstPtr>& vlinkexcluded, CollisionReportPtr report)
+    {
+        _SyncBroadPhase();
+        KinBodyInfoPtr pinfo1 = boost::dynamic_pointer_cast<KinBodyInfo>(pbody1->GetUserData("pqpcollision"));
+        if( !pinfo1 ) {
+            return false;
+        }
+        Vector vmin, vmax;
+        _vbroadphasepairs.clear();
+        const std::vector<KinBody::LinkPtr>& veclinks1 = pbody1->GetLinks();
+        for(size_t i = 0; i < veclinks1.size(); ++i) {
+            if( !!plink1 ) {
+                if( veclinks1[i] != plink1 ) {
+                    continue;
+                }
+            }
+            else if( find(vlinkexcluded.begin(),vlinkexcluded.end(),veclinks1[i]) != vlinkexcluded.end() ) {
+                continue;
+            }
+            if( !veclinks1[i]->IsEnabled() || !pinfo1->vlinks.at(i) ) {
+                continue;
+            }
+            _ComputeLinkBox(*veclinks1[i], pinfo1->vlinkaabbs.at(i), vmin, vmax);
+            _vbroadphaselinks.resize(0);
+            _broadphasetree.Query(vmin, vmax, _vbroadphaselinks);
+            FOREACHC(itlink, _vbroadphaselinks) {
+                KinBody::Link const* plink2 = static_cast<KinBody::Link const*>(*itlink);
+                if( plink2->GetParent().get() == pbody1.get() || !plink2->IsEnabled() ) {
+                    continue;
+                }
+                _vbroadphasepairs.push_back(BroadPhasePair(plink2->GetParent()->GetEnvironmentId(), i, plink2));
+            }
+        }
+        std::sort(_vbroadphasepairs.begin(), _vbroadphasepairs.end());
+
+        int tmpnumcols = 0;
+        int tmpnumwithintol = 0;
+        PQP_REAL R1[3][3], R2[3][3], T1[3], T2[3];
+        std::vector<BroadPhasePair>::const_iterator itpair = _vbroadphasepairs.begin();
+        while(itpair != _vbroadphasepairs.end()) {
+            KinBodyPtr pbody2 = itpair->plink2->GetParent();
+            std::vector<BroadPhasePair>::const_iterator itend = itpair;
+            while(itend != _vbroadphasepairs.end() && itend->bodyid == itpair->bodyid) {
+                ++itend;
+            }
+            if( pbody1->IsAttached(KinBodyConstPtr(pbody2)) || find(vbodyexcluded.begin(),vbodyexcluded.end(),pbody2) != vbodyexcluded.end() ) {
+                itpair = itend;
+                continue;
+            }
+            if(!!report) {
+                report->numWithinTol = 0;
+                report->numCols = 0;
+            }
+            const std::vector<KinBody::LinkPtr>& veclinks2 = pbody2->GetLinks();
+            for(; itpair != itend; ++itpair) {
+                KinBody::LinkConstPtr plink2 = veclinks2.at(itpair->plink2->GetIndex());
+                if( find(vlinkexcluded.begin(),vlinkexcluded.end(),plink2) != vlinkexcluded.end() ) {
+                    continue;
+                }
+                GetPQPTransformFromTransform(veclinks1[itpair->ilink1]->GetTransform(),R1,T1);
+                GetPQPTransformFromTransform(plink2->GetTransform(),R2,T2);
+                if( DoPQP(veclinks1[itpair->ilink1],R1,T1,plink2,R2,T2,report) && !report ) {
+                    return true;
+                }
+            }
+            if(!!report) {
+                if(report->numWithinTol > 0) {
+                    tmpnumwithintol++;
+                }
+                if(report->numCols > 0) {
+                    tmpnumcols++;
+                }
+            }
+        }
+        if(!!report) {
+            report->numWithinTol = tmpnumwithintol;
+            report->numCols = tmpnumcols;
+        }
+        return tmpnumcols>0;
+    }
+
+    dReal _fContinuousSeparation; ///< distance at which continuous checks stop advancing and report a collision
+    int _nContinuousMaxSteps; ///< maximum number of times a continuous check re-poses the body before giving up
+
     RobotBaseConstPtr _pactiverobot;     ///< set if ActiveDOFs option is enabled
     vector<uint8_t> _vactivelinks;
+    std::vector<RayStackEntry> _vraystack; ///< scratch stack of the bounding volume traversal of rays
+
+    bool _bBroadPhase; ///< if true, environment checks only run PQP on link pairs whose boxes overlap
+    bool _bSphereTrees; ///< if true, link pairs whose sphere trees do not overlap are not given to PQP
+    dReal _fBroadPhaseMargin; ///< the boxes in the tree are fattened by this much so small motions do not change the tree
+    DynamicAABBTree _broadphasetree; ///< boxes of the links of all bodies in the environment, the user data is the link
+    std::map<KinBody const*, BroadPhaseBody> _mapBroadPhaseBodies;
+    std::vector<const void*> _vbroadphaselinks; ///< scratch results of a tree query
+    std::vector<BroadPhasePair> _vbroadphasepairs;
 
     void _SetActiveBody(KinBodyConstPtr pbody) {
         if( _options & CO_ActiveDOFs ) {
@@ -0,0 +1,329 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2026 OpenRAVE contributors
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef OPENRAVE_DYNAMICAABBTREE_H
+#define OPENRAVE_DYNAMICAABBTREE_H
+
+/** \brief bounding volume hierarchy of axis-aligned boxes that is updated incrementally as the boxes move
+
+    Every leaf is an object with a fattened box, so an object moving a little does not change the tree. When an object leaves its
+    fattened box, its leaf is removed and inserted again. Leaves are inserted next to the sibling that increases the surface of the
+    tree the least and the tree is kept balanced with rotations, so queries stay logarithmic in the number of objects.
+ */
+class DynamicAABBTree
+{
+public:
+    DynamicAABBTree() : _root(-1), _freelist(-1), _numleaves(0) {
+    }
+
+    /// \brief removes all the objects
+    void Clear()
+    {
+        _nodes.resize(0);
+        _root = -1;
+        _freelist = -1;
+        _numleaves = 0;
+    }
+
+    /// \brief adds an object with its box fattened by fmargin and returns its proxy
+    int Insert(const Vector& vmin, const Vector& vmax, dReal fmargin, const void* puserdata)
+    {
+        int leaf = _AllocateNode();
+        Node& node = _nodes[leaf];
+        node.vmin = vmin - Vector(fmargin,fmargin,fmargin);
+        node.vmax = vmax + Vector(fmargin,fmargin,fmargin);
+        node.puserdata = puserdata;
+        node.height = 0;
+        _InsertLeaf(leaf);
+        ++_numleaves;
+        return leaf;
+    }
+
+    void Remove(int proxy)
+    {
+        BOOST_ASSERT(proxy >= 0 && proxy < (int)_nodes.size() && _nodes[proxy].IsLeaf());
+        _RemoveLeaf(proxy);
+        _FreeNode(proxy);
+        --_numleaves;
+    }
+
+    /// \brief moves the box of an object, the tree only changes if the box leaves the fattened box of the leaf
+    ///
+    /// \return true if the leaf was inserted again
+    bool Update(int proxy, const Vector& vmin, const Vector& vmax, dReal fmargin)
+    {
+        Node& node = _nodes.at(proxy);
+        if( node.vmin.x <= vmin.x && node.vmin.y <= vmin.y && node.vmin.z <= vmin.z && vmax.x <= node.vmax.x && vmax.y <= node.vmax.y && vmax.z <= node.vmax.z ) {
+            return false;
+        }
+        _RemoveLeaf(proxy);
+        _nodes[proxy].vmin = vmin - Vector(fmargin,fmargin,fmargin);
+        _nodes[proxy].vmax = vmax + Vector(fmargin,fmargin,fmargin);
+        _InsertLeaf(proxy);
+        return true;
+    }
+
+    /// \brief appends the user data of all objects whose fattened box overlaps the box to vuserdata
+    void Query(const Vector& vmin, const Vector& vmax, std::vector<const void*>& vuserdata) const
+    {
+        if( _root < 0 ) {
+            return;
+        }
+        _vstack.resize(0);
+        _vstack.push_back(_root);
+        while(_vstack.size() > 0) {
+            const Node& node = _nodes[_vstack.back()];
+            _vstack.pop_back();
+            if( node.vmax.x < vmin.x || node.vmax.y < vmin.y || node.vmax.z < vmin.z || vmax.x < node.vmin.x || vmax.y < node.vmin.y || vmax.z < node.vmin.z ) {
+                continue;
+            }
+            if( node.IsLeaf() ) {
+                vuserdata.push_back(node.puserdata);
+            }
+            else {
+                _vstack.push_back(node.child1);
+                _vstack.push_back(node.child2);
+            }
+        }
+    }
+
+    int GetNumLeaves() const {
+        return _numleaves;
+    }
+
+    /// \brief the number of levels of the tree, 0 if empty
+    int GetHeight() const {
+        return _root >= 0 ? _nodes[_root].height+1 : 0;
+    }
+
+private:
+    struct Node
+    {
+        Vector vmin, vmax;
+        const void* puserdata;
+        int parent;     ///< next free node when in the free list
+        int child1, child2;     ///< -1 for leaves
+        int height;     ///< 0 for leaves, -1 for free nodes
+        bool IsLeaf() const {
+            return child1 < 0;
+        }
+    };
+
+    static dReal _Perimeter(const Vector& vmin, const Vector& vmax)
+    {
+        return 2*((vmax.x-vmin.x)+(vmax.y-vmin.y)+(vmax.z-vmin.z));
+    }
+
+    static void _Union(const Node& node1, const Node& node2, Vector& vmin, Vector& vmax)
+    {
+        vmin = Vector(min(node1.vmin.x,node2.vmin.x), min(node1.vmin.y,node2.vmin.y), min(node1.vmin.z,node2.vmin.z));
+        vmax = Vector(max(node1.vmax.x,node2.vmax.x), max(node1.vmax.y,node2.vmax.y), max(node1.vmax.z,node2.vmax.z));
+    }
+
+    int _AllocateNode()
+    {
+        int index;
+        if( _freelist >= 0 ) {
+            index = _freelist;
+            _freelist = _nodes[index].parent;
+        }
+        else {
+            index = (int)_nodes.size();
+            _nodes.push_back(Node());
+        }
+        Node& node = _nodes[index];
+        node.parent = node.child1 = node.child2 = -1;
+        node.height = 0;
+        node.puserdata = NULL;
+        return index;
+    }
+
+    void _FreeNode(int index)
+    {
+        _nodes[index].parent = _freelist;
+        _nodes[index].height = -1;
+        _freelist = index;
+    }
+
+    void _InsertLeaf(int leaf)
+    {
+        if( _root < 0 ) {
+            _root = leaf;
+            _nodes[leaf].parent = -1;
+            return;
+        }
+
+        // find the sibling that increases the perimeter of the tree the least
+        Vector vmin, vmax;
+        int index = _root;
+        while(!_nodes[index].IsLeaf()) {
+            const Node& node = _nodes[index];
+            _Union(node, _nodes[leaf], vmin, vmax);
+            dReal fcombined = _Perimeter(vmin, vmax);
+            // cost of making a new parent for this node and the leaf
+            dReal fcost = 2*fcombined;
+            // minimum cost of pushing the leaf further down the tree
+            dReal finheritance = 2*(fcombined - _Perimeter(node.vmin, node.vmax));
+            dReal fchildcost[2];
+            for(int ichild = 0; ichild < 2; ++ichild) {
+                const Node& child = _nodes[ichild == 0 ? node.child1 : node.child2];
+                _Union(child, _nodes[leaf], vmin, vmax);
+                fchildcost[ichild] = _Perimeter(vmin, vmax) + finheritance;
+                if( !child.IsLeaf() ) {
+                    fchildcost[ichild] -= _Perimeter(child.vmin, child.vmax);
+                }
+            }
+            if( fcost < fchildcost[0] && fcost < fchildcost[1] ) {
+                break;
+            }
+            index = fchildcost[0] < fchildcost[1] ? node.child1 : node.child2;
+        }
+
+        int sibling = index;
+        int oldparent = _nodes[sibling].parent;
+        int newparent = _AllocateNode();     // can reallocate _nodes
+        _nodes[newparent].parent = oldparent;
+        _Union(_nodes[leaf], _nodes[sibling], _nodes[newparent].vmin, _nodes[newparent].vmax);
+        _nodes[newparent].height = _nodes[sibling].height + 1;
+        _nodes[newparent].child1 = sibling;
+        _nodes[newparent].child2 = leaf;
+        _nodes[sibling].parent = newparent;
+        _nodes[leaf].parent = newparent;
+        if( oldparent >= 0 ) {
+            if( _nodes[oldparent].child1 == sibling ) {
+                _nodes[oldparent].child1 = newparent;
+            }
+            else {
+                _nodes[oldparent].child2 = newparent;
+            }
+        }
+        else {
+            _root = newparent;
+        }
+        _RefitAncestors(_nodes[leaf].parent);
+    }
+
+    void _RemoveLeaf(int leaf)
+    {
+        if( leaf == _root ) {
+            _root = -1;
+            return;
+        }
+        int parent = _nodes[leaf].parent;
+        int grandparent = _nodes[parent].parent;
+        int sibling = _nodes[parent].child1 == leaf ? _nodes[parent].child2 : _nodes[parent].child1;
+        if( grandparent >= 0 ) {
+            if( _nodes[grandparent].child1 == parent ) {
+                _nodes[grandparent].child1 = sibling;
+            }
+            else {
+                _nodes[grandparent].child2 = sibling;
+            }
+            _nodes[sibling].parent = grandparent;
+            _FreeNode(parent);
+            _RefitAncestors(grandparent);
+        }
+        else {
+            _root = sibling;
+            _nodes[sibling].parent = -1;
+            _FreeNode(parent);
+        }
+    }
+
+    /// \brief rebalances and recomputes the boxes and heights from index up to the root
+    void _RefitAncestors(int index)
+    {
+        while(index >= 0) {
+            index = _Balance(index);
+            Node& node = _nodes[index];
+            const Node& child1 = _nodes[node.child1], &child2 = _nodes[node.child2];
+            node.height = 1 + max(child1.height, child2.height);
+            _Union(child1, child2, node.vmin, node.vmax);
+            index = node.parent;
+        }
+    }
+
+    /// \brief if the subtrees of node a differ in height by more than one, rotates the higher child up
+    ///
+    /// \return the index of the node that is now at the position of a
+    int _Balance(int ia)
+    {
+        Node& a = _nodes[ia];
+        if( a.IsLeaf() || a.height < 2 ) {
+            return ia;
+        }
+        int ib = a.child1, ic = a.child2;
+        int balance = _nodes[ic].height - _nodes[ib].height;
+        if( balance > 1 ) {
+            return _Rotate(ia, ic);
+        }
+        if( balance < -1 ) {
+            return _Rotate(ia, ib);
+        }
+        return ia;
+    }
+
+    /// \brief rotates child iup of ia up, ia keeps its other child and the lower child of iup
+    int _Rotate(int ia, int iup)
+    {
+        Node& a = _nodes[ia];
+        Node& up = _nodes[iup];
+        int if0 = up.child1, ig = up.child2;
+        Node& f = _nodes[if0];
+        Node& g = _nodes[ig];
+
+        // iup takes the place of ia
+        up.child1 = ia;
+        up.parent = a.parent;
+        a.parent = iup;
+        if( up.parent >= 0 ) {
+            if( _nodes[up.parent].child1 == ia ) {
+                _nodes[up.parent].child1 = iup;
+            }
+            else {
+                _nodes[up.parent].child2 = iup;
+            }
+        }
+        else {
+            _root = iup;
+        }
+
+        // the higher grandchild stays with iup, the lower one goes to ia
+        int ikeep = if0, imove = ig;
+        if( f.height < g.height ) {
+            ikeep = ig;
+            imove = if0;
+        }
+        up.child2 = ikeep;
+        if( a.child1 == iup ) {
+            a.child1 = imove;
+        }
+        else {
+            a.child2 = imove;
+        }
+        _nodes[imove].parent = ia;
+        _Union(_nodes[a.child1], _nodes[a.child2], a.vmin, a.vmax);
+        a.height = 1 + max(_nodes[a.child1].height, _nodes[a.child2].height);
+        _Union(a, _nodes[ikeep], up.vmin, up.vmax);
+        up.height = 1 + max(a.height, _nodes[ikeep].height);
+        return iup;
+    }
+
+    std::vector<Node> _nodes;
+    int _root, _freelist, _numleaves;
+    mutable std::vector<int> _vstack;     ///< scratch stack of Query
+};
+
+#endif
@@ -57,6 +57,9 @@
 
 #include <boost/assert.hpp>
 #include <boost/bind.hpp>
+#include <boost/thread/mutex.hpp>
+
+#include <openrave/utils.h>
 
 using namespace std;
 using namespace OpenRAVE;
@@ -68,8 +68,6 @@ PQP_Model::PQP_Model()
     num_tris = 0;
     num_tris_alloced = 0;
 
-    last_tri = 0;
-
     build_state = PQP_BUILD_STATE_EMPTY;
 }
 
@@ -235,8 +233,6 @@ PQP_Model::EndModel()
     build_model(this);
     build_state = PQP_BUILD_STATE_PROCESSED;
 
-    last_tri = tris;
-
     return PQP_OK;
 }
 
@@ -260,6 +256,100 @@ PQP_Model::MemUsage(int msg)
     return total_mem;
 }
 
+// the sizes guard against files written with a different PQP_REAL or BV type
+static const int PQP_MODEL_FILE_MAGIC = 0x50515031;
+
+int
+PQP_Model::SaveModel(FILE *fp) const
+{
+    if (build_state != PQP_BUILD_STATE_PROCESSED)
+    {
+        return PQP_ERR_UNPROCESSED_MODEL;
+    }
+
+    int header[6] = { PQP_MODEL_FILE_MAGIC, (int)sizeof(PQP_REAL), (int)sizeof(Tri), (int)sizeof(BV), num_tris, num_bvs };
+    if (fwrite(header, sizeof(header), 1, fp) != 1 ||
+        fwrite(tris, sizeof(Tri), num_tris, fp) != (size_t)num_tris ||
+        fwrite(b, sizeof(BV), num_bvs, fp) != (size_t)num_bvs)
+    {
+        return PQP_ERR_BUILD_OUT_OF_SEQUENCE;
+    }
+    return PQP_OK;
+}
+
+int
+PQP_Model::LoadModel(FILE *fp)
+{
+    int header[6];
+    if (fread(header, sizeof(header), 1, fp) != 1 ||
+        header[0] != PQP_MODEL_FILE_MAGIC || header[1] != (int)sizeof(PQP_REAL) ||
+        header[2] != (int)sizeof(Tri) || header[3] != (int)sizeof(BV) ||
+        header[4] <= 0 || header[5] <= 0 || (size_t)header[5] > 2*(size_t)header[4]-1)
+    {
+        return PQP_ERR_BUILD_OUT_OF_SEQUENCE;
+    }
+
+    // a corrupted header could request huge arrays, so check that the file
+    // really holds them before allocating anything.
+    long start = ftell(fp);
+    if (start < 0 || fseek(fp, 0, SEEK_END) != 0)
+    {
+        return PQP_ERR_BUILD_OUT_OF_SEQUENCE;
+    }
+    long end = ftell(fp);
+    if (end < start || fseek(fp, start, SEEK_SET) != 0 ||
+        (size_t)(end - start) < (size_t)header[4]*sizeof(Tri) + (size_t)header[5]*sizeof(BV))
+    {
+        return PQP_ERR_BUILD_OUT_OF_SEQUENCE;
+    }
+
+    Tri *new_tris = new Tri[header[4]];
+    BV *new_b = new BV[header[5]];
+    if (fread(new_tris, sizeof(Tri), header[4], fp) != (size_t)header[4] ||
+        fread(new_b, sizeof(BV), header[5], fp) != (size_t)header[5])
+    {
+        delete [] new_tris;
+        delete [] new_b;
+        return PQP_ERR_BUILD_OUT_OF_SEQUENCE;
+    }
+
+    // the queries index the arrays without checks, so reject any file whose
+    // tree does not point inside them. children always come after their parent
+    // and the triangle ids are the indices the model was built with.
+    bool valid = true;
+    for (int i = 0; valid && i < header[4]; ++i)
+    {
+        valid = new_tris[i].id >= 0 && new_tris[i].id < header[4];
+    }
+    for (int i = 0; valid && i < header[5]; ++i)
+    {
+        int first_child = new_b[i].first_child;
+        if (first_child < 0)
+        {
+            valid = -first_child - 1 < header[4];
+        }
+        else
+        {
+            valid = first_child > i && first_child + 1 < header[5];
+        }
+    }
+    if (!valid)
+    {
+        delete [] new_tris;
+        delete [] new_b;
+        return PQP_ERR_BUILD_OUT_OF_SEQUENCE;
+    }
+
+    delete [] b;
+    delete [] tris;
+    tris = new_tris;
+    num_tris = num_tris_alloced = header[4];
+    b = new_b;
+    num_bvs = num_bvs_alloced = header[5];
+    build_state = PQP_BUILD_STATE_PROCESSED;
+    return PQP_OK;
+}
+
 //  COLLIDE STUFF
 //
 //--------------------------------------------------------------------------
@@ -690,8 +780,8 @@ DistanceRecurse(PQP_DistanceResult *res,
             VcV(res->p1, p);   // p already in c.s. 1
             VcV(res->p2, q);   // q must be transformed
                                // into c.s. 2 later
-            o1->last_tri = t1;
-            o2->last_tri = t2;
+            res->last_tri1 = (int)(t1 - o1->tris);
+            res->last_tri2 = (int)(t2 - o2->tris);
         }
 
         return;
@@ -827,8 +917,8 @@ DistanceQueueRecurse(PQP_DistanceResult *res,
                 VcV(res->p1, p); // p already in c.s. 1
                 VcV(res->p2, q); // q must be transformed
                                  // into c.s. 2 later
-                o1->last_tri = t1;
-                o2->last_tri = t2;
+                res->last_tri1 = (int)(t1 - o1->tris);
+                res->last_tri2 = (int)(t2 - o2->tris);
             }
         }
         else if (bvtq.GetNumTests() == bvtq.GetSize() - 1)
@@ -971,8 +1061,18 @@ PQP_Distance(PQP_DistanceResult *res,
     // establish initial upper bound using last triangles which
     // provided the minimum distance
 
+    if (res->last_model1 != o1 || res->last_model2 != o2 ||
+        res->last_tri1 < 0 || res->last_tri1 >= o1->num_tris ||
+        res->last_tri2 < 0 || res->last_tri2 >= o2->num_tris)
+    {
+        res->last_model1 = o1;
+        res->last_model2 = o2;
+        res->last_tri1 = 0;
+        res->last_tri2 = 0;
+    }
+
     PQP_REAL p[3],q[3];
-    res->distance = TriDistance(res->R,res->T,o1->last_tri,o2->last_tri,p,q);
+    res->distance = TriDistance(res->R,res->T,&o1->tris[res->last_tri1],&o2->tris[res->last_tri2],p,q);
     VcV(res->p1,p);
     VcV(res->p2,q);
 
@@ -38,6 +38,7 @@
 
  \**************************************************************************/
 
+#include <stdio.h>
 #include "Tri.h"
 #include "BV.h"
 
@@ -56,8 +57,6 @@ public:
     int num_bvs;
     int num_bvs_alloced;
 
-    Tri *last_tri;         // closest tri on this model in last distance test
-
     BV *child(int n) {
         return &b[n];
     }
@@ -73,6 +72,11 @@ public:
     int EndModel();
     int MemUsage(int msg);    // returns model mem usage.
                               // prints message to stderr if msg == TRUE
+
+    int SaveModel(FILE *fp) const; // writes a processed model in binary,
+                                   // only valid for the same build
+    int LoadModel(FILE *fp);       // restores a model written by SaveModel
+                                   // without rebuilding the tree
 };
 
 struct CollisionPair
@@ -160,6 +164,16 @@ struct PQP_DistanceResult
     PQP_REAL p2[3];
     int qsize;
 
+    // closest triangles of the last query, they seed the next query of the
+    // same models. Kept here instead of in the models so that models can be
+    // shared by queries running in parallel.
+
+    const PQP_Model *last_model1, *last_model2;
+    int last_tri1, last_tri2;
+
+    PQP_DistanceResult() : last_model1(0), last_model2(0), last_tri1(0), last_tri2(0) {
+    }
+
     // statistics
 
     int NumBVTests() {
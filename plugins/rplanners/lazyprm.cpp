@@ -0,0 +1,848 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2012 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This file is part of OpenRAVE.
+// OpenRAVE is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include "rplanners.h"
+
+#include <boost/thread/mutex.hpp>
+#include <queue>
+#include <cstdio>
+
+/// \brief roadmap over the configuration space of a robot, shared by all lazy PRM planners of the process
+///
+/// The nodes and edges only depend on the robot kinematics and the planning parameters, so they are kept across queries
+/// and saved to disk. The collision status of the nodes and edges depends on the rest of the environment and is reset
+/// whenever the environment signature changes.
+class LazyRoadmap
+{
+public:
+    enum Status {
+        S_Unknown=0,
+        S_Valid=1,
+        S_Invalid=2,
+    };
+
+    LazyRoadmap(const std::string& key, int dof) : _key(key), _dof(dof), _bModified(false) {
+    }
+
+    int GetNumNodes() const {
+        return (int)_vconfigs.size();
+    }
+    int GetNumEdges() const {
+        return (int)_vedges.size();
+    }
+
+    int AddNode(const std::vector<dReal>& q)
+    {
+        _vconfigs.push_back(q);
+        _vnodestatus.push_back(S_Unknown);
+        _vadjacency.push_back(std::vector<int>());
+        return (int)_vconfigs.size()-1;
+    }
+
+    int AddEdge(int inode0, int inode1, dReal flength)
+    {
+        int iedge = (int)_vedges.size();
+        _vedges.push_back(std::make_pair(inode0,inode1));
+        _vedgelengths.push_back(flength);
+        _vedgestatus.push_back(S_Unknown);
+        _vadjacency.at(inode0).push_back(iedge);
+        _vadjacency.at(inode1).push_back(iedge);
+        return iedge;
+    }
+
+    /// \brief removes all nodes and edges starting at numnodes and numedges, used for the temporary query nodes
+    void Truncate(int numnodes, int numedges)
+    {
+        for(int iedge = (int)_vedges.size()-1; iedge >= numedges; --iedge) {
+            // temporary edges are always the last ones in the adjacency lists
+            int inodes[2] = { _vedges[iedge].first, _vedges[iedge].second};
+            for(int j = 0; j < 2; ++j) {
+                std::vector<int>& vadjacent = _vadjacency.at(inodes[j]);
+                if( vadjacent.size() > 0 && vadjacent.back() == iedge ) {
+                    vadjacent.pop_back();
+                }
+            }
+        }
+        _vedges.resize(numedges);
+        _vedgelengths.resize(numedges);
+        _vedgestatus.resize(numedges);
+        _vconfigs.resize(numnodes);
+        _vnodestatus.resize(numnodes);
+        _vadjacency.resize(numnodes);
+    }
+
+    /// \brief forgets all collision information
+    void ResetStatus()
+    {
+        std::fill(_vnodestatus.begin(),_vnodestatus.end(),(uint8_t)S_Unknown);
+        std::fill(_vedgestatus.begin(),_vedgestatus.end(),(uint8_t)S_Unknown);
+    }
+
+    /// \brief saves the roadmap in a binary format.
+    ///
+    /// The file is only meant as a cache for the same machine, so the data is written with the native byte order and the
+    /// size of dReal is checked when loading.
+    bool Save(const std::string& filename) const
+    {
+        // write to a temporary file first so that other processes never read a partial roadmap, the name is unique so that planners saving the same roadmap do not write into each other's file
+        std::string tempfilename = str(boost::format("%s.%x.tmp")%filename%utils::GetNanoTime());
+        {
+            std::ofstream f(tempfilename.c_str(), std::ios::binary);
+            if( !f ) {
+                return false;
+            }
+            uint32_t header[6] = { s_nMagic, s_nVersion, (uint32_t)sizeof(dReal), (uint32_t)_dof, (uint32_t)_vconfigs.size(), (uint32_t)_vedges.size() };
+            f.write((const char*)header,sizeof(header));
+            FOREACHC(itconfig,_vconfigs) {
+                f.write((const char*)&(*itconfig)[0],sizeof(dReal)*_dof);
+            }
+            if( _vnodestatus.size() > 0 ) {
+                f.write((const char*)&_vnodestatus[0],_vnodestatus.size());
+            }
+            FOREACHC(itedge,_vedges) {
+                int32_t indices[2] = { itedge->first, itedge->second};
+                f.write((const char*)indices,sizeof(indices));
+            }
+            if( _vedges.size() > 0 ) {
+                f.write((const char*)&_vedgelengths[0],sizeof(dReal)*_vedgelengths.size());
+                f.write((const char*)&_vedgestatus[0],_vedgestatus.size());
+            }
+            uint32_t signaturelength = _envsignature.size();
+            f.write((const char*)&signaturelength,sizeof(signaturelength));
+            f.write(_envsignature.c_str(),signaturelength);
+            if( !f ) {
+                f.close();
+                std::remove(tempfilename.c_str());
+                return false;
+            }
+        }
+        if( std::rename(tempfilename.c_str(),filename.c_str()) != 0 ) {
+            std::remove(tempfilename.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool Load(const std::string& filename)
+    {
+        std::ifstream f(filename.c_str(), std::ios::binary);
+        if( !f ) {
+            return false;
+        }
+        uint32_t header[6];
+        f.read((char*)header,sizeof(header));
+        if( !f || header[0] != s_nMagic || header[1] != s_nVersion || header[2] != sizeof(dReal) || (int)header[3] != _dof ) {
+            RAVELOG_WARN(str(boost::format("roadmap file %s is not compatible\n")%filename));
+            return false;
+        }
+        // check the counts against the size of the file before allocating anything, a corrupted header could otherwise request gigabytes
+        uint64_t minsize = sizeof(header) + (uint64_t)header[4]*(sizeof(dReal)*_dof+1) + (uint64_t)header[5]*(2*sizeof(int32_t)+sizeof(dReal)+1) + sizeof(uint32_t);
+        f.seekg(0, std::ios::end);
+        uint64_t filesize = (uint64_t)f.tellg();
+        f.seekg(sizeof(header), std::ios::beg);
+        if( !f || filesize < minsize || header[4] > (uint32_t)std::numeric_limits<int>::max() || header[5] > (uint32_t)std::numeric_limits<int>::max() ) {
+            RAVELOG_WARN(str(boost::format("roadmap file %s is truncated\n")%filename));
+            return false;
+        }
+        int numnodes = header[4], numedges = header[5];
+        std::vector< std::vector<dReal> > vconfigs(numnodes, std::vector<dReal>(_dof));
+        std::vector<uint8_t> vnodestatus(numnodes), vedgestatus(numedges);
+        std::vector< std::pair<int,int> > vedges(numedges);
+        std::vector<dReal> vedgelengths(numedges);
+        FOREACH(itconfig,vconfigs) {
+            f.read((char*)&(*itconfig)[0],sizeof(dReal)*_dof);
+        }
+        if( numnodes > 0 ) {
+            f.read((char*)&vnodestatus[0],numnodes);
+        }
+        FOREACH(itedge,vedges) {
+            int32_t indices[2];
+            f.read((char*)indices,sizeof(indices));
+            if( indices[0] < 0 || indices[0] >= numnodes || indices[1] < 0 || indices[1] >= numnodes ) {
+                RAVELOG_WARN(str(boost::format("roadmap file %s is corrupted\n")%filename));
+                return false;
+            }
+            *itedge = std::make_pair(indices[0],indices[1]);
+        }
+        if( numedges > 0 ) {
+            f.read((char*)&vedgelengths[0],sizeof(dReal)*numedges);
+            f.read((char*)&vedgestatus[0],numedges);
+        }
+        uint32_t signaturelength = 0;
+        f.read((char*)&signaturelength,sizeof(signaturelength));
+        if( !f || signaturelength > filesize-minsize ) {
+            RAVELOG_WARN(str(boost::format("roadmap file %s is truncated\n")%filename));
+            return false;
+        }
+        std::string envsignature(signaturelength,0);
+        if( signaturelength > 0 ) {
+            f.read(&envsignature[0],signaturelength);
+        }
+        if( !f ) {
+            RAVELOG_WARN(str(boost::format("roadmap file %s is truncated\n")%filename));
+            return false;
+        }
+        // any other status would be taken as an already checked configuration and skip collision checking
+        FOREACHC(itstatus,vnodestatus) {
+            if( *itstatus > S_Invalid ) {
+                RAVELOG_WARN(str(boost::format("roadmap file %s is corrupted\n")%filename));
+                return false;
+            }
+        }
+        FOREACHC(itstatus,vedgestatus) {
+            if( *itstatus > S_Invalid ) {
+                RAVELOG_WARN(str(boost::format("roadmap file %s is corrupted\n")%filename));
+                return false;
+            }
+        }
+
+        _vconfigs.swap(vconfigs);
+        _vnodestatus.swap(vnodestatus);
+        _vedges.swap(vedges);
+        _vedgelengths.swap(vedgelengths);
+        _vedgestatus.swap(vedgestatus);
+        _envsignature.swap(envsignature);
+        _vadjacency.resize(0);
+        _vadjacency.resize(numnodes);
+        for(int iedge = 0; iedge < numedges; ++iedge) {
+            _vadjacency[_vedges[iedge].first].push_back(iedge);
+            _vadjacency[_vedges[iedge].second].push_back(iedge);
+        }
+        _bModified = false;
+        return true;
+    }
+
+    std::string _key; ///< md5 hash of the robot kinematics and the planning parameters
+    int _dof;
+    std::vector< std::vector<dReal> > _vconfigs;
+    std::vector<uint8_t> _vnodestatus;
+    std::vector< std::pair<int,int> > _vedges;
+    std::vector<dReal> _vedgelengths;
+    std::vector<uint8_t> _vedgestatus;
+    std::vector< std::vector<int> > _vadjacency; ///< edge indices of every node, recomputed when loading
+
+    std::string _envsignature; ///< signature of the environment the statuses were computed in
+    std::vector< std::pair<KinBodyWeakPtr,int> > _vbodystamps; ///< obstacles and their update stamps used to compute the obstacle part of the signature
+    std::string _obstaclesignature; ///< cached signature of the obstacles, only recomputed when _vbodystamps change
+    bool _bModified; ///< true if the roadmap changed since it was last saved
+    boost::mutex _mutex; ///< held by a planner for the whole query
+
+    static const uint32_t s_nMagic = 0x4d525052; // "RPRM"
+    static const uint32_t s_nVersion = 1;
+};
+
+typedef boost::shared_ptr<LazyRoadmap> LazyRoadmapPtr;
+
+class LazyPRMPlanner : public PlannerBase
+{
+public:
+    class LazyPRMParameters : public PlannerBase::PlannerParameters
+    {
+public:
+        LazyPRMParameters() : _nRoadmapSize(1000), _nExpansionSize(500), _nMaxRoadmapSize(10000), _nNumNeighbors(10), _bSaveRoadmap(true), _bProcessing(false) {
+            _vXMLParameters.push_back("roadmapsize");
+            _vXMLParameters.push_back("expansionsize");
+            _vXMLParameters.push_back("maxroadmapsize");
+            _vXMLParameters.push_back("numneighbors");
+            _vXMLParameters.push_back("saveroadmap");
+        }
+
+        int _nRoadmapSize; ///< number of nodes sampled when the roadmap is first created
+        int _nExpansionSize; ///< number of nodes added every time the roadmap cannot connect the query
+        int _nMaxRoadmapSize; ///< the roadmap is not expanded past this many nodes
+        int _nNumNeighbors; ///< every new node is connected to this many nearest nodes
+        bool _bSaveRoadmap; ///< if true, the roadmap is saved in the home directory after every query that modified it
+
+protected:
+        bool _bProcessing;
+        virtual bool serialize(std::ostream& O) const
+        {
+            if( !PlannerParameters::serialize(O) ) {
+                return false;
+            }
+            O << "<roadmapsize>" << _nRoadmapSize << "</roadmapsize>" << endl;
+            O << "<expansionsize>" << _nExpansionSize << "</expansionsize>" << endl;
+            O << "<maxroadmapsize>" << _nMaxRoadmapSize << "</maxroadmapsize>" << endl;
+            O << "<numneighbors>" << _nNumNeighbors << "</numneighbors>" << endl;
+            O << "<saveroadmap>" << _bSaveRoadmap << "</saveroadmap>" << endl;
+            return !!O;
+        }
+
+        ProcessElement startElement(const std::string& name, const AttributesList& atts)
+        {
+            if( _bProcessing ) {
+                return PE_Ignore;
+            }
+            switch( PlannerBase::PlannerParameters::startElement(name,atts) ) {
+            case PE_Pass: break;
+            case PE_Support: return PE_Support;
+            case PE_Ignore: return PE_Ignore;
+            }
+            _bProcessing = name=="roadmapsize"||name=="expansionsize"||name=="maxroadmapsize"||name=="numneighbors"||name=="saveroadmap";
+            return _bProcessing ? PE_Support : PE_Pass;
+        }
+
+        virtual bool endElement(const string& name)
+        {
+            if( _bProcessing ) {
+                if( name == "roadmapsize") {
+                    _ss >> _nRoadmapSize;
+                }
+                else if( name == "expansionsize") {
+                    _ss >> _nExpansionSize;
+                }
+                else if( name == "maxroadmapsize") {
+                    _ss >> _nMaxRoadmapSize;
+                }
+                else if( name == "numneighbors") {
+                    _ss >> _nNumNeighbors;
+                }
+                else if( name == "saveroadmap") {
+                    _ss >> _bSaveRoadmap;
+                }
+                else {
+                    RAVELOG_WARN(str(boost::format("unknown tag %s\n")%name));
+                }
+                _bProcessing = false;
+                return false;
+            }
+            // give a chance for the default parameters to get processed
+            return PlannerParameters::endElement(name);
+        }
+    };
+    typedef boost::shared_ptr<LazyPRMParameters> LazyPRMParametersPtr;
+
+    LazyPRMPlanner(EnvironmentBasePtr penv, std::istream& sinput) : PlannerBase(penv)
+    {
+        __description = "\
+:Interface Author: Rosen Diankov\n\n\
+Lazy Probabilistic Roadmap planner for robots that repeatedly plan in the same environment. See\n\n\
+- R. Bohlin and L.E. Kavraki. Path planning using lazy PRM. In Proc. IEEE Int'l Conf. on Robotics and Automation (ICRA'2000), pages 521-528, 2000.\n\n\
+The roadmap is built once for every robot kinematics/geometry hash and planning configuration, shared by all planners of the process, and saved in the OpenRAVE home directory so that it can be reused across processes. Nodes and edges are only checked for collisions when they are part of a candidate shortest path, and the results are kept until the environment changes. Changes are detected from the update stamps of the bodies. The constraint functions of the parameters have to be the same for all queries of a roadmap, otherwise call ClearRoadmap.";
+        RegisterCommand("ClearRoadmap",boost::bind(&LazyPRMPlanner::ClearRoadmapCommand,this,_1,_2),
+                        "removes the roadmap of the current parameters from memory and disk");
+        RegisterCommand("GetRoadmapInfo",boost::bind(&LazyPRMPlanner::GetRoadmapInfoCommand,this,_1,_2),
+                        "returns the number of nodes, edges, valid nodes, invalid nodes, valid edges, and invalid edges of the roadmap");
+    }
+    virtual ~LazyPRMPlanner() {
+    }
+
+    virtual bool InitPlan(RobotBasePtr pbase, PlannerParametersConstPtr pparams)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        _roadmap.reset();
+        _parameters.reset(new LazyPRMParameters());
+        _parameters->copy(pparams);
+        _robot = pbase;
+        int dof = _parameters->GetDOF();
+        if( dof == 0 || (_parameters->vinitialconfig.size() % dof) != 0 || (_parameters->vgoalconfig.size() % dof) != 0 ) {
+            RAVELOG_ERROR("LazyPRMPlanner::InitPlan - Error: initial and goal configurations are improperly specified\n");
+            _parameters.reset();
+            return false;
+        }
+        if( _parameters->vinitialconfig.size() == 0 || _parameters->vgoalconfig.size() == 0 ) {
+            RAVELOG_WARN("no initial or goal configurations specified\n");
+            _parameters.reset();
+            return false;
+        }
+        if( _parameters->_nNumNeighbors <= 0 || _parameters->_nRoadmapSize <= 0 ) {
+            RAVELOG_WARN("number of neighbors and roadmap size have to be positive\n");
+            _parameters.reset();
+            return false;
+        }
+
+        std::string key = _GetRoadmapKey();
+        _roadmapfilename = RaveGetHomeDirectory() + string("/lazyprm.") + key + string(".roadmap");
+        _roadmap = _GetRoadmap(key, dof, _parameters->_bSaveRoadmap ? _roadmapfilename : std::string());
+        RAVELOG_DEBUG(str(boost::format("LazyPRMPlanner::InitPlan - roadmap %s has %d nodes\n")%_roadmap->_key%_roadmap->GetNumNodes()));
+        return true;
+    }
+
+    virtual PlannerStatus PlanPath(TrajectoryBasePtr ptraj)
+    {
+        if( !_parameters ) {
+            RAVELOG_ERROR("LazyPRMPlanner::PlanPath - Error, planner not initialized\n");
+            return PS_Failed;
+        }
+
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        boost::mutex::scoped_lock lockroadmap(_roadmap->_mutex);
+        uint32_t basetime = utils::GetMilliTime();
+        PlannerParameters::StateSaver savestate(_parameters);
+        CollisionOptionsStateSaver optionstate(GetEnv()->GetCollisionChecker(),GetEnv()->GetCollisionChecker()->GetCollisionOptions()|CO_ActiveDOFs,false);
+
+        _UpdateEnvironmentSignature();
+        if( _roadmap->GetNumNodes() == 0 ) {
+            _ExpandRoadmap(_parameters->_nRoadmapSize);
+        }
+
+        int dof = _parameters->GetDOF();
+        std::vector<dReal> q(dof);
+        std::vector< std::vector<dReal> > vinitials, vgoals;
+        for(size_t i = 0; i < _parameters->vinitialconfig.size(); i += dof) {
+            std::copy(_parameters->vinitialconfig.begin()+i,_parameters->vinitialconfig.begin()+i+dof,q.begin());
+            if( _parameters->_checkpathconstraintsfn(q,q,IT_OpenStart,ConfigurationListPtr()) ) {
+                vinitials.push_back(q);
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("initial configuration %d fails constraints\n")%(i/dof)));
+            }
+        }
+        for(size_t i = 0; i < _parameters->vgoalconfig.size(); i += dof) {
+            std::copy(_parameters->vgoalconfig.begin()+i,_parameters->vgoalconfig.begin()+i+dof,q.begin());
+            if( _parameters->_checkpathconstraintsfn(q,q,IT_OpenStart,ConfigurationListPtr()) ) {
+                vgoals.push_back(q);
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("goal configuration %d fails constraints\n")%(i/dof)));
+            }
+        }
+        if( vinitials.size() == 0 || vgoals.size() == 0 ) {
+            return PS_Failed;
+        }
+
+        std::vector<int> vpath;
+        PlannerStatus status = PS_Failed;
+        PlannerProgress progress;
+        int numchecks = 0;
+        while(1) {
+            int numroadmapnodes = _roadmap->GetNumNodes(), numroadmapedges = _roadmap->GetNumEdges();
+            _AddQueryNodes(vinitials,vgoals);
+            int nsearchstatus = _SearchLazy(numroadmapnodes, (int)vinitials.size(), (int)vgoals.size(), vpath, numchecks, progress);
+            if( nsearchstatus > 0 ) {
+                std::vector<dReal> vdata; vdata.reserve(vpath.size()*dof);
+                FOREACHC(itnode,vpath) {
+                    const std::vector<dReal>& qnode = _roadmap->_vconfigs.at(*itnode);
+                    vdata.insert(vdata.end(),qnode.begin(),qnode.end());
+                }
+                if( ptraj->GetConfigurationSpecification().GetDOF() == 0 ) {
+                    ptraj->Init(_parameters->_configurationspecification);
+                }
+                ptraj->Insert(ptraj->GetNumWaypoints(),vdata,_parameters->_configurationspecification);
+                status = PS_HasSolution;
+            }
+            _roadmap->Truncate(numroadmapnodes,numroadmapedges);
+            if( nsearchstatus > 0 ) {
+                break;
+            }
+            if( nsearchstatus < 0 ) {
+                status = PS_Interrupted;
+                break;
+            }
+            // the roadmap does not connect the query, so add more nodes
+            int numnewnodes = min(_parameters->_nExpansionSize, _parameters->_nMaxRoadmapSize-_roadmap->GetNumNodes());
+            if( numnewnodes <= 0 ) {
+                RAVELOG_WARN(str(boost::format("roadmap reached maximum size of %d nodes\n")%_parameters->_nMaxRoadmapSize));
+                break;
+            }
+            _ExpandRoadmap(numnewnodes);
+        }
+
+        if( _roadmap->_bModified && _parameters->_bSaveRoadmap ) {
+            if( _roadmap->Save(_roadmapfilename) ) {
+                _roadmap->_bModified = false;
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("failed to save roadmap to %s\n")%_roadmapfilename));
+            }
+        }
+
+        if( status != PS_HasSolution ) {
+            RAVELOG_WARN(str(boost::format("plan failed, %d checks, %fs\n")%numchecks%(0.001f*(float)(utils::GetMilliTime()-basetime))));
+            return status;
+        }
+        RAVELOG_DEBUG(str(boost::format("plan success, path=%d points with %d checks on a roadmap of %d nodes in %fs\n")%ptraj->GetNumWaypoints()%numchecks%_roadmap->GetNumNodes()%(0.001f*(float)(utils::GetMilliTime()-basetime))));
+        return _ProcessPostPlanners(_robot,ptraj);
+    }
+
+    virtual PlannerParametersConstPtr GetParameters() const {
+        return _parameters;
+    }
+
+    bool ClearRoadmapCommand(std::ostream& os, std::istream& is)
+    {
+        if( !_roadmap ) {
+            return false;
+        }
+        {
+            boost::mutex::scoped_lock lock(GetRoadmapMutex());
+            GetRoadmaps().erase(_roadmap->_key);
+        }
+        std::remove(_roadmapfilename.c_str());
+        // start a new roadmap so that this planner can still be used
+        _roadmap.reset(new LazyRoadmap(_roadmap->_key,_roadmap->_dof));
+        boost::mutex::scoped_lock lock(GetRoadmapMutex());
+        GetRoadmaps()[_roadmap->_key] = _roadmap;
+        return true;
+    }
+
+    bool GetRoadmapInfoCommand(std::ostream& os, std::istream& is)
+    {
+        if( !_roadmap ) {
+            return false;
+        }
+        boost::mutex::scoped_lock lock(_roadmap->_mutex);
+        int numstatus[2][3] = { { 0, 0, 0}, { 0, 0, 0}};
+        FOREACHC(it,_roadmap->_vnodestatus) {
+            numstatus[0][*it]++;
+        }
+        FOREACHC(it,_roadmap->_vedgestatus) {
+            numstatus[1][*it]++;
+        }
+        os << _roadmap->GetNumNodes() << " " << _roadmap->GetNumEdges() << " " << numstatus[0][LazyRoadmap::S_Valid] << " " << numstatus[0][LazyRoadmap::S_Invalid] << " " << numstatus[1][LazyRoadmap::S_Valid] << " " << numstatus[1][LazyRoadmap::S_Invalid];
+        return true;
+    }
+
+protected:
+    static boost::mutex& GetRoadmapMutex() {
+        static boost::mutex s_mutex;
+        return s_mutex;
+    }
+    static const size_t s_nMaxRoadmaps = 16; ///< roadmaps kept in memory when no planner uses them
+    static std::map<std::string, LazyRoadmapPtr>& GetRoadmaps() {
+        static std::map<std::string, LazyRoadmapPtr> s_mapRoadmaps;
+        return s_mapRoadmaps;
+    }
+
+    /// \brief returns the shared roadmap of key, loads it from filename if it is not in memory yet
+    static LazyRoadmapPtr _GetRoadmap(const std::string& key, int dof, const std::string& filename)
+    {
+        boost::mutex::scoped_lock lock(GetRoadmapMutex());
+        std::map<std::string, LazyRoadmapPtr>::iterator it = GetRoadmaps().find(key);
+        if( it != GetRoadmaps().end() ) {
+            return it->second;
+        }
+        LazyRoadmapPtr roadmap(new LazyRoadmap(key,dof));
+        if( filename.size() > 0 && roadmap->Load(filename) ) {
+            RAVELOG_DEBUG(str(boost::format("loaded roadmap %s with %d nodes\n")%filename%roadmap->GetNumNodes()));
+        }
+        if( GetRoadmaps().size() >= s_nMaxRoadmaps ) {
+            // drop the roadmaps that no planner uses, they are saved after every query unless saving is disabled and are loaded again when needed
+            for(it = GetRoadmaps().begin(); it != GetRoadmaps().end(); ) {
+                if( it->second.unique() ) {
+                    GetRoadmaps().erase(it++);
+                }
+                else {
+                    ++it;
+                }
+            }
+        }
+        GetRoadmaps()[key] = roadmap;
+        return roadmap;
+    }
+
+    /// \brief the roadmap depends on the robot kinematics and geometry, the planning space, and the parameters that change the edges
+    std::string _GetRoadmapKey() const
+    {
+        std::stringstream ss;
+        ss << std::setprecision(std::numeric_limits<dReal>::digits10+1);
+        ss << _robot->GetKinematicsGeometryHash() << " " << _parameters->_configurationspecification << " " << _parameters->_nNumNeighbors << " ";
+        FOREACHC(it,_parameters->_vConfigLowerLimit) {
+            ss << *it << " ";
+        }
+        FOREACHC(it,_parameters->_vConfigUpperLimit) {
+            ss << *it << " ";
+        }
+        FOREACHC(it,_parameters->_vConfigResolution) {
+            ss << *it << " ";
+        }
+        return utils::GetMD5HashString(ss.str());
+    }
+
+    /// \brief resets the collision status of the roadmap if the environment changed since it was computed
+    ///
+    /// The obstacle part of the signature is only recomputed when the obstacles or their update stamps change. The obstacles
+    /// are compared by identity since the roadmap is shared by all environments, and cloned or reset environments reuse the
+    /// same environment ids and stamps. The robot part covers the DOFs that are not planned and the grabbed bodies.
+    void _UpdateEnvironmentSignature()
+    {
+        std::vector<KinBodyPtr> vbodies, vgrabbed;
+        GetEnv()->GetBodies(vbodies);
+        _robot->GetGrabbed(vgrabbed);
+        bool bobstacleschanged = _roadmap->_obstaclesignature.size() == 0;
+        size_t iobstacle = 0;
+        FOREACHC(itbody,vbodies) {
+            if( *itbody != _robot && find(vgrabbed.begin(),vgrabbed.end(),*itbody) == vgrabbed.end() ) {
+                // an expired body never compares equal, so the address of a deleted body cannot be mistaken for a new one
+                if( iobstacle >= _roadmap->_vbodystamps.size() || _roadmap->_vbodystamps[iobstacle].first.lock() != *itbody || _roadmap->_vbodystamps[iobstacle].second != (*itbody)->GetUpdateStamp() ) {
+                    bobstacleschanged = true;
+                }
+                ++iobstacle;
+            }
+        }
+        bobstacleschanged |= iobstacle != _roadmap->_vbodystamps.size();
+
+        std::stringstream ss;
+        if( bobstacleschanged ) {
+            _roadmap->_vbodystamps.resize(0);
+            std::vector<dReal> vvalues;
+            FOREACHC(itbody,vbodies) {
+                if( *itbody != _robot && find(vgrabbed.begin(),vgrabbed.end(),*itbody) == vgrabbed.end() ) {
+                    (*itbody)->GetDOFValues(vvalues);
+                    _roadmap->_vbodystamps.push_back(std::make_pair(KinBodyWeakPtr(*itbody),(*itbody)->GetUpdateStamp()));
+                    ss << (*itbody)->GetName() << " " << (*itbody)->GetKinematicsGeometryHash() << " " << (*itbody)->IsEnabled() << " ";
+                    _SerializeTransform(ss,(*itbody)->GetTransform());
+                    FOREACHC(itvalue,vvalues) {
+                        _SerializeValue(ss,*itvalue);
+                    }
+                }
+            }
+            _roadmap->_obstaclesignature = utils::GetMD5HashString(ss.str());
+            ss.str("");
+        }
+
+        std::vector<dReal> vvalues;
+        _robot->GetDOFValues(vvalues);
+        const std::vector<int>& vactiveindices = _robot->GetActiveDOFIndices();
+        for(size_t i = 0; i < vvalues.size(); ++i) {
+            if( find(vactiveindices.begin(),vactiveindices.end(),(int)i) == vactiveindices.end() ) {
+                _SerializeValue(ss,vvalues[i]);
+            }
+        }
+        if( _robot->GetAffineDOF() == 0 ) {
+            _SerializeTransform(ss,_robot->GetTransform());
+        }
+        FOREACHC(itgrabbed,vgrabbed) {
+            KinBody::LinkPtr plink = _robot->IsGrabbing(*itgrabbed);
+            if( !!plink ) {
+                ss << (*itgrabbed)->GetName() << " " << (*itgrabbed)->GetKinematicsGeometryHash() << " " << plink->GetIndex() << " ";
+                _SerializeTransform(ss,plink->GetTransform().inverse()*(*itgrabbed)->GetTransform());
+            }
+        }
+        std::string envsignature = _roadmap->_obstaclesignature + utils::GetMD5HashString(ss.str());
+        if( envsignature != _roadmap->_envsignature ) {
+            if( _roadmap->_envsignature.size() > 0 ) {
+                RAVELOG_DEBUG("environment changed, resetting roadmap collision status\n");
+            }
+            _roadmap->ResetStatus();
+            _roadmap->_envsignature = envsignature;
+            _roadmap->_bModified = true;
+        }
+    }
+
+    /// \brief values are rounded so that numerical noise from restoring the robot state does not change the signature
+    static void _SerializeValue(std::ostream& O, dReal f)
+    {
+        O << (long long)std::floor(f*1e6+0.5) << " ";
+    }
+
+    static void _SerializeTransform(std::ostream& O, const Transform& t)
+    {
+        for(int i = 0; i < 4; ++i) {
+            _SerializeValue(O,t.rot[i]);
+        }
+        for(int i = 0; i < 3; ++i) {
+            _SerializeValue(O,t.trans[i]);
+        }
+    }
+
+    /// \brief returns the indices of the numneighbors nearest roadmap nodes among the first numnodes nodes that are not known to be invalid
+    void _GetNearestNodes(const std::vector<dReal>& q, int numnodes, int numneighbors, std::vector< std::pair<dReal,int> >& vnearest)
+    {
+        vnearest.resize(0);
+        for(int inode = 0; inode < numnodes; ++inode) {
+            if( _roadmap->_vnodestatus[inode] != LazyRoadmap::S_Invalid ) {
+                vnearest.push_back(make_pair(_parameters->_distmetricfn(q,_roadmap->_vconfigs[inode]),inode));
+            }
+        }
+        if( (int)vnearest.size() > numneighbors ) {
+            std::nth_element(vnearest.begin(),vnearest.begin()+numneighbors,vnearest.end());
+            vnearest.resize(numneighbors);
+        }
+    }
+
+    /// \brief samples new nodes and connects every one to its nearest nodes, no collisions are checked
+    void _ExpandRoadmap(int numnodes)
+    {
+        std::vector<dReal> q;
+        std::vector< std::pair<dReal,int> > vnearest;
+        int numadded = 0;
+        for(int itry = 0; itry < 2*numnodes && numadded < numnodes; ++itry) {
+            if( !_parameters->_samplefn(q) ) {
+                continue;
+            }
+            _GetNearestNodes(q,_roadmap->GetNumNodes(),_parameters->_nNumNeighbors,vnearest);
+            int inode = _roadmap->AddNode(q);
+            FOREACHC(itnearest,vnearest) {
+                _roadmap->AddEdge(itnearest->second,inode,itnearest->first);
+            }
+            ++numadded;
+        }
+        _roadmap->_bModified = true;
+        RAVELOG_DEBUG(str(boost::format("added %d nodes, roadmap has %d nodes and %d edges\n")%numadded%_roadmap->GetNumNodes()%_roadmap->GetNumEdges()));
+    }
+
+    /// \brief adds the initial and goal configurations as temporary nodes after the roadmap nodes
+    ///
+    /// They are connected to their nearest roadmap nodes and directly to each other, so that a free straight line is found right away.
+    void _AddQueryNodes(const std::vector< std::vector<dReal> >& vinitials, const std::vector< std::vector<dReal> >& vgoals)
+    {
+        int numroadmapnodes = _roadmap->GetNumNodes();
+        std::vector< std::pair<dReal,int> > vnearest;
+        std::vector<int> vgoalnodes;
+        FOREACHC(itinitial,vinitials) {
+            _GetNearestNodes(*itinitial,numroadmapnodes,_parameters->_nNumNeighbors,vnearest);
+            int inode = _roadmap->AddNode(*itinitial);
+            _roadmap->_vnodestatus[inode] = LazyRoadmap::S_Valid;
+            FOREACHC(itnearest,vnearest) {
+                _roadmap->AddEdge(itnearest->second,inode,itnearest->first);
+            }
+        }
+        FOREACHC(itgoal,vgoals) {
+            _GetNearestNodes(*itgoal,numroadmapnodes,_parameters->_nNumNeighbors,vnearest);
+            int inode = _roadmap->AddNode(*itgoal);
+            _roadmap->_vnodestatus[inode] = LazyRoadmap::S_Valid;
+            FOREACHC(itnearest,vnearest) {
+                _roadmap->AddEdge(itnearest->second,inode,itnearest->first);
+            }
+            for(size_t iinitial = 0; iinitial < vinitials.size(); ++iinitial) {
+                _roadmap->AddEdge(numroadmapnodes+iinitial,inode,_parameters->_distmetricfn(vinitials[iinitial],*itgoal));
+            }
+        }
+    }
+
+    /// \brief finds the shortest path from any initial node to any goal node that does not use known invalid nodes or edges
+    ///
+    /// \param[out] vpath the nodes of the path, starting with an initial node
+    /// \param[out] vpathedges the edges between consecutive nodes of vpath
+    /// \return true if a path was found
+    bool _SearchShortestPath(int istartnode, int numinitials, int numgoals, std::vector<int>& vpath, std::vector<int>& vpathedges)
+    {
+        int numnodes = _roadmap->GetNumNodes();
+        int igoalstart = istartnode+numinitials;
+        std::vector<dReal> vcost(numnodes, std::numeric_limits<dReal>::infinity());
+        std::vector<int> vparentedge(numnodes,-1);
+        std::vector<uint8_t> vclosed(numnodes,0);
+        // A* with the distance to the nearest goal as the heuristic, the priority queue stores negated costs to pop the smallest first
+        std::priority_queue< std::pair<dReal,int> > queue;
+        for(int i = 0; i < numinitials; ++i) {
+            vcost[istartnode+i] = 0;
+            queue.push(make_pair(-_GetHeuristic(istartnode+i,igoalstart,numgoals),istartnode+i));
+        }
+        int ifoundgoal = -1;
+        while(!queue.empty()) {
+            int inode = queue.top().second;
+            queue.pop();
+            if( vclosed[inode] ) {
+                continue;
+            }
+            vclosed[inode] = 1;
+            if( inode >= igoalstart ) {
+                ifoundgoal = inode;
+                break;
+            }
+            FOREACHC(itedge,_roadmap->_vadjacency[inode]) {
+                if( _roadmap->_vedgestatus[*itedge] == LazyRoadmap::S_Invalid ) {
+                    continue;
+                }
+                const std::pair<int,int>& edge = _roadmap->_vedges[*itedge];
+                int ichild = edge.first == inode ? edge.second : edge.first;
+                if( vclosed[ichild] || _roadmap->_vnodestatus[ichild] == LazyRoadmap::S_Invalid ) {
+                    continue;
+                }
+                dReal fcost = vcost[inode] + _roadmap->_vedgelengths[*itedge];
+                if( fcost < vcost[ichild] ) {
+                    vcost[ichild] = fcost;
+                    vparentedge[ichild] = *itedge;
+                    queue.push(make_pair(-fcost-_GetHeuristic(ichild,igoalstart,numgoals),ichild));
+                }
+            }
+        }
+        if( ifoundgoal < 0 ) {
+            return false;
+        }
+
+        vpath.resize(0);
+        vpathedges.resize(0);
+        int inode = ifoundgoal;
+        vpath.push_back(inode);
+        while(vparentedge[inode] >= 0) {
+            int iedge = vparentedge[inode];
+            vpathedges.push_back(iedge);
+            inode = _roadmap->_vedges[iedge].first == inode ? _roadmap->_vedges[iedge].second : _roadmap->_vedges[iedge].first;
+            vpath.push_back(inode);
+        }
+        std::reverse(vpath.begin(),vpath.end());
+        std::reverse(vpathedges.begin(),vpathedges.end());
+        return true;
+    }
+
+    inline dReal _GetHeuristic(int inode, int igoalstart, int numgoals)
+    {
+        dReal fmin = std::numeric_limits<dReal>::infinity();
+        for(int i = 0; i < numgoals; ++i) {
+            fmin = min(fmin,_parameters->_distmetricfn(_roadmap->_vconfigs[inode],_roadmap->_vconfigs[igoalstart+i]));
+        }
+        return fmin;
+    }
+
+    /// \brief repeatedly searches for the shortest path and validates it until a collision-free one is found
+    ///
+    /// \return 1 if a path was found, 0 if the roadmap does not connect the query, -1 if interrupted
+    int _SearchLazy(int istartnode, int numinitials, int numgoals, std::vector<int>& vpath, int& numchecks, PlannerProgress& progress)
+    {
+        std::vector<int> vpathedges;
+        while(_SearchShortestPath(istartnode,numinitials,numgoals,vpath,vpathedges)) {
+            if( _CallCallbacks(progress) == PA_Interrupt ) {
+                return -1;
+            }
+            // nodes are cheaper than edges, so check them first
+            bool bvalid = true;
+            FOREACHC(itnode,vpath) {
+                uint8_t& status = _roadmap->_vnodestatus[*itnode];
+                if( status == LazyRoadmap::S_Unknown ) {
+                    const std::vector<dReal>& q = _roadmap->_vconfigs[*itnode];
+                    status = _parameters->_checkpathconstraintsfn(q,q,IT_OpenStart,ConfigurationListPtr()) ? LazyRoadmap::S_Valid : LazyRoadmap::S_Invalid;
+                    _roadmap->_bModified = true;
+                    ++numchecks;
+                }
+                if( status == LazyRoadmap::S_Invalid ) {
+                    bvalid = false;
+                    break;
+                }
+            }
+            if( !bvalid ) {
+                continue;
+            }
+            for(size_t i = 0; i < vpathedges.size(); ++i) {
+                uint8_t& status = _roadmap->_vedgestatus[vpathedges[i]];
+                if( status == LazyRoadmap::S_Unknown ) {
+                    status = _parameters->_checkpathconstraintsfn(_roadmap->_vconfigs[vpath[i]],_roadmap->_vconfigs[vpath[i+1]],IT_Open,ConfigurationListPtr()) ? LazyRoadmap::S_Valid : LazyRoadmap::S_Invalid;
+                    _roadmap->_bModified = true;
+                    ++numchecks;
+                }
+                if( status == LazyRoadmap::S_Invalid ) {
+                    bvalid = false;
+                    break;
+                }
+            }
+            if( bvalid ) {
+                return 1;
+            }
+        }
+        return 0;
+    }
+
+    LazyPRMParametersPtr _parameters;
+    RobotBasePtr _robot;
+    LazyRoadmapPtr _roadmap;
+    std::string _roadmapfilename;
+};
+
+PlannerBasePtr CreateLazyPRMPlanner(EnvironmentBasePtr penv, std::istream& sinput)
+{
+    return PlannerBasePtr(new LazyPRMPlanner(penv,sinput));
+}
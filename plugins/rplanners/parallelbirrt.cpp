@@ -0,0 +1,269 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2006-2012 Rosen Diankov <rosen.diankov@gmail.com>
+//
+// This file is part of OpenRAVE.
+// OpenRAVE is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#include "rrt.h"
+#include <openrave/planningutils.h>
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition.hpp>
+
+/// \brief runs several independently seeded BiRRTs in parallel and returns the first path found
+///
+/// Every thread plans in its own clone of the environment, so the threads never share collision checkers or bodies.
+/// The clones are kept between queries and updated incrementally in InitPlan.
+class ParallelBirrtPlanner : public PlannerBase
+{
+public:
+    ParallelBirrtPlanner(EnvironmentBasePtr penv) : PlannerBase(penv), _nNumThreads(max(1,(int)boost::thread::hardware_concurrency())), _goalindex(-1), _startindex(-1), _bCancel(false), _nSolvedThread(-1), _nFinishedThreads(0)
+    {
+        __description = "\
+:Interface Author:  Rosen Diankov\n\n\
+Runs several Bi-directional RRTs with different random seeds in parallel and returns the path of the first one that succeeds, the others are interrupted. Because the solve time of a single RRT has a long tail, this mostly reduces the worst-case planning times.\n\n\
+Each thread plans in its own clone of the environment. Only the active DOFs of the robot can be planned, and the constraint and sampling functions of the parameters are recreated for every clone, so custom functions are not used. Post-processing happens in the original environment.";
+        RegisterCommand("SetNumThreads",boost::bind(&ParallelBirrtPlanner::SetNumThreadsCommand,this,_1,_2),
+                        "sets the number of parallel planners, by default the number of cores");
+        RegisterCommand("GetGoalIndex",boost::bind(&ParallelBirrtPlanner::GetGoalIndexCommand,this,_1,_2),
+                        "returns the goal index of the plan");
+        RegisterCommand("GetInitGoalIndices",boost::bind(&ParallelBirrtPlanner::GetInitGoalIndicesCommand,this,_1,_2),
+                        "returns the start and goal indices");
+    }
+    virtual ~ParallelBirrtPlanner() {
+    }
+
+    virtual bool InitPlan(RobotBasePtr pbase, PlannerParametersConstPtr pparams)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        _parameters.reset(new RRTParameters());
+        _parameters->copy(pparams);
+        _robot = pbase;
+        _vplanners.resize(0);
+        _vthreadparameters.resize(0);
+        _vcallbackhandles.resize(0);
+        if( !(_parameters->_configurationspecification == _robot->GetActiveConfigurationSpecification()) ) {
+            RAVELOG_WARN(str(boost::format("parameters do not plan for the active DOFs of robot %s\n")%_robot->GetName()));
+            _parameters.reset();
+            return false;
+        }
+        if( !!_parameters->_samplegoalfn || !!_parameters->_sampleinitialfn ) {
+            RAVELOG_WARN("goal and initial sampling functions are not supported and will be ignored\n");
+        }
+
+        _vcloneenvs.resize(_nNumThreads);
+        uint32_t seed = RaveRandomInt();
+        for(int ithread = 0; ithread < _nNumThreads; ++ithread) {
+            if( !_vcloneenvs[ithread] ) {
+                _vcloneenvs[ithread] = GetEnv()->CloneSelf(Clone_Bodies);
+            }
+            else {
+                _vcloneenvs[ithread]->Clone(GetEnv(),Clone_Bodies);
+            }
+            EnvironmentBasePtr pcloneenv = _vcloneenvs[ithread];
+            EnvironmentMutex::scoped_lock lockclone(pcloneenv->GetMutex());
+            RobotBasePtr pclonerobot = pcloneenv->GetRobot(_robot->GetName());
+            if( !pclonerobot ) {
+                RAVELOG_WARN(str(boost::format("failed to find robot %s in cloned environment\n")%_robot->GetName()));
+                _parameters.reset();
+                return false;
+            }
+
+            RRTParametersPtr params(new RRTParameters());
+            params->copy(_parameters);
+            params->SetRobotActiveJoints(pclonerobot);
+            // SetRobotActiveJoints resets the configurations and limits
+            params->vinitialconfig = _parameters->vinitialconfig;
+            params->vgoalconfig = _parameters->vgoalconfig;
+            params->_vConfigLowerLimit = _parameters->_vConfigLowerLimit;
+            params->_vConfigUpperLimit = _parameters->_vConfigUpperLimit;
+            params->_vConfigVelocityLimit = _parameters->_vConfigVelocityLimit;
+            params->_vConfigAccelerationLimit = _parameters->_vConfigAccelerationLimit;
+            params->_vConfigResolution = _parameters->_vConfigResolution;
+            params->_samplegoalfn.clear();
+            params->_sampleinitialfn.clear();
+            params->_sPostProcessingPlanner = "";
+            params->_sPostProcessingParameters = "";
+
+            // every tree pair has to explore differently, so use a separate seed for the configuration samples
+            SpaceSamplerBasePtr pconfigsampler = RaveCreateSpaceSampler(pcloneenv,str(boost::format("robotconfiguration %s")%pclonerobot->GetName()));
+            pconfigsampler->SetSeed(seed+2*ithread);
+            boost::shared_ptr<planningutils::SimpleNeighborhoodSampler> defaultsamplefn(new planningutils::SimpleNeighborhoodSampler(pconfigsampler,params->_distmetricfn));
+            params->_samplefn = boost::bind(&planningutils::SimpleNeighborhoodSampler::Sample,defaultsamplefn,_1);
+            params->_sampleneighfn = boost::bind(&planningutils::SimpleNeighborhoodSampler::Sample,defaultsamplefn,_1,_2,_3);
+
+            boost::shared_ptr<BirrtPlanner> pplanner(new BirrtPlanner(pcloneenv));
+            if( !pplanner->InitPlan(pclonerobot,params) ) {
+                _vplanners.resize(0);
+                _vthreadparameters.resize(0);
+                _vcallbackhandles.resize(0);
+                _parameters.reset();
+                return false;
+            }
+            pplanner->SetRandomSeed(seed+2*ithread+1);
+            _vcallbackhandles.push_back(pplanner->RegisterPlanCallback(boost::bind(&ParallelBirrtPlanner::_CancelCallback,this,_1)));
+            _vplanners.push_back(pplanner);
+            _vthreadparameters.push_back(params);
+        }
+        RAVELOG_DEBUG(str(boost::format("ParallelBirrtPlanner::InitPlan - initialized %d planners\n")%_nNumThreads));
+        return true;
+    }
+
+    virtual PlannerStatus PlanPath(TrajectoryBasePtr ptraj)
+    {
+        _goalindex = -1;
+        _startindex = -1;
+        if( !_parameters ) {
+            RAVELOG_ERROR("ParallelBirrtPlanner::PlanPath - Error, planner not initialized\n");
+            return PS_Failed;
+        }
+
+        uint32_t basetime = utils::GetMilliTime();
+        vector<TrajectoryBasePtr> vtrajectories(_vplanners.size());
+        for(size_t ithread = 0; ithread < _vplanners.size(); ++ithread) {
+            vtrajectories[ithread] = RaveCreateTrajectory(_vcloneenvs[ithread],"");
+        }
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            _bCancel = false;
+            _nSolvedThread = -1;
+            _nFinishedThreads = 0;
+        }
+        vector<boost::shared_ptr<boost::thread> > vthreads(_vplanners.size());
+        for(size_t ithread = 0; ithread < _vplanners.size(); ++ithread) {
+            vthreads[ithread].reset(new boost::thread(boost::bind(&ParallelBirrtPlanner::_PlanThread,this,ithread,vtrajectories[ithread])));
+        }
+
+        // wait for the first solution, the callbacks of this planner can interrupt all the threads
+        PlannerProgress progress;
+        bool bInterrupted = false;
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            while(_nSolvedThread < 0 && _nFinishedThreads < (int)vthreads.size()) {
+                _condFinished.timed_wait(lock,boost::posix_time::milliseconds(10));
+                if( _nSolvedThread < 0 && _nFinishedThreads < (int)vthreads.size() ) {
+                    lock.unlock();
+                    PlannerAction action = _CallCallbacks(progress);
+                    lock.lock();
+                    if( action == PA_Interrupt ) {
+                        bInterrupted = true;
+                        break;
+                    }
+                }
+            }
+            _bCancel = true;
+        }
+        FOREACH(itthread,vthreads) {
+            (*itthread)->join();
+        }
+
+        if( _nSolvedThread < 0 ) {
+            if( bInterrupted ) {
+                return PS_Interrupted;
+            }
+            RAVELOG_WARN("plan failed, %fs\n",0.001f*(float)(utils::GetMilliTime()-basetime));
+            return PS_Failed;
+        }
+
+        stringstream ssin, ssout;
+        ssin << "GetInitGoalIndices";
+        if( _vplanners.at(_nSolvedThread)->SendCommand(ssout,ssin) ) {
+            ssout >> _startindex >> _goalindex;
+        }
+
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        TrajectoryBasePtr psolvedtraj = vtrajectories.at(_nSolvedThread);
+        vector<dReal> vdata;
+        psolvedtraj->GetWaypoints(0,psolvedtraj->GetNumWaypoints(),vdata,_parameters->_configurationspecification);
+        if( ptraj->GetConfigurationSpecification().GetDOF() == 0 ) {
+            ptraj->Init(_parameters->_configurationspecification);
+        }
+        ptraj->Insert(ptraj->GetNumWaypoints(),vdata,_parameters->_configurationspecification);
+        RAVELOG_DEBUG(str(boost::format("plan success from thread %d, path=%d points in %fs\n")%_nSolvedThread%ptraj->GetNumWaypoints()%(0.001f*(float)(utils::GetMilliTime()-basetime))));
+        return _ProcessPostPlanners(_robot,ptraj);
+    }
+
+    virtual PlannerParametersConstPtr GetParameters() const {
+        return _parameters;
+    }
+
+    bool SetNumThreadsCommand(std::ostream& os, std::istream& is)
+    {
+        int numthreads = 0;
+        is >> numthreads;
+        if( !is || numthreads <= 0 ) {
+            return false;
+        }
+        _nNumThreads = numthreads;
+        return true;
+    }
+
+    bool GetGoalIndexCommand(std::ostream& os, std::istream& is)
+    {
+        os << _goalindex;
+        return !!os;
+    }
+
+    bool GetInitGoalIndicesCommand(std::ostream& os, std::istream& is)
+    {
+        os << _startindex << " " << _goalindex;
+        return !!os;
+    }
+
+protected:
+    void _PlanThread(size_t ithread, TrajectoryBasePtr ptraj)
+    {
+        PlannerStatus status = PS_Failed;
+        try {
+            status = _vplanners.at(ithread)->PlanPath(ptraj);
+        }
+        catch(const std::exception& ex) {
+            RAVELOG_WARN(str(boost::format("planner thread %d failed: %s\n")%ithread%ex.what()));
+        }
+        boost::mutex::scoped_lock lock(_mutex);
+        if( status == PS_HasSolution && _nSolvedThread < 0 ) {
+            _nSolvedThread = ithread;
+            _bCancel = true;
+        }
+        ++_nFinishedThreads;
+        _condFinished.notify_all();
+    }
+
+    PlannerAction _CancelCallback(const PlannerProgress& progress)
+    {
+        boost::mutex::scoped_lock lock(_mutex);
+        return _bCancel ? PA_Interrupt : PA_None;
+    }
+
+    RRTParametersPtr _parameters;
+    RobotBasePtr _robot;
+    int _nNumThreads;
+    int _goalindex, _startindex;
+
+    std::vector<EnvironmentBasePtr> _vcloneenvs; ///< one clone per thread, kept between queries so that they can be updated incrementally
+    std::vector<PlannerBasePtr> _vplanners;
+    std::vector<RRTParametersPtr> _vthreadparameters; ///< have to keep the parameters since the constraint functions only store weak pointers to them
+    std::vector<UserDataPtr> _vcallbackhandles;
+
+    boost::mutex _mutex;
+    boost::condition _condFinished;
+    bool _bCancel; ///< if true, all threads should stop planning
+    int _nSolvedThread; ///< the first thread that found a solution
+    int _nFinishedThreads;
+};
+
+PlannerBasePtr CreateParallelBirrtPlanner(EnvironmentBasePtr penv, std::istream& sinput)
+{
+    return PlannerBasePtr(new ParallelBirrtPlanner(penv));
+}
@@ -55,9 +55,11 @@
 
 #include <fstream>
 #include <iostream>
+#include <deque>
 
 #include <boost/assert.hpp>
 #include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
 
 using namespace std;
 using namespace OpenRAVE;
@@ -27,6 +27,8 @@ PlannerBasePtr CreateLinearTrajectoryRetimer(EnvironmentBasePtr penv, std::istre
 PlannerBasePtr CreateParabolicTrajectoryRetimer(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateParabolicSmoother(EnvironmentBasePtr penv, std::istream& sinput);
 PlannerBasePtr CreateConstraintParabolicSmoother(EnvironmentBasePtr penv, std::istream& sinput);
+PlannerBasePtr CreateParallelBirrtPlanner(EnvironmentBasePtr penv, std::istream& sinput);
+PlannerBasePtr CreateLazyPRMPlanner(EnvironmentBasePtr penv, std::istream& sinput);
 
 InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string& interfacename, std::istream& sinput, EnvironmentBasePtr penv)
 {
@@ -42,6 +44,12 @@ InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string&
             RAVELOG_WARN("rBiRRT is deprecated, use BiRRT\n");
             return InterfaceBasePtr(new BirrtPlanner(penv));
         }
+        else if( interfacename == "parallelbirrt") {
+            return CreateParallelBirrtPlanner(penv,sinput);
+        }
+        else if( interfacename == "lazyprm") {
+            return CreateLazyPRMPlanner(penv,sinput);
+        }
         else if( interfacename == "basicrrt") {
             return InterfaceBasePtr(new BasicRrtPlanner(penv));
         }
@@ -80,6 +88,8 @@ void GetPluginAttributesValidated(PLUGININFO& info)
 {
     info.interfacenames[PT_Planner].push_back("RAStar");
     info.interfacenames[PT_Planner].push_back("BiRRT");
+    info.interfacenames[PT_Planner].push_back("ParallelBiRRT");
+    info.interfacenames[PT_Planner].push_back("LazyPRM");
     info.interfacenames[PT_Planner].push_back("BasicRRT");
     info.interfacenames[PT_Planner].push_back("ExplorationRRT");
     info.interfacenames[PT_Planner].push_back("GraspGradient");
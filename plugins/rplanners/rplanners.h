@@ -65,6 +65,309 @@ struct SimpleNode
     vector<dReal> q; // the configuration immediately follows the struct
 };
 
+/// \brief nearest-neighbor index over the nodes of a SpatialTree
+///
+/// Indices refer to positions in the node vector of the tree. Nodes that have been deleted (set to NULL) are never returned.
+/// The index keeps references to the nodes and distance metric of its tree, so it cannot be copied.
+template <typename Node>
+class NearestNeighborIndexBase : private boost::noncopyable
+{
+public:
+    typedef boost::function<dReal(const std::vector<dReal>&, const std::vector<dReal>&)> DistMetricFn;
+
+    NearestNeighborIndexBase(const std::vector<Node*>& nodes, const DistMetricFn& distmetricfn) : _nodes(nodes), _distmetricfn(distmetricfn) {
+    }
+    virtual ~NearestNeighborIndexBase() {
+    }
+
+    /// \brief removes all indexed nodes
+    virtual void Reset() = 0;
+
+    /// \brief makes the node at index searchable
+    virtual void Add(int index) = 0;
+
+    /// \brief returns the index of the nearest node to q or -1 if no nodes are indexed
+    ///
+    /// \param[out] fbestdist the distance to the returned node
+    virtual int GetNN(const std::vector<dReal>& q, dReal& fbestdist) = 0;
+
+protected:
+    const std::vector<Node*>& _nodes;
+    const DistMetricFn& _distmetricfn; ///< owned by the tree, can be set after the index is created
+};
+
+/// \brief linear scan over all nodes, works with any user distance metric
+template <typename Node>
+class BruteForceNearestNeighbor : public NearestNeighborIndexBase<Node>
+{
+public:
+    BruteForceNearestNeighbor(const std::vector<Node*>& nodes, const typename NearestNeighborIndexBase<Node>::DistMetricFn& distmetricfn) : NearestNeighborIndexBase<Node>(nodes, distmetricfn) {
+    }
+
+    virtual void Reset() {
+        _vindices.resize(0);
+    }
+
+    virtual void Add(int index) {
+        _vindices.push_back(index);
+    }
+
+    virtual int GetNN(const std::vector<dReal>& q, dReal& fbestdist)
+    {
+        int ibest = -1;
+        fbestdist = 0;
+        FOREACHC(itindex, _vindices) {
+            Node* pnode = this->_nodes[*itindex];
+            if( !!pnode ) {
+                dReal f = this->_distmetricfn(q, pnode->q);
+                if(( ibest < 0) ||( f < fbestdist) ) {
+                    ibest = *itindex;
+                    fbestdist = f;
+                }
+            }
+        }
+        return ibest;
+    }
+
+private:
+    std::vector<int> _vindices;
+};
+
+/** \brief Geometric Near-neighbor Access Tree supporting incremental insertion.
+
+    Only uses the distance metric, so joint weights and circular joints are handled by whatever metric the planner
+    parameters provide. Pruning relies on the triangle inequality, if the metric does not satisfy it the returned
+    neighbor is only approximate. See
+
+    - S. Brin. Near neighbor search in large metric spaces. In Proc. 21st Conf. on Very Large Databases (VLDB), pages 574-584, 1995.
+ */
+template <typename Node>
+class GNATNearestNeighbor : public NearestNeighborIndexBase<Node>
+{
+public:
+    GNATNearestNeighbor(const std::vector<Node*>& nodes, const typename NearestNeighborIndexBase<Node>::DistMetricFn& distmetricfn, int degree=8, int maxleafsize=50) : NearestNeighborIndexBase<Node>(nodes, distmetricfn), _degree(degree), _maxleafsize(maxleafsize), _root(NULL) {
+        BOOST_ASSERT(_degree > 1 && _maxleafsize >= _degree);
+    }
+    virtual ~GNATNearestNeighbor() {
+        delete _root;
+    }
+
+    virtual void Reset() {
+        delete _root;
+        _root = NULL;
+    }
+
+    virtual void Add(int index)
+    {
+        if( !_root ) {
+            _root = new GNATNode(-1, std::vector<dReal>());
+        }
+        const std::vector<dReal>& q = this->_nodes.at(index)->q;
+        GNATNode* pnode = _root;
+        while(pnode->children.size() > 0) {
+            _ComputePivotDistances(pnode, q, _vtempdists);
+            size_t inearest = std::min_element(_vtempdists.begin(), _vtempdists.end()) - _vtempdists.begin();
+            pnode->UpdateRanges(inearest, _vtempdists);
+            pnode = pnode->children[inearest];
+        }
+        pnode->data.push_back(index);
+        if( (int)pnode->data.size() > _maxleafsize ) {
+            _Split(pnode);
+        }
+    }
+
+    virtual int GetNN(const std::vector<dReal>& q, dReal& fbestdist)
+    {
+        int ibest = -1;
+        fbestdist = std::numeric_limits<dReal>::infinity();
+        if( !!_root ) {
+            _Search(_root, q, ibest, fbestdist);
+        }
+        if( ibest < 0 ) {
+            fbestdist = 0;
+        }
+        return ibest;
+    }
+
+private:
+    struct GNATNode
+    {
+        GNATNode(int pivot, const std::vector<dReal>& qpivot) : pivot(pivot), qpivot(qpivot) {
+        }
+        ~GNATNode() {
+            FOREACH(itchild, children) {
+                delete *itchild;
+            }
+        }
+
+        /// \brief extends the ranges of child ichild to include a point with distances vdists to every child pivot
+        void UpdateRanges(size_t ichild, const std::vector<dReal>& vdists)
+        {
+            size_t numchildren = children.size();
+            for(size_t j = 0; j < numchildren; ++j) {
+                dReal* prange = &vranges[2*(ichild*numchildren+j)];
+                prange[0] = std::min(prange[0], vdists[j]);
+                prange[1] = std::max(prange[1], vdists[j]);
+            }
+        }
+
+        int pivot; ///< index of the pivot node, -1 for the root
+        std::vector<dReal> qpivot; ///< copy of the pivot configuration since the tree node can be deleted
+        std::vector<int> data; ///< node indices stored in the leaf
+        std::vector<GNATNode*> children;
+        /// [min,max] distances from the pivot of child j to all points in the subtree of child i, stored at 2*(i*children.size()+j)
+        std::vector<dReal> vranges;
+    };
+
+    void _ComputePivotDistances(GNATNode* pnode, const std::vector<dReal>& q, std::vector<dReal>& vdists)
+    {
+        vdists.resize(pnode->children.size());
+        for(size_t j = 0; j < pnode->children.size(); ++j) {
+            vdists[j] = this->_distmetricfn(q, pnode->children[j]->qpivot);
+        }
+    }
+
+    /// \brief converts a leaf into an inner node by picking well separated pivots and distributing the data among them
+    void _Split(GNATNode* pnode)
+    {
+        std::vector<int> vdata;
+        vdata.swap(pnode->data);
+        // greedy farthest-first pivot selection, dropping deleted nodes at the same time
+        std::vector<int> vvalid; vvalid.reserve(vdata.size());
+        FOREACHC(it, vdata) {
+            if( !!this->_nodes[*it] ) {
+                vvalid.push_back(*it);
+            }
+        }
+        if( (int)vvalid.size() <= _maxleafsize ) {
+            pnode->data.swap(vvalid);
+            return;
+        }
+        std::vector<dReal> vmindist(vvalid.size(), std::numeric_limits<dReal>::infinity());
+        std::vector<size_t> vpivots; vpivots.reserve(_degree);
+        size_t inext = 0;
+        while((int)vpivots.size() < _degree) {
+            vpivots.push_back(inext);
+            const std::vector<dReal>& qpivot = this->_nodes[vvalid[inext]]->q;
+            dReal fmax = -1;
+            for(size_t i = 0; i < vvalid.size(); ++i) {
+                vmindist[i] = std::min(vmindist[i], this->_distmetricfn(this->_nodes[vvalid[i]]->q, qpivot));
+                if( vmindist[i] > fmax ) {
+                    fmax = vmindist[i];
+                    inext = i;
+                }
+            }
+            if( fmax <= 0 ) {
+                break; // all remaining points coincide with a pivot
+            }
+        }
+
+        size_t numchildren = vpivots.size();
+        pnode->children.resize(numchildren);
+        for(size_t j = 0; j < numchildren; ++j) {
+            pnode->children[j] = new GNATNode(vvalid[vpivots[j]], this->_nodes[vvalid[vpivots[j]]]->q);
+        }
+        pnode->vranges.resize(2*numchildren*numchildren);
+        for(size_t i = 0; i < pnode->vranges.size(); i += 2) {
+            pnode->vranges[i] = std::numeric_limits<dReal>::infinity();
+            pnode->vranges[i+1] = -std::numeric_limits<dReal>::infinity();
+        }
+        for(size_t i = 0; i < vvalid.size(); ++i) {
+            const std::vector<dReal>& q = this->_nodes[vvalid[i]]->q;
+            _ComputePivotDistances(pnode, q, _vtempdists);
+            size_t inearest = std::find(vpivots.begin(), vpivots.end(), i) - vpivots.begin();
+            if( inearest == numchildren ) {
+                inearest = std::min_element(_vtempdists.begin(), _vtempdists.end()) - _vtempdists.begin();
+                pnode->children[inearest]->data.push_back(vvalid[i]);
+            }
+            pnode->UpdateRanges(inearest, _vtempdists);
+        }
+        for(size_t j = 0; j < numchildren; ++j) {
+            if( (int)pnode->children[j]->data.size() > _maxleafsize ) {
+                _Split(pnode->children[j]);
+            }
+        }
+    }
+
+    /// \brief buffers of one level of _Search
+    struct SearchBuffers
+    {
+        std::vector<dReal> vdists;
+        std::vector<uint8_t> vactive;
+        std::vector< std::pair<dReal, size_t> > vorder;
+    };
+
+    void _Search(GNATNode* pnode, const std::vector<dReal>& q, int& ibest, dReal& fbestdist, size_t depth=0)
+    {
+        FOREACHC(it, pnode->data) {
+            Node* ptreenode = this->_nodes[*it];
+            if( !!ptreenode ) {
+                dReal f = this->_distmetricfn(q, ptreenode->q);
+                if( f < fbestdist ) {
+                    ibest = *it;
+                    fbestdist = f;
+                }
+            }
+        }
+        size_t numchildren = pnode->children.size();
+        if( numchildren == 0 ) {
+            return;
+        }
+
+        // deque so that the buffers of the outer levels stay valid when a deeper level is added
+        if( depth >= _vsearchbuffers.size() ) {
+            _vsearchbuffers.push_back(SearchBuffers());
+        }
+        SearchBuffers& buffers = _vsearchbuffers[depth];
+        std::vector<dReal>& vdists = buffers.vdists;
+        std::vector<uint8_t>& vactive = buffers.vactive;
+        std::vector< std::pair<dReal, size_t> >& vorder = buffers.vorder;
+
+        // evaluate the pivots in turn and eliminate every child whose distance range to the pivot cannot contain a point closer than fbestdist
+        vdists.resize(0); vdists.resize(numchildren, 0);
+        vactive.resize(0); vactive.resize(numchildren, 1);
+        for(size_t i = 0; i < numchildren; ++i) {
+            if( !vactive[i] ) {
+                continue;
+            }
+            GNATNode* pchild = pnode->children[i];
+            vdists[i] = this->_distmetricfn(q, pchild->qpivot);
+            if( vdists[i] < fbestdist && !!this->_nodes[pchild->pivot] ) {
+                ibest = pchild->pivot;
+                fbestdist = vdists[i];
+            }
+            for(size_t j = 0; j < numchildren; ++j) {
+                if( vactive[j] && j != i ) {
+                    const dReal* prange = &pnode->vranges[2*(j*numchildren+i)];
+                    if( vdists[i] + fbestdist < prange[0] || vdists[i] - fbestdist > prange[1] ) {
+                        vactive[j] = 0;
+                    }
+                }
+            }
+        }
+
+        // descend into the closest children first so that fbestdist shrinks as fast as possible
+        vorder.resize(0);
+        for(size_t i = 0; i < numchildren; ++i) {
+            if( vactive[i] ) {
+                vorder.push_back(std::make_pair(vdists[i], i));
+            }
+        }
+        std::sort(vorder.begin(), vorder.end());
+        FOREACHC(itorder, vorder) {
+            const dReal* prange = &pnode->vranges[2*(itorder->second*numchildren+itorder->second)];
+            if( itorder->first - fbestdist <= prange[1] ) {
+                _Search(pnode->children[itorder->second], q, ibest, fbestdist, depth+1);
+            }
+        }
+    }
+
+    int _degree, _maxleafsize;
+    GNATNode* _root;
+    std::vector<dReal> _vtempdists;
+    std::deque<SearchBuffers> _vsearchbuffers; ///< indexed by the depth in the tree
+};
+
 class SpatialTreeBase
 {
 public:
@@ -75,8 +378,9 @@ public:
     virtual int GetDOF() = 0;
 };
 
+/// \brief owns its nodes and the nearest-neighbor index referencing them, so it cannot be copied
 template <typename Planner, typename Node>
-class SpatialTree : public SpatialTreeBase
+class SpatialTree : public SpatialTreeBase, private boost::noncopyable
 {
 public:
     SpatialTree(int fromgoal) {
@@ -85,6 +389,7 @@ public:
         _dof = 0;
         _fBestDist = 0;
         _nodes.reserve(5000);
+        SetNearestNeighborIndex("gnat");
     }
 
     ~SpatialTree(){
@@ -98,6 +403,7 @@ public:
             delete *it;
         }
         _nodes.resize(0);
+        _nnindex->Reset();
 
         if( dof > 0 ) {
             _vNewConfig.resize(dof);
@@ -106,10 +412,36 @@ public:
         }
     }
 
+    /// \brief sets the nearest-neighbor index, should be called before any nodes are added
+    ///
+    /// \param type one of "gnat" or "bruteforce". Use "bruteforce" when the distance metric does not satisfy the triangle inequality and exact neighbors are necessary.
+    virtual void SetNearestNeighborIndex(const std::string& type)
+    {
+        if( type == "bruteforce" ) {
+            _nnindex.reset(new BruteForceNearestNeighbor<Node>(_nodes, _distmetricfn));
+        }
+        else {
+            if( type != "gnat" && type.size() > 0 ) {
+                RAVELOG_WARN(str(boost::format("unknown nearest-neighbor index %s, using gnat\n")%type));
+            }
+            _nnindex.reset(new GNATNearestNeighbor<Node>(_nodes, _distmetricfn));
+        }
+        for(size_t i = 0; i < _nodes.size(); ++i) {
+            if( !!_nodes[i] && _nodes[i]->parent != (int)0x80000000 ) {
+                _nnindex->Add(i);
+            }
+        }
+    }
+
     virtual int AddNode(int parent, const vector<dReal>& config)
     {
         _nodes.push_back(new Node(parent,config));
-        return (int)_nodes.size()-1;
+        int index = (int)_nodes.size()-1;
+        // nodes inserted by the path optimizer are not part of the search tree
+        if( parent != (int)0x80000000 ) {
+            _nnindex->Add(index);
+        }
+        return index;
     }
 
     /// deletes all nodes that have parentindex as their parent
@@ -133,20 +465,7 @@ public:
         if( _nodes.size() == 0 ) {
             return -1;
         }
-        int ibest = -1;
-        dReal fbest = 0;
-        FOREACH(itnode, _nodes) {
-            if( !!*itnode && (*itnode)->parent != (int)0x80000000) {
-                dReal f = _distmetricfn(q, (*itnode)->q);
-                if(( ibest < 0) ||( f < fbest) ) {
-                    ibest = (int)(itnode-_nodes.begin());
-                    fbest = f;
-                }
-            }
-        }
-
-        _fBestDist = fbest;
-        return ibest;
+        return _nnindex->GetNN(q, _fBestDist);
     }
 
     /// extends toward pNewConfig
@@ -230,6 +549,7 @@ public:
 private:
     vector<int> _vchildindices;
     vector<dReal> _vNewConfig, _vDeltaConfig;
+    boost::shared_ptr< NearestNeighborIndexBase<Node> > _nnindex;
     boost::weak_ptr<Planner> _planner;
     int _dof, _fromgoal;
 };
@@ -58,6 +58,9 @@ Uses the Rapidly-Exploring Random Trees Algorithm.\n\
         _treeForward.Reset(shared_planner(), params->GetDOF());
         _treeForward._fStepLength = params->_fStepLength;
         _treeForward._distmetricfn = params->_distmetricfn;
+        RRTParametersPtr rrtparams = boost::dynamic_pointer_cast<RRTParameters>(params);
+        _sNearestNeighborIndex = !!rrtparams ? rrtparams->_sNearestNeighborIndex : std::string("gnat");
+        _treeForward.SetNearestNeighborIndex(_sNearestNeighborIndex);
         std::vector<dReal> vinitialconfig(params->GetDOF());
         _nNumInitialConfigurations = 0;
         for(size_t index = 0; index < params->vinitialconfig.size(); index += params->GetDOF()) {
@@ -129,6 +132,12 @@ Uses the Rapidly-Exploring Random Trees Algorithm.\n\
         }
     }
 
+    /// \brief sets the seed of the sampler that chooses between the goals and random samples, has to be called after InitPlan
+    void SetRandomSeed(uint32_t seed)
+    {
+        _uniformsampler->SetSeed(seed);
+    }
+
     bool GetGoalIndexCommand(std::ostream& os, std::istream& is)
     {
         os << _goalindex;
@@ -147,6 +156,7 @@ protected:
     int _goalindex, _startindex;
     SpaceSamplerBasePtr _uniformsampler;
     int _nNumInitialConfigurations;
+    std::string _sNearestNeighborIndex;
 
     SpatialTree< RrtPlanner<Node>, Node > _treeForward;
 
@@ -186,6 +196,7 @@ public:
         _treeBackward.Reset(shared_planner(), _parameters->GetDOF());
         _treeBackward._fStepLength = _parameters->_fStepLength;
         _treeBackward._distmetricfn = _parameters->_distmetricfn;
+        _treeBackward.SetNearestNeighborIndex(_sNearestNeighborIndex);
 
         //read in all goals
         if( (_parameters->vgoalconfig.size() % _parameters->GetDOF()) != 0 ) {
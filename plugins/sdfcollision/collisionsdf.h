@@ -0,0 +1,727 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2026 OpenRAVE contributors
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef OPENRAVE_COLLISIONSDF_H
+#define OPENRAVE_COLLISIONSDF_H
+
+#include "distancefield.h"
+
+/** \brief checks bodies against a signed distance field of the static bodies and forwards everything else to a mesh checker
+
+    Links are covered by spheres built from their collision meshes. A link whose spheres are all farther from the static
+    bodies than the error of the field cannot collide with them, so only links close to the static bodies are checked
+    with the mesh checker. Bodies that are not in the field are always checked with the mesh checker.
+ */
+class CollisionCheckerSDF : public CollisionCheckerBase
+{
+public:
+    /// \brief spheres covering the collision meshes of a body, stored as user data of the body
+    class SphereBodyInfo : public OpenRAVE::UserData
+    {
+public:
+        SphereBodyInfo() : bGeometryChanged(false) {
+        }
+        virtual ~SphereBodyInfo() {
+        }
+        void _GeometryChangedCallback() {
+            bGeometryChanged = true;
+        }
+        struct LinkSpheres
+        {
+            LinkSpheres() : fradius(0), fboundingradius(0) {
+            }
+            /// \brief consecutive spheres of a block of voxels with the sphere enclosing them
+            struct SphereGroup
+            {
+                Vector vcenter;
+                dReal fradius;
+                size_t start, end;
+            };
+            std::vector<Vector> vcenters; ///< in the link frame, sorted by group
+            dReal fradius; ///< radius of all spheres
+            std::vector<SphereGroup> vgroups;
+            Vector vboundingcenter; ///< sphere around all the spheres, in the link frame
+            dReal fboundingradius;
+        };
+        std::vector<LinkSpheres> vlinks;
+        dReal fspheresize; ///< the voxel size used to compute the spheres
+        bool bGeometryChanged;
+        UserDataPtr _geometrycallback;
+    };
+    typedef boost::shared_ptr<SphereBodyInfo> SphereBodyInfoPtr;
+
+    CollisionCheckerSDF(EnvironmentBasePtr penv) : CollisionCheckerBase(penv)
+    {
+        __description = "Checks collisions with the static part of the environment using a signed distance field, falls back to a mesh checker (pqp by default) for everything else.\n\n\
+BuildDistanceField voxelizes the static bodies. Afterwards, body and link checks against the environment approximate every link with spheres and only run the mesh checker on the links that are closer to the static bodies than the resolution of the field, and on the bodies that are not in the field. The results are the same as the ones of the mesh checker.\n\n\
+The field is not used when a static body moves or changes geometry, when a collision report is requested, or when the distance, tolerance, contacts or active dof options are set.";
+        RegisterCommand("BuildDistanceField",boost::bind(&CollisionCheckerSDF::BuildDistanceFieldCommand,this,_1,_2),
+                        "[cellsize 0.02] [padding 0.1] [linkspheresize cellsize] [maxvoxels 50000000] [bodies name1 name2 ...]. Voxelizes the static bodies, which are all bodies that are not robots or grabbed by robots unless the bodies are given. Returns the number of voxels.");
+        RegisterCommand("ClearDistanceField",boost::bind(&CollisionCheckerSDF::ClearDistanceFieldCommand,this,_1,_2),
+                        "Removes the distance field, all checks go to the mesh checker.");
+        RegisterCommand("GetClearance",boost::bind(&CollisionCheckerSDF::GetClearanceCommand,this,_1,_2),
+                        "bodyname. Returns the approximate distance of the body to the static bodies and the name of the closest link. The distance is negative for penetrations and accurate to about the cell size.");
+        RegisterCommand("SetMeshChecker",boost::bind(&CollisionCheckerSDF::SetMeshCheckerCommand,this,_1,_2),
+                        "checkername. Sets the checker for the dynamic bodies and for the links close to static bodies.");
+        _meshcheckername = "pqp";
+        _fLinkSphereSize = 0;
+        _bStaticGeometryChanged = false;
+        _bWarnedInvalid = false;
+    }
+
+    virtual bool SetCollisionOptions(int collisionoptions)
+    {
+        return _GetMeshChecker()->SetCollisionOptions(collisionoptions);
+    }
+    virtual int GetCollisionOptions() const
+    {
+        return !_pmeshchecker ? 0 : _pmeshchecker->GetCollisionOptions();
+    }
+    virtual void SetTolerance(dReal tolerance)
+    {
+        _GetMeshChecker()->SetTolerance(tolerance);
+    }
+
+    virtual bool InitEnvironment()
+    {
+        return _GetMeshChecker()->InitEnvironment();
+    }
+    virtual void DestroyEnvironment()
+    {
+        if( !!_pmeshchecker ) {
+            _pmeshchecker->DestroyEnvironment();
+        }
+        _ClearField();
+        vector<KinBodyPtr> vbodies;
+        GetEnv()->GetBodies(vbodies);
+        FOREACHC(itbody, vbodies) {
+            (*itbody)->RemoveUserData("sdfcollision");
+        }
+    }
+    virtual bool InitKinBody(KinBodyPtr pbody)
+    {
+        return _GetMeshChecker()->InitKinBody(pbody);
+    }
+    virtual void RemoveKinBody(KinBodyPtr pbody)
+    {
+        if( !!_pmeshchecker ) {
+            _pmeshchecker->RemoveKinBody(pbody);
+        }
+        if( !!pbody ) {
+            pbody->RemoveUserData("sdfcollision");
+        }
+    }
+
+    virtual bool CheckCollision(KinBodyConstPtr pbody1, CollisionReportPtr report)
+    {
+        if( !report && _IsFieldUsable() ) {
+            std::vector<KinBodyConstPtr> vbodyexcluded;
+            vbodyexcluded.push_back(pbody1);
+            return _CheckCollisionField(pbody1, KinBody::LinkConstPtr(), vbodyexcluded);
+        }
+        return _GetMeshChecker()->CheckCollision(pbody1,report);
+    }
+    virtual bool CheckCollision(KinBodyConstPtr pbody1, KinBodyConstPtr pbody2, CollisionReportPtr report)
+    {
+        return _GetMeshChecker()->CheckCollision(pbody1,pbody2,report);
+    }
+    virtual bool CheckCollision(KinBody::LinkConstPtr plink, CollisionReportPtr report)
+    {
+        if( !report && _IsFieldUsable() ) {
+            return _CheckCollisionField(plink->GetParent(), plink, std::vector<KinBodyConstPtr>());
+        }
+        return _GetMeshChecker()->CheckCollision(plink,report);
+    }
+    virtual bool CheckCollision(KinBody::LinkConstPtr plink1, KinBody::LinkConstPtr plink2, CollisionReportPtr report)
+    {
+        return _GetMeshChecker()->CheckCollision(plink1,plink2,report);
+    }
+    virtual bool CheckCollision(KinBody::LinkConstPtr plink, KinBodyConstPtr pbody, CollisionReportPtr report)
+    {
+        return _GetMeshChecker()->CheckCollision(plink,pbody,report);
+    }
+    virtual bool CheckCollision(KinBody::LinkConstPtr plink, const std::vector<KinBodyConstPtr>& vbodyexcluded, const std::vector<KinBody::LinkConstPtr>& vlinkexcluded, CollisionReportPtr report)
+    {
+        if( !report && vlinkexcluded.size() == 0 && _IsFieldUsable() ) {
+            return _CheckCollisionField(plink->GetParent(), plink, vbodyexcluded);
+        }
+        return _GetMeshChecker()->CheckCollision(plink,vbodyexcluded,vlinkexcluded,report);
+    }
+    virtual bool CheckCollision(KinBodyConstPtr pbody, const std::vector<KinBodyConstPtr>& vbodyexcluded, const std::vector<KinBody::LinkConstPtr>& vlinkexcluded, CollisionReportPtr report)
+    {
+        if( !report && vlinkexcluded.size() == 0 && _IsFieldUsable() ) {
+            return _CheckCollisionField(pbody, KinBody::LinkConstPtr(), vbodyexcluded);
+        }
+        return _GetMeshChecker()->CheckCollision(pbody,vbodyexcluded,vlinkexcluded,report);
+    }
+    virtual bool CheckCollision(const RAY& ray, KinBody::LinkConstPtr plink, CollisionReportPtr report)
+    {
+        return _GetMeshChecker()->CheckCollision(ray,plink,report);
+    }
+    virtual bool CheckCollision(const RAY& ray, KinBodyConstPtr pbody, CollisionReportPtr report)
+    {
+        return _GetMeshChecker()->CheckCollision(ray,pbody,report);
+    }
+    virtual bool CheckCollision(const RAY& ray, CollisionReportPtr report)
+    {
+        return _GetMeshChecker()->CheckCollision(ray,report);
+    }
+    virtual int CheckCollisionRays(const std::vector<RAY>& vrays, KinBodyConstPtr pbody, std::vector<dReal>& vhitdistances, std::vector<Vector>& vhitnormals, std::vector<KinBody::LinkConstPtr>& vhitlinks)
+    {
+        return _GetMeshChecker()->CheckCollisionRays(vrays,pbody,vhitdistances,vhitnormals,vhitlinks);
+    }
+    virtual bool IsRayBatchConcurrent() const
+    {
+        return !!_pmeshchecker && _pmeshchecker->IsRayBatchConcurrent();
+    }
+    virtual bool CheckContinuousCollision(KinBodyPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& q0, const std::vector<dReal>& q1, CollisionReportPtr report)
+    {
+        return _GetMeshChecker()->CheckContinuousCollision(pbody,dofindices,q0,q1,report);
+    }
+    virtual UserDataPtr CreateQueryContext(KinBodyConstPtr pbody, int queryoptions)
+    {
+        return _GetMeshChecker()->CreateQueryContext(pbody,queryoptions);
+    }
+    virtual bool CheckCollisionInContext(UserDataPtr pcontext, const std::vector<Transform>& vlinktransforms, CollisionReportPtr report)
+    {
+        return _GetMeshChecker()->CheckCollisionInContext(pcontext,vlinktransforms,report);
+    }
+    virtual bool CheckSelfCollision(KinBodyConstPtr pbody, CollisionReportPtr report)
+    {
+        // CheckSelfCollision of the mesh checker is protected, so check the same link pairs through the public link checks
+        if( pbody->GetLinks().size() <= 1 ) {
+            return false;
+        }
+        CollisionCheckerBasePtr pmeshchecker = _GetMeshChecker();
+        int adjacentoptions = KinBody::AO_Enabled;
+        if( (pmeshchecker->GetCollisionOptions()&CO_ActiveDOFs) && pbody->IsRobot() ) {
+            adjacentoptions |= KinBody::AO_ActiveDOFs;
+        }
+        const std::vector<KinBody::LinkPtr>& vlinks = pbody->GetLinks();
+        FOREACHC(itset, pbody->GetNonAdjacentLinks(adjacentoptions)) {
+            if( pmeshchecker->CheckCollision(KinBody::LinkConstPtr(vlinks.at(*itset&0xffff)), KinBody::LinkConstPtr(vlinks.at(*itset>>16)), report) ) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+protected:
+    bool BuildDistanceFieldCommand(std::ostream& sout, std::istream& sinput)
+    {
+        dReal fcellsize = 0.02, fpadding = 0.1, flinkspheresize = 0;
+        size_t maxvoxels = 50000000;
+        std::vector<std::string> vbodynames;
+        bool bbodies = false;
+        string cmd;
+        while(!sinput.eof()) {
+            sinput >> cmd;
+            if( !sinput ) {
+                break;
+            }
+            std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
+            if( cmd == "cellsize" ) {
+                sinput >> fcellsize;
+            }
+            else if( cmd == "padding" ) {
+                sinput >> fpadding;
+            }
+            else if( cmd == "linkspheresize" ) {
+                sinput >> flinkspheresize;
+            }
+            else if( cmd == "maxvoxels" ) {
+                sinput >> maxvoxels;
+            }
+            else if( cmd == "bodies" ) {
+                bbodies = true;
+                string name;
+                while( sinput >> name ) {
+                    vbodynames.push_back(name);
+                }
+                break;
+            }
+            else {
+                RAVELOG_WARN(str(boost::format("unrecognized command: %s\n")%cmd));
+                break;
+            }
+            if( !sinput ) {
+                RAVELOG_ERROR(str(boost::format("failed processing command %s\n")%cmd));
+                return false;
+            }
+        }
+        if( fcellsize <= 0 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("invalid cell size %f", fcellsize, ORE_InvalidArguments);
+        }
+
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        std::vector<KinBodyPtr> vstaticbodies;
+        if( bbodies ) {
+            FOREACHC(itname, vbodynames) {
+                KinBodyPtr pbody = GetEnv()->GetKinBody(*itname);
+                if( !pbody ) {
+                    throw OPENRAVE_EXCEPTION_FORMAT("failed to find body %s", *itname, ORE_InvalidArguments);
+                }
+                vstaticbodies.push_back(pbody);
+            }
+        }
+        else {
+            std::vector<KinBodyPtr> vbodies;
+            GetEnv()->GetBodies(vbodies);
+            FOREACHC(itbody, vbodies) {
+                std::set<KinBodyPtr> setattached;
+                (*itbody)->GetAttached(setattached);
+                bool bdynamic = false;
+                FOREACHC(itattached, setattached) {
+                    if( (*itattached)->IsRobot() ) {
+                        bdynamic = true;
+                        break;
+                    }
+                }
+                if( !bdynamic ) {
+                    vstaticbodies.push_back(*itbody);
+                }
+            }
+        }
+
+        uint64_t starttime = utils::GetMicroTime();
+        _ClearField();
+        std::vector<TriMesh> vtrimeshes;
+        FOREACHC(itbody, vstaticbodies) {
+            StaticBody staticbody;
+            staticbody.pbody = *itbody;
+            staticbody.nLastStamp = (*itbody)->GetUpdateStamp();
+            staticbody._geometrycallback = (*itbody)->RegisterChangeCallback(KinBody::Prop_LinkGeometry, boost::bind(&CollisionCheckerSDF::_StaticGeometryChangedCallback,this));
+            TriMesh bodytrimesh;
+            FOREACHC(itlink, (*itbody)->GetLinks()) {
+                vtrimeshes.push_back((*itlink)->GetCollisionData());
+                vtrimeshes.back().ApplyTransform((*itlink)->GetTransform());
+                bodytrimesh.Append(vtrimeshes.back());
+                staticbody.vlinkaabbs.push_back(vtrimeshes.back().vertices.size() > 0 ? vtrimeshes.back().ComputeAABB() : AABB(Vector(),Vector(-1,-1,-1)));
+            }
+            staticbody.ab = bodytrimesh.ComputeAABB();
+            _vstaticbodies.push_back(staticbody);
+        }
+        try {
+            _field.Build(vtrimeshes, fcellsize, fpadding, maxvoxels);
+        }
+        catch(...) {
+            _ClearField();
+            throw;
+        }
+        _fLinkSphereSize = flinkspheresize > 0 ? flinkspheresize : fcellsize;
+        _bStaticGeometryChanged = false;
+        _bWarnedInvalid = false;
+        RAVELOG_DEBUG(str(boost::format("built distance field of %d static bodies with %d voxels in %fs\n")%_vstaticbodies.size()%_field.GetNumVoxels()%((utils::GetMicroTime()-starttime)*1e-6)));
+        sout << _field.GetNumVoxels();
+        return true;
+    }
+
+    bool ClearDistanceFieldCommand(std::ostream& sout, std::istream& sinput)
+    {
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        _ClearField();
+        return true;
+    }
+
+    bool GetClearanceCommand(std::ostream& sout, std::istream& sinput)
+    {
+        string bodyname;
+        sinput >> bodyname;
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        KinBodyPtr pbody = GetEnv()->GetKinBody(bodyname);
+        if( !pbody ) {
+            RAVELOG_WARN(str(boost::format("failed to find body %s\n")%bodyname));
+            return false;
+        }
+        if( !_IsFieldValid() ) {
+            RAVELOG_WARN("distance field is not built or is out of date\n");
+            return false;
+        }
+        SphereBodyInfoPtr pinfo = _GetSphereBodyInfo(pbody);
+        dReal fclearance = std::numeric_limits<dReal>::infinity();
+        KinBody::LinkPtr pclosestlink;
+        for(size_t ilink = 0; ilink < pbody->GetLinks().size(); ++ilink) {
+            KinBody::LinkPtr plink = pbody->GetLinks()[ilink];
+            const SphereBodyInfo::LinkSpheres& spheres = pinfo->vlinks.at(ilink);
+            if( !plink->IsEnabled() || spheres.vcenters.size() == 0 ) {
+                continue;
+            }
+            Transform t = plink->GetTransform();
+            FOREACHC(itcenter, spheres.vcenters) {
+                dReal fdist = _field.GetDistance(t*(*itcenter)) - spheres.fradius;
+                if( fdist < fclearance ) {
+                    fclearance = fdist;
+                    pclosestlink = plink;
+                }
+            }
+        }
+        if( !pclosestlink ) {
+            return false;
+        }
+        sout << fclearance << " " << pclosestlink->GetName();
+        return true;
+    }
+
+    bool SetMeshCheckerCommand(std::ostream& sout, std::istream& sinput)
+    {
+        string checkername;
+        sinput >> checkername;
+        if( !sinput ) {
+            return false;
+        }
+        EnvironmentMutex::scoped_lock lock(GetEnv()->GetMutex());
+        CollisionCheckerBasePtr pchecker = RaveCreateCollisionChecker(GetEnv(), checkername);
+        if( !pchecker ) {
+            RAVELOG_WARN(str(boost::format("failed to create collision checker %s\n")%checkername));
+            return false;
+        }
+        int options = GetCollisionOptions();
+        if( !!_pmeshchecker ) {
+            _pmeshchecker->DestroyEnvironment();
+        }
+        _meshcheckername = checkername;
+        _pmeshchecker = pchecker;
+        _pmeshchecker->InitEnvironment();
+        _pmeshchecker->SetCollisionOptions(options);
+        return true;
+    }
+
+    /// \brief creates the mesh checker when first needed, not from the constructor since the plugin is still being loaded
+    CollisionCheckerBasePtr _GetMeshChecker()
+    {
+        if( !_pmeshchecker ) {
+            _pmeshchecker = RaveCreateCollisionChecker(GetEnv(), _meshcheckername);
+            if( !_pmeshchecker ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("failed to create mesh collision checker %s", _meshcheckername, ORE_InvalidPlugin);
+            }
+            _pmeshchecker->InitEnvironment();
+        }
+        return _pmeshchecker;
+    }
+
+    struct StaticBody
+    {
+        KinBodyWeakPtr pbody;
+        int nLastStamp; ///< update stamp when the field was built
+        AABB ab; ///< bounding box when the field was built
+        std::vector<AABB> vlinkaabbs; ///< bounding boxes of the links when the field was built
+        UserDataPtr _geometrycallback;
+    };
+
+    void _StaticGeometryChangedCallback() {
+        // cannot clear the field here since the callback can come from any place that changes the geometry
+        _bStaticGeometryChanged = true;
+    }
+
+    void _ClearField()
+    {
+        _field.Clear();
+        _vstaticbodies.clear();
+    }
+
+    /// \brief true if the static bodies did not change since the field was built
+    bool _IsFieldValid()
+    {
+        if( !_field.IsValid() ) {
+            return false;
+        }
+        bool bvalid = !_bStaticGeometryChanged;
+        for(size_t i = 0; i < _vstaticbodies.size() && bvalid; ++i) {
+            KinBodyPtr pbody = _vstaticbodies[i].pbody.lock();
+            bvalid = !!pbody && pbody->GetEnvironmentId() != 0 && pbody->GetUpdateStamp() == _vstaticbodies[i].nLastStamp;
+        }
+        if( !bvalid && !_bWarnedInvalid ) {
+            RAVELOG_WARN("static bodies of the distance field moved or changed, using the mesh checker until BuildDistanceField is called again\n");
+            _bWarnedInvalid = true;
+        }
+        return bvalid;
+    }
+
+    /// \brief the field only gives yes/no answers without contacts, and does not know which links are active
+    bool _IsFieldUsable()
+    {
+        if( GetCollisionOptions() & (CO_Distance|CO_UseTolerance|CO_Contacts|CO_ActiveDOFs) ) {
+            return false;
+        }
+        return _IsFieldValid();
+    }
+
+    bool _IsStaticBody(KinBodyConstPtr pbody) const
+    {
+        FOREACHC(itstaticbody, _vstaticbodies) {
+            if( itstaticbody->pbody.lock() == pbody ) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// \brief checks pbody and its attached bodies (or only plink if set) against the environment.
+    ///
+    /// The static bodies are checked with the spheres first and with the mesh checker only for the links that are close to them,
+    /// the other bodies are checked with the mesh checker.
+    bool _CheckCollisionField(KinBodyConstPtr pbody, KinBody::LinkConstPtr plink, const std::vector<KinBodyConstPtr>& vbodyexcluded)
+    {
+        std::set<KinBodyPtr> setattached;
+        pbody->GetAttached(setattached);
+        std::vector<KinBodyConstPtr> vcheckbodies;
+        if( !plink ) {
+            vcheckbodies.insert(vcheckbodies.end(), setattached.begin(), setattached.end());
+        }
+        FOREACHC(itbody, setattached) {
+            if( _IsStaticBody(*itbody) ) {
+                // a static body that is attached to the checked body would be checked against itself
+                return !plink ? _GetMeshChecker()->CheckCollision(pbody, vbodyexcluded, std::vector<KinBody::LinkConstPtr>()) : _GetMeshChecker()->CheckCollision(plink, vbodyexcluded, std::vector<KinBody::LinkConstPtr>());
+            }
+        }
+
+        // static part
+        dReal fmargin = _field.GetMargin();
+        for(size_t ibody = 0; ibody < max(vcheckbodies.size(),size_t(1)); ++ibody) {
+            KinBodyConstPtr pcheckbody = !plink ? vcheckbodies[ibody] : pbody;
+            SphereBodyInfoPtr pinfo = _GetSphereBodyInfo(pcheckbody);
+            for(size_t ilink = 0; ilink < pcheckbody->GetLinks().size(); ++ilink) {
+                KinBody::LinkConstPtr pchecklink = pcheckbody->GetLinks()[ilink];
+                if( (!!plink && pchecklink != plink) || !pchecklink->IsEnabled() ) {
+                    continue;
+                }
+                const SphereBodyInfo::LinkSpheres& spheres = pinfo->vlinks.at(ilink);
+                if( spheres.vcenters.size() == 0 ) {
+                    continue;
+                }
+                Transform t = pchecklink->GetTransform();
+                Vector vboundingcenter = t*spheres.vboundingcenter;
+                if( _field.GetDistance(vboundingcenter) - fmargin > spheres.fboundingradius ) {
+                    continue;
+                }
+                bool bclose = false;
+                FOREACHC(itgroup, spheres.vgroups) {
+                    if( _field.GetDistance(t*itgroup->vcenter) - fmargin > itgroup->fradius ) {
+                        continue;
+                    }
+                    for(size_t i = itgroup->start; i < itgroup->end; ++i) {
+                        if( _field.GetDistance(t*spheres.vcenters[i]) - fmargin <= spheres.fradius ) {
+                            bclose = true;
+                            break;
+                        }
+                    }
+                    if( bclose ) {
+                        break;
+                    }
+                }
+                if( bclose && _CheckLinkStatic(pchecklink, vboundingcenter, spheres.fboundingradius, vbodyexcluded) ) {
+                    return true;
+                }
+            }
+        }
+
+        // dynamic part, the mesh checker is only called for the links whose bounding spheres overlap the box of a dynamic body
+        std::vector<KinBody::LinkConstPtr> vchecklinks;
+        std::vector<Vector> vchecklinkcenters;
+        std::vector<dReal> vchecklinkradii;
+        Vector vgroupmin, vgroupmax;
+        for(size_t ibody = 0; ibody < max(vcheckbodies.size(),size_t(1)); ++ibody) {
+            KinBodyConstPtr pcheckbody = !plink ? vcheckbodies[ibody] : pbody;
+            SphereBodyInfoPtr pinfo = _GetSphereBodyInfo(pcheckbody);
+            for(size_t ilink = 0; ilink < pcheckbody->GetLinks().size(); ++ilink) {
+                KinBody::LinkConstPtr pchecklink = pcheckbody->GetLinks()[ilink];
+                const SphereBodyInfo::LinkSpheres& spheres = pinfo->vlinks.at(ilink);
+                if( (!!plink && pchecklink != plink) || !pchecklink->IsEnabled() || spheres.vcenters.size() == 0 ) {
+                    continue;
+                }
+                Vector vcenter = pchecklink->GetTransform()*spheres.vboundingcenter;
+                Vector vextents(spheres.fboundingradius,spheres.fboundingradius,spheres.fboundingradius);
+                if( vchecklinks.size() == 0 ) {
+                    vgroupmin = vcenter - vextents;
+                    vgroupmax = vcenter + vextents;
+                }
+                else {
+                    vgroupmin = Vector(min(vgroupmin.x,vcenter.x-vextents.x), min(vgroupmin.y,vcenter.y-vextents.y), min(vgroupmin.z,vcenter.z-vextents.z));
+                    vgroupmax = Vector(max(vgroupmax.x,vcenter.x+vextents.x), max(vgroupmax.y,vcenter.y+vextents.y), max(vgroupmax.z,vcenter.z+vextents.z));
+                }
+                vchecklinks.push_back(pchecklink);
+                vchecklinkcenters.push_back(vcenter);
+                vchecklinkradii.push_back(spheres.fboundingradius);
+            }
+        }
+        if( vchecklinks.size() == 0 ) {
+            return false;
+        }
+        boost::shared_ptr<std::vector<KinBodyPtr> const> pvbodies = GetEnv()->GetBodiesSnapshot();
+        FOREACHC(itbody, *pvbodies) {
+            if( setattached.find(*itbody) != setattached.end() || (!!plink && *itbody == pbody) || _IsStaticBody(*itbody) || find(vbodyexcluded.begin(), vbodyexcluded.end(), *itbody) != vbodyexcluded.end() ) {
+                continue;
+            }
+            Vector vbodymin, vbodymax;
+            if( !_ComputeBoundingBox(*itbody, vbodymin, vbodymax) || !_IsOverlapping(vbodymin, vbodymax, vgroupmin, vgroupmax) ) {
+                continue;
+            }
+            for(size_t ilink = 0; ilink < vchecklinks.size(); ++ilink) {
+                Vector vextents(vchecklinkradii[ilink],vchecklinkradii[ilink],vchecklinkradii[ilink]);
+                if( _IsOverlapping(vbodymin, vbodymax, vchecklinkcenters[ilink]-vextents, vchecklinkcenters[ilink]+vextents) && _GetMeshChecker()->CheckCollision(vchecklinks[ilink], KinBodyConstPtr(*itbody)) ) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /// \brief box around the bounding spheres of the enabled links, false if the body has no enabled geometry
+    bool _ComputeBoundingBox(KinBodyConstPtr pbody, Vector& vmin, Vector& vmax)
+    {
+        SphereBodyInfoPtr pinfo = _GetSphereBodyInfo(pbody);
+        bool binitialized = false;
+        for(size_t ilink = 0; ilink < pbody->GetLinks().size(); ++ilink) {
+            const SphereBodyInfo::LinkSpheres& spheres = pinfo->vlinks.at(ilink);
+            if( !pbody->GetLinks()[ilink]->IsEnabled() || spheres.vcenters.size() == 0 ) {
+                continue;
+            }
+            Vector vcenter = pbody->GetLinks()[ilink]->GetTransform()*spheres.vboundingcenter;
+            Vector vextents(spheres.fboundingradius,spheres.fboundingradius,spheres.fboundingradius);
+            if( !binitialized ) {
+                vmin = vcenter - vextents;
+                vmax = vcenter + vextents;
+                binitialized = true;
+            }
+            else {
+                vmin = Vector(min(vmin.x,vcenter.x-vextents.x), min(vmin.y,vcenter.y-vextents.y), min(vmin.z,vcenter.z-vextents.z));
+                vmax = Vector(max(vmax.x,vcenter.x+vextents.x), max(vmax.y,vcenter.y+vextents.y), max(vmax.z,vcenter.z+vextents.z));
+            }
+        }
+        return binitialized;
+    }
+
+    static bool _IsOverlapping(const Vector& vmin1, const Vector& vmax1, const Vector& vmin2, const Vector& vmax2)
+    {
+        return vmin1.x <= vmax2.x && vmin2.x <= vmax1.x && vmin1.y <= vmax2.y && vmin2.y <= vmax1.y && vmin1.z <= vmax2.z && vmin2.z <= vmax1.z;
+    }
+
+    static bool _IsSphereOutside(const AABB& ab, const Vector& vcenter, dReal fradius)
+    {
+        Vector vdelta = vcenter - ab.pos;
+        return RaveFabs(vdelta.x) > ab.extents.x + fradius || RaveFabs(vdelta.y) > ab.extents.y + fradius || RaveFabs(vdelta.z) > ab.extents.z + fradius;
+    }
+
+    /// \brief checks a link with the mesh checker against the static links whose boxes are close to its bounding sphere
+    bool _CheckLinkStatic(KinBody::LinkConstPtr plink, const Vector& vboundingcenter, dReal fboundingradius, const std::vector<KinBodyConstPtr>& vbodyexcluded)
+    {
+        for(size_t i = 0; i < _vstaticbodies.size(); ++i) {
+            const StaticBody& staticbody = _vstaticbodies[i];
+            if( _IsSphereOutside(staticbody.ab, vboundingcenter, fboundingradius) ) {
+                continue;
+            }
+            KinBodyConstPtr pstaticbody = staticbody.pbody.lock();
+            if( !pstaticbody || find(vbodyexcluded.begin(), vbodyexcluded.end(), pstaticbody) != vbodyexcluded.end() ) {
+                continue;
+            }
+            const std::vector<KinBody::LinkPtr>& vstaticlinks = pstaticbody->GetLinks();
+            for(size_t ilink = 0; ilink < vstaticlinks.size(); ++ilink) {
+                const AABB& ablink = staticbody.vlinkaabbs.at(ilink);
+                if( ablink.extents.x < 0 || !vstaticlinks[ilink]->IsEnabled() || _IsSphereOutside(ablink, vboundingcenter, fboundingradius) ) {
+                    continue;
+                }
+                if( _GetMeshChecker()->CheckCollision(plink, KinBody::LinkConstPtr(vstaticlinks[ilink])) ) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /// \brief returns the spheres of the body, computing them if they do not exist or are out of date
+    SphereBodyInfoPtr _GetSphereBodyInfo(KinBodyConstPtr pbody)
+    {
+        SphereBodyInfoPtr pinfo = boost::dynamic_pointer_cast<SphereBodyInfo>(pbody->GetUserData("sdfcollision"));
+        if( !!pinfo && !pinfo->bGeometryChanged && pinfo->fspheresize == _fLinkSphereSize && pinfo->vlinks.size() == pbody->GetLinks().size() ) {
+            return pinfo;
+        }
+        pinfo.reset(new SphereBodyInfo());
+        pinfo->fspheresize = _fLinkSphereSize;
+        pinfo->_geometrycallback = pbody->RegisterChangeCallback(KinBody::Prop_LinkGeometry, boost::bind(&SphereBodyInfo::_GeometryChangedCallback,pinfo.get()));
+        pinfo->vlinks.resize(pbody->GetLinks().size());
+        for(size_t i = 0; i < pbody->GetLinks().size(); ++i) {
+            _ComputeLinkSpheres(pbody->GetLinks()[i]->GetCollisionData(), _fLinkSphereSize, pinfo->vlinks[i]);
+        }
+        pbody->SetUserData("sdfcollision", pinfo);
+        return pinfo;
+    }
+
+    /// \brief covers the surface of the mesh with spheres at the centers of the voxels marked by RasterizeTriangles.
+    ///
+    /// Every surface point is within half a voxel diagonal of a marked voxel center, which is the radius of the spheres.
+    /// The spheres of each block of s_nGroupSize^3 voxels are grouped so that blocks far from the static bodies are rejected with one lookup.
+    static void _ComputeLinkSpheres(const TriMesh& trimesh, dReal fspheresize, SphereBodyInfo::LinkSpheres& spheres)
+    {
+        spheres.vcenters.resize(0);
+        spheres.vgroups.resize(0);
+        if( trimesh.indices.size() == 0 ) {
+            return;
+        }
+        AABB ab = trimesh.ComputeAABB();
+        Vector vorigin = ab.pos - ab.extents - Vector(fspheresize,fspheresize,fspheresize)*0.5;
+        int dims[3];
+        dims[0] = (int)ceil(2*ab.extents.x/fspheresize)+1;
+        dims[1] = (int)ceil(2*ab.extents.y/fspheresize)+1;
+        dims[2] = (int)ceil(2*ab.extents.z/fspheresize)+1;
+        std::vector<uint8_t> voxels(dims[0]*dims[1]*dims[2],0);
+        RasterizeTriangles(trimesh, vorigin, fspheresize, dims, voxels);
+        spheres.fradius = fspheresize*0.5*RaveSqrt(dReal(3));
+        for(int bz = 0; bz < dims[2]; bz += s_nGroupSize) {
+            for(int by = 0; by < dims[1]; by += s_nGroupSize) {
+                for(int bx = 0; bx < dims[0]; bx += s_nGroupSize) {
+                    SphereBodyInfo::LinkSpheres::SphereGroup group;
+                    group.start = spheres.vcenters.size();
+                    for(int iz = bz; iz < min(bz+s_nGroupSize,dims[2]); ++iz) {
+                        for(int iy = by; iy < min(by+s_nGroupSize,dims[1]); ++iy) {
+                            for(int ix = bx; ix < min(bx+s_nGroupSize,dims[0]); ++ix) {
+                                if( voxels[ix+dims[0]*(iy+dims[1]*iz)] ) {
+                                    spheres.vcenters.push_back(vorigin + Vector(ix+0.5,iy+0.5,iz+0.5)*fspheresize);
+                                }
+                            }
+                        }
+                    }
+                    group.end = spheres.vcenters.size();
+                    if( group.end > group.start ) {
+                        group.vcenter = vorigin + Vector(bx+0.5*s_nGroupSize,by+0.5*s_nGroupSize,bz+0.5*s_nGroupSize)*fspheresize;
+                        group.fradius = 0;
+                        for(size_t i = group.start; i < group.end; ++i) {
+                            group.fradius = max(group.fradius, (spheres.vcenters[i]-group.vcenter).lengthsqr3());
+                        }
+                        group.fradius = RaveSqrt(group.fradius) + spheres.fradius;
+                        spheres.vgroups.push_back(group);
+                    }
+                }
+            }
+        }
+        spheres.vboundingcenter = ab.pos;
+        spheres.fboundingradius = 0;
+        FOREACHC(itcenter, spheres.vcenters) {
+            spheres.fboundingradius = max(spheres.fboundingradius, (*itcenter-ab.pos).lengthsqr3());
+        }
+        spheres.fboundingradius = RaveSqrt(spheres.fboundingradius) + spheres.fradius;
+    }
+
+    static const int s_nGroupSize = 4;
+
+    std::string _meshcheckername;
+    CollisionCheckerBasePtr _pmeshchecker;
+    DistanceField _field;
+    std::vector<StaticBody> _vstaticbodies;
+    bool _bStaticGeometryChanged; ///< set when the geometry of a static body changes, the field is invalid until it is built again
+    dReal _fLinkSphereSize; ///< voxel size used to cover the links with spheres
+    bool _bWarnedInvalid;
+};
+
+#endif
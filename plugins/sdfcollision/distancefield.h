@@ -0,0 +1,338 @@
+// -*- coding: utf-8 -*-
+// Copyright (C) 2026 OpenRAVE contributors
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#ifndef OPENRAVE_DISTANCEFIELD_H
+#define OPENRAVE_DISTANCEFIELD_H
+
+/// \brief closest point to p on the triangle v0,v1,v2, see Ericson, "Real-Time Collision Detection" 5.1.5
+inline Vector ClosestPointOnTriangle(const Vector& p, const Vector& v0, const Vector& v1, const Vector& v2)
+{
+    Vector e1 = v1-v0, e2 = v2-v0, d0 = p-v0;
+    dReal a1 = e1.dot3(d0), a2 = e2.dot3(d0);
+    if( a1 <= 0 && a2 <= 0 ) {
+        return v0;
+    }
+    Vector d1 = p-v1;
+    dReal b1 = e1.dot3(d1), b2 = e2.dot3(d1);
+    if( b1 >= 0 && b2 <= b1 ) {
+        return v1;
+    }
+    dReal vc = a1*b2 - b1*a2;
+    if( vc <= 0 && a1 >= 0 && b1 <= 0 ) {
+        return v0 + e1*(a1/(a1-b1));
+    }
+    Vector d2 = p-v2;
+    dReal c1 = e1.dot3(d2), c2 = e2.dot3(d2);
+    if( c2 >= 0 && c1 <= c2 ) {
+        return v2;
+    }
+    dReal vb = c1*a2 - a1*c2;
+    if( vb <= 0 && a2 >= 0 && c2 <= 0 ) {
+        return v0 + e2*(a2/(a2-c2));
+    }
+    dReal va = b1*c2 - c1*b2;
+    if( va <= 0 && (b2-b1) >= 0 && (c1-c2) >= 0 ) {
+        return v1 + (v2-v1)*((b2-b1)/((b2-b1)+(c1-c2)));
+    }
+    dReal denom = 1/(va+vb+vc);
+    return v0 + e1*(vb*denom) + e2*(vc*denom);
+}
+
+/// \brief marks every voxel of a grid whose center is within half a voxel diagonal of the triangles.
+///
+/// This includes all voxels containing a point of the triangles, so every point of a triangle is within half a voxel
+/// diagonal of a marked voxel center.
+inline void RasterizeTriangles(const TriMesh& trimesh, const Vector& vorigin, dReal fcellsize, const int dims[3], std::vector<uint8_t>& voxels)
+{
+    dReal finvcell = 1/fcellsize, fradius = 0.5*RaveSqrt(dReal(3))*fcellsize, fradius2 = fradius*fradius;
+    for(size_t i = 0; i+2 < trimesh.indices.size(); i += 3) {
+        const Vector& v0 = trimesh.vertices.at(trimesh.indices[i]), &v1 = trimesh.vertices.at(trimesh.indices[i+1]), &v2 = trimesh.vertices.at(trimesh.indices[i+2]);
+        Vector vnormal = (v1-v0).cross(v2-v0);
+        dReal fnormallength = RaveSqrt(vnormal.lengthsqr3());
+        if( fnormallength > 0 ) {
+            vnormal *= 1/fnormallength;
+        }
+        Vector vmin(min(v0.x,min(v1.x,v2.x)), min(v0.y,min(v1.y,v2.y)), min(v0.z,min(v1.z,v2.z)));
+        Vector vmax(max(v0.x,max(v1.x,v2.x)), max(v0.y,max(v1.y,v2.y)), max(v0.z,max(v1.z,v2.z)));
+        int imin[3], imax[3];
+        for(int j = 0; j < 3; ++j) {
+            imin[j] = max(0, (int)ceil((vmin[j]-fradius-vorigin[j])*finvcell-0.5));
+            imax[j] = min(dims[j]-1, (int)floor((vmax[j]+fradius-vorigin[j])*finvcell-0.5));
+        }
+        for(int iz = imin[2]; iz <= imax[2]; ++iz) {
+            for(int iy = imin[1]; iy <= imax[1]; ++iy) {
+                for(int ix = imin[0]; ix <= imax[0]; ++ix) {
+                    uint8_t& voxel = voxels[ix+dims[0]*(iy+dims[1]*iz)];
+                    if( voxel ) {
+                        continue;
+                    }
+                    Vector p = vorigin + Vector(ix+0.5,iy+0.5,iz+0.5)*fcellsize;
+                    if( fnormallength > 0 && RaveFabs(vnormal.dot3(p-v0)) > fradius ) {
+                        continue;
+                    }
+                    if( (ClosestPointOnTriangle(p,v0,v1,v2)-p).lengthsqr3() <= fradius2 ) {
+                        voxel = 1;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** \brief signed distance field of a set of triangle meshes sampled at the centers of a voxel grid
+
+    Voxels touched by a triangle are occupied, and so are the voxels enclosed by them. Free voxels store the distance to
+    the closest occupied voxel, occupied voxels store minus the distance to the closest free voxel. Because of the
+    discretization, the true distance of a point to the meshes is at most GetMargin() smaller than GetDistance().
+ */
+class DistanceField
+{
+public:
+    DistanceField() : _fcellsize(0) {
+        _dims[0] = _dims[1] = _dims[2] = 0;
+    }
+
+    /// \brief computes the field of the meshes, the grid covers their bounding box plus fpadding on every side
+    ///
+    /// \throw openrave_exception if the grid would have more than maxvoxels voxels
+    void Build(const std::vector<TriMesh>& vtrimeshes, dReal fcellsize, dReal fpadding, size_t maxvoxels)
+    {
+        bool bempty = true;
+        FOREACHC(ittrimesh, vtrimeshes) {
+            FOREACHC(itv, ittrimesh->vertices) {
+                if( bempty ) {
+                    _vmeshmin = _vmeshmax = *itv;
+                    bempty = false;
+                }
+                else {
+                    _vmeshmin = Vector(min(_vmeshmin.x,itv->x),min(_vmeshmin.y,itv->y),min(_vmeshmin.z,itv->z));
+                    _vmeshmax = Vector(max(_vmeshmax.x,itv->x),max(_vmeshmax.y,itv->y),max(_vmeshmax.z,itv->z));
+                }
+            }
+        }
+        if( bempty ) {
+            throw OPENRAVE_EXCEPTION_FORMAT0("no geometry to build the distance field from", ORE_InvalidArguments);
+        }
+        // at least two free layers around the meshes so the flood fill can go around them
+        fpadding = max(fpadding, 2*fcellsize);
+        _fcellsize = fcellsize;
+        _vorigin = _vmeshmin - Vector(fpadding,fpadding,fpadding);
+        Vector vsize = _vmeshmax - _vmeshmin + Vector(2*fpadding,2*fpadding,2*fpadding);
+        _dims[0] = (int)ceil(vsize.x/fcellsize);
+        _dims[1] = (int)ceil(vsize.y/fcellsize);
+        _dims[2] = (int)ceil(vsize.z/fcellsize);
+        size_t numvoxels = (size_t)_dims[0]*(size_t)_dims[1]*(size_t)_dims[2];
+        if( numvoxels > maxvoxels ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("distance field needs %dx%dx%d voxels, more than the maximum %d, increase the cell size", _dims[0]%_dims[1]%_dims[2]%maxvoxels, ORE_InvalidArguments);
+        }
+
+        std::vector<uint8_t> voxels(numvoxels,0);
+        FOREACHC(ittrimesh, vtrimeshes) {
+            RasterizeTriangles(*ittrimesh, _vorigin, _fcellsize, _dims, voxels);
+        }
+        _FillInterior(voxels);
+
+        // squared distance of the free voxels to the occupied ones and of the occupied voxels to the free ones
+        std::vector<float> voutside(numvoxels), vinside(numvoxels);
+        for(size_t i = 0; i < numvoxels; ++i) {
+            voutside[i] = voxels[i] ? 0 : s_fInf;
+            vinside[i] = voxels[i] ? s_fInf : 0;
+        }
+        _DistanceTransform(voutside);
+        _DistanceTransform(vinside);
+        _vdistances.resize(numvoxels);
+        for(size_t i = 0; i < numvoxels; ++i) {
+            _vdistances[i] = voxels[i] ? -_fcellsize*RaveSqrt(vinside[i]) : _fcellsize*RaveSqrt(voutside[i]);
+        }
+    }
+
+    void Clear()
+    {
+        _vdistances.clear();
+        _dims[0] = _dims[1] = _dims[2] = 0;
+    }
+
+    bool IsValid() const {
+        return _vdistances.size() > 0;
+    }
+
+    /// \brief signed distance stored at the voxel containing the point.
+    ///
+    /// Outside of the grid, this is the distance to the bounding box of the meshes, which is never larger than the true distance.
+    inline dReal GetDistance(const Vector& p) const
+    {
+        dReal fx = (p.x-_vorigin.x)/_fcellsize, fy = (p.y-_vorigin.y)/_fcellsize, fz = (p.z-_vorigin.z)/_fcellsize;
+        if( fx >= 0 && fy >= 0 && fz >= 0 ) {
+            int ix = (int)fx, iy = (int)fy, iz = (int)fz;
+            if( ix < _dims[0] && iy < _dims[1] && iz < _dims[2] ) {
+                return _vdistances[ix+_dims[0]*(iy+_dims[1]*iz)];
+            }
+        }
+        Vector vdelta(max(dReal(0),max(_vmeshmin.x-p.x,p.x-_vmeshmax.x)), max(dReal(0),max(_vmeshmin.y-p.y,p.y-_vmeshmax.y)), max(dReal(0),max(_vmeshmin.z-p.z,p.z-_vmeshmax.z)));
+        return RaveSqrt(vdelta.lengthsqr3());
+    }
+
+    /// \brief how much GetDistance can overestimate the distance to the meshes.
+    ///
+    /// The point is within half a voxel diagonal of its voxel center, and the voxel containing the closest mesh point is
+    /// occupied and has its center within half a diagonal of it.
+    dReal GetMargin() const {
+        return _fcellsize*RaveSqrt(dReal(3));
+    }
+
+    dReal GetCellSize() const {
+        return _fcellsize;
+    }
+
+    size_t GetNumVoxels() const {
+        return _vdistances.size();
+    }
+
+private:
+    static const float s_fInf;
+    static const int s_nBlockSize = 16;
+
+    /// \brief marks the free voxels that cannot be reached from the border of the grid as occupied
+    void _FillInterior(std::vector<uint8_t>& voxels)
+    {
+        // 2 marks the voxels reached from the outside, the corner is free because of the padding.
+        // Every seed is extended to its run of free voxels along x, and one seed is pushed for each run of free voxels
+        // next to it along y and z.
+        int strides[3] = { 1, _dims[0], _dims[0]*_dims[1] };
+        std::vector<int> vstack;
+        vstack.push_back(0);
+        while(vstack.size() > 0) {
+            int index = vstack.back();
+            vstack.pop_back();
+            if( voxels[index] != 0 ) {
+                continue;
+            }
+            int iyz = index/_dims[0];
+            int rowstart = iyz*_dims[0], rowend = rowstart+_dims[0];
+            int left = index, right = index;
+            while(left > rowstart && voxels[left-1] == 0) {
+                --left;
+            }
+            while(right+1 < rowend && voxels[right+1] == 0) {
+                ++right;
+            }
+            for(int i = left; i <= right; ++i) {
+                voxels[i] = 2;
+            }
+            int iy = iyz%_dims[1], iz = iyz/_dims[1];
+            int neighbors[4] = { iy > 0 ? -strides[1] : 0, iy+1 < _dims[1] ? strides[1] : 0, iz > 0 ? -strides[2] : 0, iz+1 < _dims[2] ? strides[2] : 0 };
+            for(int ineighbor = 0; ineighbor < 4; ++ineighbor) {
+                if( neighbors[ineighbor] == 0 ) {
+                    continue;
+                }
+                bool bprevfree = false;
+                for(int i = left+neighbors[ineighbor]; i <= right+neighbors[ineighbor]; ++i) {
+                    bool bfree = voxels[i] == 0;
+                    if( bfree && !bprevfree ) {
+                        vstack.push_back(i);
+                    }
+                    bprevfree = bfree;
+                }
+            }
+        }
+        FOREACH(it, voxels) {
+            *it = *it != 2;
+        }
+    }
+
+    /// \brief exact squared euclidean distance transform in voxel units, done as one dimensional transforms along each axis
+    ///
+    /// Along y and z, s_nBlockSize neighboring lines are copied at once so that the grid is read and written in contiguous pieces.
+    void _DistanceTransform(std::vector<float>& vgrid)
+    {
+        int maxdim = max(_dims[0],max(_dims[1],_dims[2]));
+        std::vector<float> f(maxdim*s_nBlockSize), d(maxdim*s_nBlockSize), z(maxdim+1);
+        std::vector<int> v(maxdim);
+        int strides[3] = { 1, _dims[0], _dims[0]*_dims[1] };
+        for(int iaxis = 0; iaxis < 3; ++iaxis) {
+            int n = _dims[iaxis], stride = strides[iaxis];
+            // the lines along x are contiguous, the lines along y and z are grouped by blocks of x
+            int a1 = iaxis == 0 ? 1 : 0, a2 = iaxis == 2 ? 1 : 2;
+            int blocksize = iaxis == 0 ? 1 : s_nBlockSize;
+            for(int i2 = 0; i2 < _dims[a2]; ++i2) {
+                for(int i1 = 0; i1 < _dims[a1]; i1 += blocksize) {
+                    int nlines = min(blocksize, _dims[a1]-i1);
+                    int offset = i1*strides[a1] + i2*strides[a2];
+                    for(int i = 0; i < n; ++i) {
+                        const float* pgrid = &vgrid[offset+i*stride];
+                        for(int iline = 0; iline < nlines; ++iline) {
+                            f[iline*n+i] = pgrid[iline];
+                        }
+                    }
+                    for(int iline = 0; iline < nlines; ++iline) {
+                        _DistanceTransform1D(&f[iline*n], n, &d[iline*n], &v[0], &z[0]);
+                    }
+                    for(int i = 0; i < n; ++i) {
+                        float* pgrid = &vgrid[offset+i*stride];
+                        for(int iline = 0; iline < nlines; ++iline) {
+                            pgrid[iline] = d[iline*n+i];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /// \brief lower envelope of the parabolas rooted at the finite samples of f, see Felzenszwalb and Huttenlocher, "Distance Transforms of Sampled Functions"
+    static void _DistanceTransform1D(const float* f, int n, float* d, int* v, float* z)
+    {
+        int k = -1;
+        for(int q = 0; q < n; ++q) {
+            if( f[q] >= s_fInf ) {
+                continue;
+            }
+            float s = -s_fInf;
+            while( k >= 0 ) {
+                s = ((f[q]+float(q)*q)-(f[v[k]]+float(v[k])*v[k]))/(2*q-2*v[k]);
+                if( s > z[k] ) {
+                    break;
+                }
+                --k;
+            }
+            ++k;
+            v[k] = q;
+            z[k] = k == 0 ? -s_fInf : s;
+            z[k+1] = s_fInf;
+        }
+        if( k < 0 ) {
+            for(int q = 0; q < n; ++q) {
+                d[q] = s_fInf;
+            }
+            return;
+        }
+        k = 0;
+        for(int q = 0; q < n; ++q) {
+            while( z[k+1] < q ) {
+                ++k;
+            }
+            d[q] = float(q-v[k])*(q-v[k]) + f[v[k]];
+        }
+    }
+
+    Vector _vorigin; ///< corner of the first voxel
+    Vector _vmeshmin, _vmeshmax; ///< bounding box of the meshes
+    dReal _fcellsize;
+    int _dims[3];
+    std::vector<float> _vdistances; ///< x changes fastest
+};
+
+const float DistanceField::s_fInf = 1e30f;
+
+#endif
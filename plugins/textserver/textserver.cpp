@@ -17,6 +17,8 @@
 #include "textserver.h"
 #include <openrave/plugin.h>
 
+const uint32_t SimpleTextServer::Connection::s_nMaxRequestSize;
+
 InterfaceBasePtr CreateInterfaceValidated(InterfaceType type, const std::string& interfacename, std::istream& sinput, EnvironmentBasePtr penv)
 {
     switch(type) {
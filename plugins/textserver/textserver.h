@@ -23,7 +23,10 @@
 #ifndef _WIN32
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <poll.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <errno.h>
 #else
 // for some reason there's a clash between winsock.h and winsock2.h, so don't include winsockX directly. Also cannot define WIN32_LEAN_AND_MEAN for vc100
 #undef WIN32_LEAN_AND_MEAN
@@ -41,208 +44,207 @@ typedef int socklen_t;
 #define CLOSESOCKET close
 #endif
 
-/// manages all connections. At the moment, server can handle only one connectino at a time
+#ifdef __linux__
+#include <sys/epoll.h>
+#define TEXTSERVER_USE_EPOLL
+// do not raise SIGPIPE when the client closed the connection
+#define TEXTSERVER_SENDFLAGS MSG_NOSIGNAL
+#else
+#define TEXTSERVER_SENDFLAGS 0
+#endif
+
+/// \brief manages all connections
+///
+/// One event loop thread accepts the connections and reads the requests of all clients (epoll on linux, poll on other posix systems, select on windows).
+/// The requests are executed by a pool of command threads, functions that have to be ordered with the environment are
+/// still scheduled on the single worker thread.
 class SimpleTextServer : public ModuleBase
 {
-    // socket just accepts connections
-    class Socket
+    /// \brief a client connection
+    ///
+    /// The event loop is the only one reading from the socket. Complete requests are queued on the connection and executed
+    /// in order by at most one command thread at a time, so a client can pipeline many requests without waiting for the
+    /// replies and still receives the replies in the order it sent the requests. The socket is closed when the last reference goes away.
+    class Connection
     {
 public:
-        struct PACKET
-        {
-            string cmd, arg;
-        };
-
-        Socket() {
-            bInit = false;
-            client_sockfd = 0;
-        }
-        ~Socket() {
-            if( bInit )
-                Close();
-        }
-        bool Accept(int server_sockfd)
-        {
-            if( bInit )
-                Close();
-
-            bool success = true;
-
-            //signal(SIGCHLD, SIG_IGN);
-            //RAVELOG(L"server waiting for connection, %d\n", server_sockfd);
-
-            //	char str[sizeof(server_address)+1];
-            //	memcpy(str, &server_address, sizeof(server_address));
-            //	str[sizeof(server_address)] = 0;
-
-            client_len = sizeof(client_address);
-            client_sockfd = accept(server_sockfd, (struct sockaddr *)&client_address, (socklen_t*)&client_len);
-
-            if( client_sockfd == -1 ) {
-                success = false;
-                client_sockfd = 0;
-            }
-
-            bInit = success;
-
-            return bInit;
+        Connection(int sockfd) : _bProcessing(false), _sockfd(sockfd), _nScanOffset(0) {
         }
-        void Close()
-        {
-            if( bInit ) {
-                // close
-                CLOSESOCKET(client_sockfd); client_sockfd = 0;
-                bInit = false;
-            }
+        ~Connection() {
+            CLOSESOCKET(_sockfd);
         }
 
-        /// returns true if connection is valid, otherwise false
-        bool IsInit() {
-            return bInit;
+        int GetSocket() const {
+            return _sockfd;
         }
 
-        void SendData(const void* pdata, int size_to_write)
+        /// \brief reads the available data from the socket and appends all complete requests to listrequests
+        ///
+        /// Reads at most nMaxBytes so that one client sending a lot of data cannot starve the others.
+        /// The requests received before the connection was closed are still returned, so a client can send its
+        /// requests and shut down its side of the socket right away.
+        /// \return false if the connection was closed, has an error, or the client sent a request larger than s_nMaxRequestSize
+        bool Receive(list<string>& listrequests, size_t nMaxBytes)
         {
-            if( client_sockfd == 0 )
-                return;
-
-            int nBytesReceived;
-
-#ifndef _WIN32
-            // check if closed, only for linux systems
-            struct timeval tv;
-            fd_set exfds, writefds;
-
-            tv.tv_sec = 0;
-            tv.tv_usec = 0;
-
-            FD_ZERO(&exfds);
-            FD_ZERO(&writefds);
-            FD_SET(client_sockfd, &exfds);
-
-            // don't care about writefds and exceptfds:
-            int num = select(client_sockfd+1, NULL, NULL, &exfds, &tv);
-
-            if (( num > 0) && FD_ISSET(client_sockfd, &exfds) ) {
-                RAVELOG_ERROR("socket exception detected\n");
-                Close();
-                return;
-            }
-
-            FD_SET(client_sockfd, &writefds);
-
-            // don't care about writefds and exceptfds:
-            num = select(client_sockfd+1, NULL, &writefds, NULL, &tv);
-
-            if (( num == 0) || !FD_ISSET(client_sockfd, &writefds) ) {
-                RAVELOG_WARN("no writable socket\n");
-                return;
-            }
-
-            /*int ret = recv(client_sockfd, NULL, 0, MSG_PEEK|MSG_DONTWAIT);
-               if( ret == 0 ) {
-               RAVEPRINT(L"socket close detected\n");
-               Close();
-               return;
-               }*/
-#endif
-
-            char* pbuf = (char*)pdata;
-
-            if( (nBytesReceived = send(client_sockfd, (char*)&size_to_write, 4, 0)) != 4 ) {
-                RAVELOG_ERROR("failed to send command: %d\n", nBytesReceived);
-                return;
-            }
-
-            while(size_to_write > 0 ) {
-                nBytesReceived = send(client_sockfd, pbuf, size_to_write, 0);
-                if( nBytesReceived <= 0 ) {
-                    if( nBytesReceived == -1 )
-                        return;
-
-                    //perror("failed to read line");
-                    continue;
+            char buf[16384];
+            size_t nread = 0;
+            while(nread < nMaxBytes) {
+                int n = recv(_sockfd, buf, sizeof(buf), 0);
+                if( n > 0 ) {
+                    _inbuf.append(buf, n);
+                    nread += n;
+                }
+                else if( n == 0 ) {
+                    // the last line does not need a line ending when the client closed its side
+                    if( _ParseRequests(listrequests) && _inbuf.size() > 0 && _inbuf[0] != 0 ) {
+                        listrequests.push_back(_inbuf);
+                        _inbuf.clear();
+                    }
+                    return false;
+                }
+                else if( _IsWouldBlock() ) {
+                    break;
+                }
+                else {
+                    _ParseRequests(listrequests);
+                    return false;
                 }
-
-                size_to_write -= nBytesReceived;
-                pbuf += nBytesReceived;
             }
+            return _ParseRequests(listrequests);
         }
 
-
-        bool ReadLine(string& s)
+        /// \brief sends a reply, the client gets the 4 byte size followed by the data. Safe to call from any thread.
+        bool SendData(const void* pdata, int size_to_write)
         {
-            struct timeval tv;
-            fd_set readfds, exfds;
-            s.resize(0);
-
-            tv.tv_sec = 0;
-            tv.tv_usec = 0;
-
-
-            FD_ZERO(&exfds);
-            FD_SET(client_sockfd, &exfds);
-
-            // don't care about writefds and exceptfds:
-            int num = select(client_sockfd+1, NULL, NULL, &exfds, &tv);
-
-            if (( num > 0) && FD_ISSET(client_sockfd, &exfds) ) {
-                RAVELOG_ERROR("socket exception detected\n");
-                Close();
+            boost::mutex::scoped_lock lock(_mutexSend);
+            if( !_SendAll(&size_to_write, 4) ) {
+                RAVELOG_ERROR("failed to send reply size\n");
                 return false;
             }
+            return _SendAll(pdata, size_to_write);
+        }
 
-            FD_ZERO(&readfds);
-            FD_SET(client_sockfd, &readfds);
-
-            // don't care about writefds and exceptfds:
-            num = select(client_sockfd+1, &readfds, NULL, NULL, &tv);
+        boost::mutex _mutex;         ///< protects _listrequests and _bProcessing
+        list<string> _listrequests;     ///< requests waiting to be executed
+        bool _bProcessing;     ///< true if a command thread is executing the requests of this connection
 
-            if (( num == 0) || !FD_ISSET(client_sockfd, &readfds) ) {
+private:
+        /// \brief extracts the complete requests from the input buffer
+        ///
+        /// A request is either a text line terminated by '\\n' or '\\r', or a binary frame: a 0 byte, the payload size
+        /// as a 4 byte integer in host byte order (same as the reply size), and the payload. The payload is the command
+        /// followed by its arguments and can contain newlines, so large data like trajectories or point clouds can be sent
+        /// without the server having to scan it.
+        /// \return false if a request is larger than s_nMaxRequestSize, the client is sent an error and the requests after it are dropped
+        bool _ParseRequests(list<string>& listrequests)
+        {
+            size_t pos = 0;
+            bool bValid = true;
+            while(pos < _inbuf.size()) {
+                if( _inbuf[pos] == 0 ) {
+                    if( _inbuf.size()-pos < 5 ) {
+                        break;
+                    }
+                    uint32_t payloadsize;
+                    memcpy(&payloadsize, &_inbuf[pos+1], 4);
+                    if( payloadsize > s_nMaxRequestSize ) {
+                        RAVELOG_WARN(str(boost::format("closing connection, request of %d bytes is larger than the maximum of %d bytes\n")%payloadsize%s_nMaxRequestSize));
+                        bValid = false;
+                        break;
+                    }
+                    if( _inbuf.size()-pos-5 < payloadsize ) {
+                        // reserve the whole frame to avoid reallocating on every recv
+                        _inbuf.reserve(pos+5+payloadsize);
+                        break;
+                    }
+                    listrequests.push_back(_inbuf.substr(pos+5, payloadsize));
+                    pos += 5+payloadsize;
+                }
+                else {
+                    // do not rescan the part of the line that was already received
+                    size_t end = _inbuf.find_first_of("\r\n", max(pos, _nScanOffset));
+                    if( end == string::npos ) {
+                        if( _inbuf.size()-pos > s_nMaxRequestSize ) {
+                            RAVELOG_WARN(str(boost::format("closing connection, line is longer than the maximum of %d bytes\n")%s_nMaxRequestSize));
+                            bValid = false;
+                            break;
+                        }
+                        _nScanOffset = _inbuf.size();
+                        break;
+                    }
+                    if( end > pos ) {
+                        listrequests.push_back(_inbuf.substr(pos, end-pos));
+                    }
+                    pos = end+1;
+                }
+            }
+            if( !bValid ) {
+                SendData("error\n", 6);
+                _inbuf.clear();
+                _nScanOffset = 0;
                 return false;
             }
+            _inbuf.erase(0, pos);
+            _nScanOffset = _nScanOffset > pos ? _nScanOffset-pos : 0;
+            return true;
+        }
 
-            // protocol: size1 size2 "size1 bytes" "size2 bytes"
-            long nBytesReceived;
-            char c;
-            int failed = 0;
-
-            while(1) {
-                if( (nBytesReceived = recv(client_sockfd, &c, sizeof(char), 0)) > 0 ) {
-                    if(( c == '\n') ||( c == '\r') ) {
-                        break;
-                    }
-                    s.push_back(c);
+        bool _SendAll(const void* pdata, int size_to_write)
+        {
+            const char* pbuf = (const char*)pdata;
+            while(size_to_write > 0 ) {
+                int nBytesSent = send(_sockfd, pbuf, size_to_write, TEXTSERVER_SENDFLAGS);
+                if( nBytesSent > 0 ) {
+                    size_to_write -= nBytesSent;
+                    pbuf += nBytesSent;
                 }
-                else if( nBytesReceived == 0 ) {
-                    //RAVELOG_DEBUG("closing connection\n");
-                    //  Close();
-                    return false;
+                else if( nBytesSent < 0 && _IsWouldBlock() ) {
+                    // the socket is nonblocking and its buffer is full, so wait until the client reads some data
+#ifdef _WIN32
+                    struct timeval tv;
+                    tv.tv_sec = 5;
+                    tv.tv_usec = 0;
+                    fd_set writefds;
+                    FD_ZERO(&writefds);
+                    FD_SET(_sockfd, &writefds);
+                    int ret = select(_sockfd+1, NULL, &writefds, NULL, &tv);
+#else
+                    // poll since select cannot watch descriptors above FD_SETSIZE
+                    struct pollfd pfd;
+                    pfd.fd = _sockfd;
+                    pfd.events = POLLOUT;
+                    pfd.revents = 0;
+                    int ret = poll(&pfd, 1, 5000);
+#endif
+                    if( ret <= 0 ) {
+                        RAVELOG_WARN("no writable socket\n");
+                        return false;
+                    }
                 }
                 else {
-                    if( failed < 10 ) {
-                        failed++;
-                        usleep(1000);
-                        continue;
-                    }
-                    perror("failed to read line");
-                    Close();
                     return false;
                 }
             }
-
             return true;
         }
 
-private:
-        int client_sockfd;
-        int client_len;
+        static bool _IsWouldBlock()
+        {
+#ifdef _WIN32
+            return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+#endif
+        }
+
+        static const uint32_t s_nMaxRequestSize = 256*1024*1024;     ///< larger requests close the connection
 
-        struct sockaddr_in client_address;
-        bool bInit;
+        int _sockfd;
+        string _inbuf;     ///< received data that has not been parsed into requests yet, only accessed by the event loop
+        size_t _nScanOffset;     ///< _inbuf before this offset has no line ending
+        boost::mutex _mutexSend;
     };
-    typedef boost::shared_ptr<Socket> SocketPtr;
-    typedef boost::shared_ptr<Socket const> SocketConstPtr;
+    typedef boost::shared_ptr<Connection> ConnectionPtr;
 
     /// \param in is the data passed from the network
     /// \param out is the return data that will be passed to the client
@@ -269,8 +271,14 @@ public:
         _nIdIndex = 1;
         _nNextFigureId = 1;
         _bWorking = false;
+        bInitThread = false;
+        bCloseThread = false;
         bDestroying = false;
-        __description=":Interface Author: Rosen Diankov\n\nSimple text-based server using sockets.";
+        server_sockfd = -1;
+#ifdef TEXTSERVER_USE_EPOLL
+        _epollfd = -1;
+#endif
+        __description=":Interface Author: Rosen Diankov\n\nSimple text-based server using sockets. Start with `port [numthreads]`, where numthreads is the number of threads executing the commands (default is the number of cpus, at least 4).\n\nRequests are either text lines, or binary frames made of a 0 byte, the payload size as a 4 byte integer, and the payload. Requests can be pipelined, replies are sent in the order of the requests.";
         mapNetworkFns["body_checkcollision"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orEnvCheckCollision, this, _1, _2, _3), OpenRaveWorkerFn(), true);
         mapNetworkFns["body_getjoints"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyGetJointValues, this,_1, _2, _3), OpenRaveWorkerFn(), true);
         mapNetworkFns["body_destroy"] = RAVENETWORKFN(boost::bind(&SimpleTextServer::orBodyDestroy,this,_1,_2,_3), OpenRaveWorkerFn(), false);
@@ -330,8 +338,13 @@ public:
     virtual int main(const std::string& cmd)
     {
         _nPort = 4765;
+        int numthreads = 0;
         stringstream ss(cmd);
-        ss >> _nPort;
+        ss >> _nPort >> numthreads;
+        if( numthreads <= 0 ) {
+            // commands like wait can block a thread for a long time, so always have a few
+            numthreads = max(4, (int)boost::thread::hardware_concurrency());
+        }
 
         Destroy();
 
@@ -400,9 +413,24 @@ public:
 #endif
 #endif
 
-        RAVELOG_INFO("text server listening on port %d\n",_nPort);
-        _servthread.reset(new boost::thread(boost::bind(&SimpleTextServer::_listen_threadcb,this)));
+#ifdef TEXTSERVER_USE_EPOLL
+        _epollfd = epoll_create(64);
+        if( _epollfd < 0 ) {
+            RAVELOG_ERROR("failed to create epoll instance, error=%d\n", errno);
+            return -1;
+        }
+#endif
+        if( !_PollAdd(server_sockfd) ) {
+            RAVELOG_ERROR("failed to poll server port %d\n", _nPort);
+            return -1;
+        }
+
+        RAVELOG_INFO("text server listening on port %d with %d command threads\n",_nPort,numthreads);
+        _servthread.reset(new boost::thread(boost::bind(&SimpleTextServer::_event_threadcb,this)));
         _workerthread.reset(new boost::thread(boost::bind(&SimpleTextServer::_worker_threadcb,this)));
+        for(int i = 0; i < numthreads; ++i) {
+            _listCommandThreads.push_back(boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&SimpleTextServer::_command_threadcb,this))));
+        }
         bInitThread = true;
         return 0;
     }
@@ -429,11 +457,14 @@ public:
             }
             _servthread.reset();
 
-            FOREACH(it, _listReadThreads) {
+            _condCommands.notify_all();
+            FOREACH(it, _listCommandThreads) {
                 _condWorker.notify_all();
                 (*it)->join();
             }
-            _listReadThreads.clear();
+            _listCommandThreads.clear();
+            _listCommands.clear();
+            _mapConnections.clear();
             _condHasWork.notify_all();
             if( !!_workerthread ) {
                 _workerthread->join();
@@ -442,9 +473,16 @@ public:
 
             bCloseThread = false;
             bInitThread = false;
+        }
 
-            CLOSESOCKET(server_sockfd); server_sockfd = 0;
+        if( server_sockfd >= 0 ) {
+            CLOSESOCKET(server_sockfd); server_sockfd = -1;
         }
+#ifdef TEXTSERVER_USE_EPOLL
+        if( _epollfd >= 0 ) {
+            close(_epollfd); _epollfd = -1;
+        }
+#endif
 
         bDestroying = false;
     }
@@ -533,129 +571,300 @@ private:
         }
     }
 
-    void _listen_threadcb()
+    /// \brief adds a socket to the sockets watched by the event loop
+    bool _PollAdd(int sockfd)
     {
-        SocketPtr psocket(new Socket());
+#ifdef TEXTSERVER_USE_EPOLL
+        struct epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.fd = sockfd;
+        return epoll_ctl(_epollfd, EPOLL_CTL_ADD, sockfd, &event) == 0;
+#else
+        return true; // poll and select use server_sockfd and _mapConnections directly
+#endif
+    }
 
-        while(!bCloseThread) {
+    void _PollRemove(int sockfd)
+    {
+#ifdef TEXTSERVER_USE_EPOLL
+        struct epoll_event event;     // non-NULL for kernels before 2.6.9
+        epoll_ctl(_epollfd, EPOLL_CTL_DEL, sockfd, &event);
+#endif
+    }
 
-            // finally initialize the socket
-            if( !psocket->Accept(server_sockfd) ) {
-                usleep(100000);
-                continue;
+    /// \brief waits at most timeout milliseconds for sockets with data to read, a closed connection also counts as readable
+    void _PollWait(vector<int>& vsockfds, int timeout)
+    {
+        vsockfds.resize(0);
+#ifdef TEXTSERVER_USE_EPOLL
+        struct epoll_event events[64];
+        int num = epoll_wait(_epollfd, events, 64, timeout);
+        for(int i = 0; i < num; ++i) {
+            vsockfds.push_back(events[i].data.fd);
+        }
+#elif !defined(_WIN32)
+        // poll since select cannot watch descriptors above FD_SETSIZE
+        _vpollfds.resize(0);
+        struct pollfd pfd;
+        pfd.fd = server_sockfd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        _vpollfds.push_back(pfd);
+        FOREACH(it, _mapConnections) {
+            pfd.fd = it->first;
+            _vpollfds.push_back(pfd);
+        }
+        if( poll(&_vpollfds[0], _vpollfds.size(), timeout) > 0 ) {
+            FOREACHC(itpfd, _vpollfds) {
+                if( itpfd->revents != 0 ) {
+                    vsockfds.push_back(itpfd->fd);
+                }
+            }
+        }
+#else
+        fd_set readfds;
+        FD_ZERO(&readfds);
+        FD_SET(server_sockfd, &readfds);
+        int maxfd = server_sockfd;
+        FOREACH(it, _mapConnections) {
+            FD_SET(it->first, &readfds);
+            maxfd = max(maxfd, it->first);
+        }
+        struct timeval tv;
+        tv.tv_sec = timeout/1000;
+        tv.tv_usec = (timeout%1000)*1000;
+        if( select(maxfd+1, &readfds, NULL, NULL, &tv) > 0 ) {
+            if( FD_ISSET(server_sockfd, &readfds) ) {
+                vsockfds.push_back(server_sockfd);
+            }
+            FOREACH(it, _mapConnections) {
+                if( FD_ISSET(it->first, &readfds) ) {
+                    vsockfds.push_back(it->first);
+                }
             }
+        }
+#endif
+    }
 
-            // start a new thread
-            _listReadThreads.push_back(boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&SimpleTextServer::_read_threadcb,shared_server(), psocket))));
-            psocket.reset(new Socket());
+    void _AcceptConnections()
+    {
+        while(1) {
+            struct sockaddr_in client_address;
+            socklen_t client_len = sizeof(client_address);
+            int client_sockfd = accept(server_sockfd, (struct sockaddr *)&client_address, &client_len);
+            if( client_sockfd < 0 ) {
+                break;
+            }
+
+            // replies are small and latency matters more than throughput
+            int yes = 1;
+            setsockopt(client_sockfd, IPPROTO_TCP, TCP_NODELAY, (const char*)&yes, sizeof(int));
+#ifdef _WIN32
+            u_long flags = 1;
+            ioctlsocket(client_sockfd, FIONBIO, &flags);
+#else
+            fcntl(client_sockfd, F_SETFL, fcntl(client_sockfd, F_GETFL, 0) | O_NONBLOCK);
+#endif
+            ConnectionPtr pconnection(new Connection(client_sockfd));
+            if( !_PollAdd(client_sockfd) ) {
+                RAVELOG_ERROR("failed to poll new connection\n");
+                continue;
+            }
+            _mapConnections[client_sockfd] = pconnection;
+            RAVELOG_VERBOSE("started new server connection\n");
         }
+    }
 
+    /// \brief accepts connections and reads the requests of all clients
+    void _event_threadcb()
+    {
+        vector<int> vsockfds;
+        list<string> listrequests;
+        while(!bCloseThread) {
+            _PollWait(vsockfds, 100);
+            FOREACH(itfd, vsockfds) {
+                if( *itfd == server_sockfd ) {
+                    _AcceptConnections();
+                    continue;
+                }
+                map<int, ConnectionPtr>::iterator itconnection = _mapConnections.find(*itfd);
+                if( itconnection == _mapConnections.end() ) {
+                    continue;
+                }
+                ConnectionPtr pconnection = itconnection->second;
+                listrequests.clear();
+                bool bOpen = pconnection->Receive(listrequests, 1<<20);
+                if( listrequests.size() > 0 ) {
+                    boost::mutex::scoped_lock lock(pconnection->_mutex);
+                    pconnection->_listrequests.splice(pconnection->_listrequests.end(), listrequests);
+                    if( !pconnection->_bProcessing ) {
+                        pconnection->_bProcessing = true;
+                        ScheduleCommand(boost::bind(&SimpleTextServer::_ProcessConnection, this, pconnection));
+                    }
+                }
+                if( !bOpen ) {
+                    // the socket is closed once the queued requests are done
+                    RAVELOG_VERBOSE("Closing socket connection\n");
+                    _PollRemove(*itfd);
+                    _mapConnections.erase(itconnection);
+                }
+            }
+        }
+        _mapConnections.clear();
         RAVELOG_DEBUG("**Server thread exiting\n");
     }
 
-    void _read_threadcb(SocketPtr psocket)
+    void ScheduleCommand(const boost::function<void()>& fn)
     {
-        RAVELOG_VERBOSE("started new server connection\n");
-        string cmd, line;
-        stringstream sout;
-        while(!bCloseThread) {
-            if( psocket->ReadLine(line) && line.length() ) {
+        boost::mutex::scoped_lock lock(_mutexCommands);
+        _listCommands.push_back(fn);
+        _condCommands.notify_one();
+    }
 
-                if( !!flog &&( GetEnv()->GetDebugLevel()>0) ) {
-                    static int index=0;
-                    flog << index++ << ": " << line << endl;
+    /// \brief thread of the pool executing the commands of the connections
+    void _command_threadcb()
+    {
+        while(!bCloseThread) {
+            boost::function<void()> fn;
+            {
+                boost::mutex::scoped_lock lock(_mutexCommands);
+                while(_listCommands.size() == 0 && !bCloseThread) {
+                    _condCommands.timed_wait(lock, boost::posix_time::milliseconds(100));
                 }
+                if( bCloseThread ) {
+                    break;
+                }
+                fn = _listCommands.front();
+                _listCommands.pop_front();
+            }
+            fn();
+        }
+    }
 
-                boost::shared_ptr<istream> is(new stringstream(line));
-                *is >> cmd;
-                if( !*is ) {
-                    RAVELOG_ERROR("Failed to get command\n");
-                    psocket->SendData("error\n",1);
-                    continue;
+    /// \brief executes the queued requests of a connection in order until there are none left
+    void _ProcessConnection(ConnectionPtr pconnection)
+    {
+        stringstream sout;
+        string request;
+        while(!bCloseThread) {
+            {
+                boost::mutex::scoped_lock lock(pconnection->_mutex);
+                if( pconnection->_listrequests.size() == 0 ) {
+                    pconnection->_bProcessing = false;
+                    return;
                 }
-                std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
-                stringstream::streampos inputpos = is->tellg();
-
-                map<string, RAVENETWORKFN>::iterator itfn = mapNetworkFns.find(cmd);
-                if( itfn != mapNetworkFns.end() ) {
-                    bool bCallWorker = true;
-                    boost::shared_ptr<void> pdata;
-
-                    // need to set w.args before pcmdend is modified
-                    sout.str(""); sout.clear();
-                    if( !!itfn->second.fnSocketThread ) {
-                        bool bSuccess = false;
-                        try {
-                            bSuccess = itfn->second.fnSocketThread(*is, sout, pdata);
-                        }
-                        catch(const std::exception& ex) {
-                            RAVELOG_FATAL("server caught exception: %s\n",ex.what());
-                        }
-                        catch(...) {
-                            RAVELOG_FATAL("unknown exception!!\n");
-                        }
+                request.swap(pconnection->_listrequests.front());
+                pconnection->_listrequests.pop_front();
+            }
+            _ProcessRequest(pconnection, request, sout);
+        }
+    }
 
-                        if( bSuccess ) {
-                            if( itfn->second.bReturnResult ) {
-                                psocket->SendData(sout.str().c_str(), sout.str().size());
-                            }
-                            if( !itfn->second.fnWorker ) {
-                                bCallWorker = false;
-                            }
-                        }
-                        else {
-                            bCallWorker = false;
-                            if( !!flog  ) {
-                                flog << " error" << endl;
-                            }
-                            if( itfn->second.bReturnResult ) {
-                                psocket->SendData("error\n", 6);
-                            }
-                        }
-                    }
-                    else {
-                        if( itfn->second.bReturnResult ) {
-                            psocket->SendData(sout.str().c_str(), sout.str().size());     // return dummy
-                        }
-                        bCallWorker = !!itfn->second.fnWorker;
-                    }
+    void _ProcessRequest(ConnectionPtr pconnection, const string& line, stringstream& sout)
+    {
+        if( !!flog &&( GetEnv()->GetDebugLevel()>0) ) {
+            boost::mutex::scoped_lock lock(_mutexLog);
+            static int index=0;
+            flog << index++ << ": " << line << endl;
+        }
 
-                    if( bCallWorker ) {
-                        BOOST_ASSERT(!!itfn->second.fnWorker);
-                        is->clear();
-                        is->seekg(inputpos);
-                        ScheduleWorker(boost::bind(itfn->second.fnWorker,is,pdata));
-                    }
+        string cmd;
+        boost::shared_ptr<istream> is(new stringstream(line));
+        *is >> cmd;
+        if( !*is ) {
+            RAVELOG_ERROR("Failed to get command\n");
+            pconnection->SendData("error\n",1);
+            return;
+        }
+        std::transform(cmd.begin(), cmd.end(), cmd.begin(), ::tolower);
+        stringstream::streampos inputpos = is->tellg();
+
+        map<string, RAVENETWORKFN>::iterator itfn = mapNetworkFns.find(cmd);
+        if( itfn == mapNetworkFns.end() ) {
+            RAVELOG_ERROR("Failed to recognize command: %s\n", cmd.c_str());
+            pconnection->SendData("error\n",1);
+            return;
+        }
+
+        bool bCallWorker = true;
+        boost::shared_ptr<void> pdata;
+
+        // need to set w.args before pcmdend is modified
+        sout.str(""); sout.clear();
+        if( !!itfn->second.fnSocketThread ) {
+            bool bSuccess = false;
+            try {
+                bSuccess = itfn->second.fnSocketThread(*is, sout, pdata);
+            }
+            catch(const std::exception& ex) {
+                RAVELOG_FATAL("server caught exception: %s\n",ex.what());
+            }
+            catch(...) {
+                RAVELOG_FATAL("unknown exception!!\n");
+            }
+
+            if( bSuccess ) {
+                if( itfn->second.bReturnResult ) {
+                    pconnection->SendData(sout.str().c_str(), sout.str().size());
                 }
-                else {
-                    RAVELOG_ERROR("Failed to recognize command: %s\n", cmd.c_str());
-                    psocket->SendData("error\n",1);
+                if( !itfn->second.fnWorker ) {
+                    bCallWorker = false;
                 }
             }
-            else if( !psocket->IsInit() ) {
-                break;
+            else {
+                bCallWorker = false;
+                if( !!flog  ) {
+                    boost::mutex::scoped_lock lock(_mutexLog);
+                    flog << " error" << endl;
+                }
+                if( itfn->second.bReturnResult ) {
+                    pconnection->SendData("error\n", 6);
+                }
             }
-            usleep(1000);
+        }
+        else {
+            if( itfn->second.bReturnResult ) {
+                pconnection->SendData(sout.str().c_str(), sout.str().size());     // return dummy
+            }
+            bCallWorker = !!itfn->second.fnWorker;
         }
 
-        RAVELOG_VERBOSE("Closing socket connection\n");
+        if( bCallWorker ) {
+            BOOST_ASSERT(!!itfn->second.fnWorker);
+            is->clear();
+            is->seekg(inputpos);
+            ScheduleWorker(boost::bind(itfn->second.fnWorker,is,pdata));
+        }
     }
 
     int _nPort;     ///< port used for listening to incoming connections
 
     boost::shared_ptr<boost::thread> _servthread, _workerthread;
-    list<boost::shared_ptr<boost::thread> > _listReadThreads;
+    list<boost::shared_ptr<boost::thread> > _listCommandThreads;     ///< pool executing the requests of the connections
 
     boost::mutex _mutexWorker;
     boost::condition _condWorker;
     boost::condition _condHasWork;
 
+    boost::mutex _mutexCommands;
+    boost::condition _condCommands;
+    list<boost::function<void()> > _listCommands;
+
+    map<int, ConnectionPtr> _mapConnections;     ///< open connections indexed by socket, only accessed by the event loop
+    boost::mutex _mutexLog;
+
     bool bInitThread;
     bool bCloseThread;
     bool bDestroying;
 
     struct sockaddr_in server_address;
     int server_sockfd, server_len;
+#ifdef TEXTSERVER_USE_EPOLL
+    int _epollfd;
+#elif !defined(_WIN32)
+    vector<struct pollfd> _vpollfds; ///< descriptors watched by _PollWait, only used by the event loop
+#endif
 
     ofstream flog;
 
@@ -2308,7 +2517,7 @@ protected:
 #ifdef RAVE_REGISTER_BOOST
 #include BOOST_TYPEOF_INCREMENT_REGISTRATION_GROUP()
 
-BOOST_TYPEOF_REGISTER_TYPE(SimpleTextServer::Socket)
+BOOST_TYPEOF_REGISTER_TYPE(SimpleTextServer::Connection)
 BOOST_TYPEOF_REGISTER_TYPE(SimpleTextServer::WORKERSTRUCT)
 
 #endif
@@ -501,6 +501,73 @@ inline numeric::array toPyArray(const std::vector<T>& v, std::vector<npy_intp>&
     return toPyArrayN(&v[0],dims);
 }
 
+template <typename T> struct select_npy_type {};
+template <> struct select_npy_type<float> { enum { type = PyArray_FLOAT }; };
+template <> struct select_npy_type<double> { enum { type = PyArray_DOUBLE }; };
+template <> struct select_npy_type<uint8_t> { enum { type = PyArray_UINT8 }; };
+template <> struct select_npy_type<int> { enum { type = PyArray_INT32 }; };
+template <> struct select_npy_type<uint32_t> { enum { type = PyArray_UINT32 }; };
+
+#if PY_VERSION_HEX >= 0x02070000
+template <typename T>
+inline void _DeleteVectorCapsule(PyObject* pycapsule)
+{
+    delete static_cast<std::vector<T>*>(PyCapsule_GetPointer(pycapsule, NULL));
+}
+#else
+template <typename T>
+inline void _DeleteVectorCObject(void* pvector)
+{
+    delete static_cast<std::vector<T>*>(pvector);
+}
+#endif
+
+/// \brief returns a numpy array that takes over the buffer of v instead of copying it, v is empty afterwards.
+///
+/// Use for large outputs that are computed into a temporary vector.
+template <typename T>
+inline numeric::array toPyArraySwap(std::vector<T>& v, std::vector<npy_intp>& dims)
+{
+    if( v.size() == 0 ) {
+        return toPyArrayN((T*)NULL,dims);
+    }
+    size_t totalsize = 1;
+    FOREACH(it,dims)
+    totalsize *= *it;
+    BOOST_ASSERT(totalsize == v.size());
+    std::vector<T>* pvector = new std::vector<T>();
+    pvector->swap(v);
+    PyObject *pyvalues = PyArray_SimpleNewFromData(dims.size(), &dims[0], select_npy_type<T>::type, &(*pvector)[0]);
+    if( !pyvalues ) {
+        delete pvector;
+        throw_error_already_set();
+    }
+    handle<> hvalues(pyvalues);
+#if PY_VERSION_HEX >= 0x02070000
+    PyObject *pybase = PyCapsule_New(pvector, NULL, _DeleteVectorCapsule<T>);
+#else
+    PyObject *pybase = PyCObject_FromVoidPtr(pvector, _DeleteVectorCObject<T>);
+#endif
+    if( !pybase ) {
+        delete pvector;
+        throw_error_already_set();
+    }
+    // the array keeps the vector alive through its base object
+#if defined(NPY_API_VERSION) && NPY_API_VERSION >= 0x00000007
+    PyArray_SetBaseObject((PyArrayObject*)pyvalues, pybase);
+#else
+    PyArray_BASE(pyvalues) = pybase;
+#endif
+    return static_cast<numeric::array>(hvalues);
+}
+
+template <typename T>
+inline numeric::array toPyArraySwap(std::vector<T>& v)
+{
+    std::vector<npy_intp> dims(1, v.size());
+    return toPyArraySwap(v, dims);
+}
+
 template <typename T, int N>
 inline numeric::array toPyArray(const boost::array<T,N>& v)
 {
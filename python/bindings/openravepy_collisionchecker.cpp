@@ -143,12 +143,19 @@ public:
     bool CheckCollision(PyKinBodyPtr pbody1)
     {
         CHECK_POINTER(pbody1);
-        return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)));
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)));
+        }
     }
     bool CheckCollision(PyKinBodyPtr pbody1, PyCollisionReportPtr pReport)
     {
         CHECK_POINTER(pbody1);
-        bool bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,_pyenv);
         return bCollision;
     }
@@ -157,14 +164,21 @@ public:
     {
         CHECK_POINTER(pbody1);
         CHECK_POINTER(pbody2);
-        return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)));
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)));
+        }
     }
 
     bool CheckCollision(PyKinBodyPtr pbody1, PyKinBodyPtr pbody2, PyCollisionReportPtr pReport)
     {
         CHECK_POINTER(pbody1);
         CHECK_POINTER(pbody2);
-        bool bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)), openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)), openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,_pyenv);
         return bCollision;
     }
@@ -174,11 +188,17 @@ public:
         CHECK_POINTER(o1);
         KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
         if( !!plink ) {
-            return _pCollisionChecker->CheckCollision(plink);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _pCollisionChecker->CheckCollision(plink);
+            }
         }
         KinBodyConstPtr pbody = openravepy::GetKinBody(o1);
         if( !!pbody ) {
-            return _pCollisionChecker->CheckCollision(pbody);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _pCollisionChecker->CheckCollision(pbody);
+            }
         }
         throw OPENRAVE_EXCEPTION_FORMAT0("CheckCollision(object) invalid argument",ORE_InvalidArguments);
     }
@@ -189,12 +209,18 @@ public:
         KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
         bool bCollision;
         if( !!plink ) {
-            bCollision = _pCollisionChecker->CheckCollision(plink,openravepy::GetCollisionReport(pReport));
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _pCollisionChecker->CheckCollision(plink,openravepy::GetCollisionReport(pReport));
+            }
         }
         else {
             KinBodyConstPtr pbody = openravepy::GetKinBody(o1);
             if( !!pbody ) {
-                bCollision = _pCollisionChecker->CheckCollision(pbody,openravepy::GetCollisionReport(pReport));
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _pCollisionChecker->CheckCollision(pbody,openravepy::GetCollisionReport(pReport));
+                }
             }
             else {
                 throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument",ORE_InvalidArguments);
@@ -212,15 +238,25 @@ public:
         if( !!plink ) {
             KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
             if( !!plink2 ) {
-                return _pCollisionChecker->CheckCollision(plink,plink2);
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    return _pCollisionChecker->CheckCollision(plink,plink2);
+                }
             }
             KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
             if( !!pbody2 ) {
-                return _pCollisionChecker->CheckCollision(plink,pbody2);
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    return _pCollisionChecker->CheckCollision(plink,pbody2);
+                }
             }
             CollisionReportPtr preport2 = openravepy::GetCollisionReport(o2);
             if( !!preport2 ) {
-                bool bCollision = _pCollisionChecker->CheckCollision(plink,preport2);
+                bool bCollision;
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _pCollisionChecker->CheckCollision(plink,preport2);
+                }
                 openravepy::UpdateCollisionReport(o2,_pyenv);
                 return bCollision;
             }
@@ -230,15 +266,25 @@ public:
         if( !!pbody ) {
             KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
             if( !!plink2 ) {
-                return _pCollisionChecker->CheckCollision(plink2,pbody);
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    return _pCollisionChecker->CheckCollision(plink2,pbody);
+                }
             }
             KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
             if( !!pbody2 ) {
-                return _pCollisionChecker->CheckCollision(pbody,pbody2);
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    return _pCollisionChecker->CheckCollision(pbody,pbody2);
+                }
             }
             CollisionReportPtr preport2 = openravepy::GetCollisionReport(o2);
             if( !!preport2 ) {
-                bool bCollision = _pCollisionChecker->CheckCollision(pbody,preport2);
+                bool bCollision;
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _pCollisionChecker->CheckCollision(pbody,preport2);
+                }
                 openravepy::UpdateCollisionReport(o2,_pyenv);
                 return bCollision;
             }
@@ -255,12 +301,18 @@ public:
         if( !!plink ) {
             KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
             if( !!plink2 ) {
-                bCollision = _pCollisionChecker->CheckCollision(plink,plink2, openravepy::GetCollisionReport(pReport));
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _pCollisionChecker->CheckCollision(plink,plink2, openravepy::GetCollisionReport(pReport));
+                }
             }
             else {
                 KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
                 if( !!pbody2 ) {
-                    bCollision = _pCollisionChecker->CheckCollision(plink,pbody2, openravepy::GetCollisionReport(pReport));
+                    {
+                        openravepy::PythonThreadSaver threadsaver;
+                        bCollision = _pCollisionChecker->CheckCollision(plink,pbody2, openravepy::GetCollisionReport(pReport));
+                    }
                 }
                 else {
                     throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument 2",ORE_InvalidArguments);
@@ -272,12 +324,18 @@ public:
             if( !!pbody ) {
                 KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
                 if( !!plink2 ) {
-                    bCollision = _pCollisionChecker->CheckCollision(plink2,pbody, openravepy::GetCollisionReport(pReport));
+                    {
+                        openravepy::PythonThreadSaver threadsaver;
+                        bCollision = _pCollisionChecker->CheckCollision(plink2,pbody, openravepy::GetCollisionReport(pReport));
+                    }
                 }
                 else {
                     KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
                     if( !!pbody2 ) {
-                        bCollision = _pCollisionChecker->CheckCollision(pbody,pbody2, openravepy::GetCollisionReport(pReport));
+                        {
+                            openravepy::PythonThreadSaver threadsaver;
+                            bCollision = _pCollisionChecker->CheckCollision(pbody,pbody2, openravepy::GetCollisionReport(pReport));
+                        }
                     }
                     else {
                         throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument 2",ORE_InvalidArguments);
@@ -299,11 +357,17 @@ public:
         KinBodyConstPtr pbody2 = openravepy::GetKinBody(pybody2);
         KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
         if( !!plink ) {
-            return _pCollisionChecker->CheckCollision(plink,pbody2);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _pCollisionChecker->CheckCollision(plink,pbody2);
+            }
         }
         KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
         if( !!pbody1 ) {
-            return _pCollisionChecker->CheckCollision(pbody1,pbody2);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _pCollisionChecker->CheckCollision(pbody1,pbody2);
+            }
         }
         throw OPENRAVE_EXCEPTION_FORMAT0("CheckCollision(object) invalid argument",ORE_InvalidArguments);
     }
@@ -316,12 +380,18 @@ public:
         KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
         bool bCollision = false;
         if( !!plink ) {
-            bCollision = _pCollisionChecker->CheckCollision(plink,pbody2,openravepy::GetCollisionReport(pReport));
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _pCollisionChecker->CheckCollision(plink,pbody2,openravepy::GetCollisionReport(pReport));
+            }
         }
         else {
             KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
             if( !!pbody1 ) {
-                bCollision = _pCollisionChecker->CheckCollision(pbody1,pbody2,openravepy::GetCollisionReport(pReport));
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _pCollisionChecker->CheckCollision(pbody1,pbody2,openravepy::GetCollisionReport(pReport));
+                }
             }
             else {
                 throw OPENRAVE_EXCEPTION_FORMAT0("CheckCollision(object) invalid argument",ORE_InvalidArguments);
@@ -362,10 +432,16 @@ public:
             }
         }
         if( !!plink1 ) {
-            return _pCollisionChecker->CheckCollision(plink1,vbodyexcluded,vlinkexcluded);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _pCollisionChecker->CheckCollision(plink1,vbodyexcluded,vlinkexcluded);
+            }
         }
         else if( !!pbody1 ) {
-            return _pCollisionChecker->CheckCollision(pbody1,vbodyexcluded,vlinkexcluded);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _pCollisionChecker->CheckCollision(pbody1,vbodyexcluded,vlinkexcluded);
+            }
         }
         else {
             throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument 1",ORE_InvalidArguments);
@@ -400,10 +476,16 @@ public:
 
         bool bCollision=false;
         if( !!plink1 ) {
-            bCollision = _pCollisionChecker->CheckCollision(plink1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _pCollisionChecker->CheckCollision(plink1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+            }
         }
         else if( !!pbody1 ) {
-            bCollision = _pCollisionChecker->CheckCollision(pbody1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _pCollisionChecker->CheckCollision(pbody1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+            }
         }
         else {
             throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument 1",ORE_InvalidArguments);
@@ -435,7 +517,10 @@ public:
                 RAVELOG_ERROR("failed to get excluded link\n");
             }
         }
-        return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)),vbodyexcluded,vlinkexcluded);
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)),vbodyexcluded,vlinkexcluded);
+        }
     }
 
     bool CheckCollision(PyKinBodyPtr pbody, object bodyexcluded, object linkexcluded, PyCollisionReportPtr pReport)
@@ -461,19 +546,77 @@ public:
             }
         }
 
-        bool bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)), vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _pCollisionChecker->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)), vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,_pyenv);
         return bCollision;
     }
 
     bool CheckCollision(boost::shared_ptr<PyRay> pyray, PyKinBodyPtr pbody)
     {
-        return _pCollisionChecker->CheckCollision(pyray->r,KinBodyConstPtr(openravepy::GetKinBody(pbody)));
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _pCollisionChecker->CheckCollision(pyray->r,KinBodyConstPtr(openravepy::GetKinBody(pbody)));
+        }
     }
 
     bool CheckCollision(boost::shared_ptr<PyRay> pyray, PyKinBodyPtr pbody, PyCollisionReportPtr pReport)
     {
-        bool bCollision = _pCollisionChecker->CheckCollision(pyray->r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _pCollisionChecker->CheckCollision(pyray->r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), openravepy::GetCollisionReport(pReport));
+        }
+        openravepy::UpdateCollisionReport(pReport,_pyenv);
+        return bCollision;
+    }
+
+    object CheckCollisionBatch(PyKinBodyPtr pbody, object odofindices, object oconfigs, int batchoptions=CBO_CheckEnv|CBO_CheckSelf|CBO_StopAtFirstCollision, PyCollisionReportPtr pReport=PyCollisionReportPtr())
+    {
+        KinBodyPtr pkinbody = openravepy::GetKinBody(pbody);
+        if( !pkinbody ) {
+            throw OPENRAVE_EXCEPTION_FORMAT0("CheckCollisionBatch invalid body",ORE_InvalidArguments);
+        }
+        std::vector<int> dofindices = ExtractArray<int>(odofindices);
+        // only converts when the input is not already a contiguous dReal array
+        PyObject* pyconfigs = PyArray_ContiguousFromAny(oconfigs.ptr(), sizeof(dReal)==8 ? PyArray_DOUBLE : PyArray_FLOAT, 1, 2);
+        if( !pyconfigs ) {
+            throw_error_already_set();
+        }
+        handle<> hconfigs(pyconfigs);
+        const dReal* pconfigs = (const dReal*)PyArray_DATA(pyconfigs);
+        std::vector<dReal> vconfigs(pconfigs, pconfigs+PyArray_SIZE(pyconfigs));
+        std::vector<uint8_t> vcollisions;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            _pCollisionChecker->CheckCollisionBatch(pkinbody, dofindices, vconfigs, vcollisions, batchoptions, openravepy::GetCollisionReport(pReport));
+        }
+        openravepy::UpdateCollisionReport(pReport,_pyenv);
+        return toPyArray(vcollisions);
+    }
+
+    object CreateQueryContext(PyKinBodyPtr pbody, int queryoptions=CBO_CheckEnv|CBO_CheckSelf)
+    {
+        return toPyUserData(_pCollisionChecker->CreateQueryContext(KinBodyConstPtr(openravepy::GetKinBody(pbody)), queryoptions));
+    }
+
+    bool CheckCollisionInContext(boost::shared_ptr<PyUserData> pycontext, object olinktransforms, PyCollisionReportPtr pReport=PyCollisionReportPtr())
+    {
+        if( !pycontext || !pycontext->_handle ) {
+            throw OPENRAVE_EXCEPTION_FORMAT0("CheckCollisionInContext invalid context",ORE_InvalidArguments);
+        }
+        std::vector<Transform> vlinktransforms(len(olinktransforms));
+        for(size_t i = 0; i < vlinktransforms.size(); ++i) {
+            vlinktransforms[i] = ExtractTransform(olinktransforms[i]);
+        }
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _pCollisionChecker->CheckCollisionInContext(pycontext->_handle, vlinktransforms, openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,_pyenv);
         return bCollision;
     }
@@ -488,41 +631,43 @@ public:
         if( extract<int>(shape[1]) != 6 ) {
             throw openrave_exception("rays object needs to be a Nx6 vector\n");
         }
-        CollisionReport report;
-        CollisionReportPtr preport(&report,null_deleter());
+        std::vector<RAY> vrays(num);
+        for(int i = 0; i < num; ++i) {
+            vector<dReal> ray = ExtractArray<dReal>(rays[i]);
+            vrays[i].pos.x = ray[0];
+            vrays[i].pos.y = ray[1];
+            vrays[i].pos.z = ray[2];
+            vrays[i].dir.x = ray[3];
+            vrays[i].dir.y = ray[4];
+            vrays[i].dir.z = ray[5];
+        }
+        std::vector<dReal> vhitdistances;
+        std::vector<Vector> vhitnormals;
+        std::vector<KinBody::LinkConstPtr> vhitlinks;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            _pCollisionChecker->CheckCollisionRays(vrays, KinBodyConstPtr(openravepy::GetKinBody(pbody)), vhitdistances, vhitnormals, vhitlinks);
+        }
 
-        RAY r;
         npy_intp dims[] = { num,6};
         PyObject *pypos = PyArray_SimpleNew(2,dims, sizeof(dReal)==8 ? PyArray_DOUBLE : PyArray_FLOAT);
         dReal* ppos = (dReal*)PyArray_DATA(pypos);
         PyObject* pycollision = PyArray_SimpleNew(1,&dims[0], PyArray_BOOL);
         bool* pcollision = (bool*)PyArray_DATA(pycollision);
         for(int i = 0; i < num; ++i, ppos += 6) {
-            vector<dReal> ray = ExtractArray<dReal>(rays[i]);
-            r.pos.x = ray[0];
-            r.pos.y = ray[1];
-            r.pos.z = ray[2];
-            r.dir.x = ray[3];
-            r.dir.y = ray[4];
-            r.dir.z = ray[5];
-            bool bCollision;
-            if( !pbody ) {
-                bCollision = _pCollisionChecker->CheckCollision(r, preport);
-            }
-            else {
-                bCollision = _pCollisionChecker->CheckCollision(r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), preport);
-            }
+            const RAY& r = vrays[i];
             pcollision[i] = false;
             ppos[0] = 0; ppos[1] = 0; ppos[2] = 0; ppos[3] = 0; ppos[4] = 0; ppos[5] = 0;
-            if( bCollision &&( report.contacts.size() > 0) ) {
-                if( !bFrontFacingOnly ||( report.contacts[0].norm.dot3(r.dir)<0) ) {
+            if( vhitdistances[i] >= 0 ) {
+                if( !bFrontFacingOnly ||( vhitnormals[i].dot3(r.dir)<0) ) {
+                    Vector vhit = r.pos + r.dir*(vhitdistances[i]/RaveSqrt(r.dir.lengthsqr3()));
                     pcollision[i] = true;
-                    ppos[0] = report.contacts[0].pos.x;
-                    ppos[1] = report.contacts[0].pos.y;
-                    ppos[2] = report.contacts[0].pos.z;
-                    ppos[3] = report.contacts[0].norm.x;
-                    ppos[4] = report.contacts[0].norm.y;
-                    ppos[5] = report.contacts[0].norm.z;
+                    ppos[0] = vhit.x;
+                    ppos[1] = vhit.y;
+                    ppos[2] = vhit.z;
+                    ppos[3] = vhitnormals[i].x;
+                    ppos[4] = vhitnormals[i].y;
+                    ppos[5] = vhitnormals[i].z;
                 }
             }
         }
@@ -532,12 +677,19 @@ public:
 
     bool CheckCollision(boost::shared_ptr<PyRay> pyray)
     {
-        return _pCollisionChecker->CheckCollision(pyray->r);
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _pCollisionChecker->CheckCollision(pyray->r);
+        }
     }
 
     bool CheckCollision(boost::shared_ptr<PyRay> pyray, PyCollisionReportPtr pReport)
     {
-        bool bCollision = _pCollisionChecker->CheckCollision(pyray->r, openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _pCollisionChecker->CheckCollision(pyray->r, openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,_pyenv);
         return bCollision;
     }
@@ -602,6 +754,9 @@ PyCollisionCheckerBasePtr RaveCreateCollisionChecker(PyEnvironmentBasePtr pyenv,
 }
 
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(CheckCollisionRays_overloads, CheckCollisionRays, 2, 3)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(CheckCollisionBatch_overloads, CheckCollisionBatch, 3, 5)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(CreateQueryContext_overloads, CreateQueryContext, 1, 2)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(CheckCollisionInContext_overloads, CheckCollisionInContext, 2, 3)
 
 void init_openravepy_collisionchecker()
 {
@@ -611,6 +766,10 @@ void init_openravepy_collisionchecker()
     .value("Contacts",CO_Contacts)
     .value("RayAnyHit",CO_RayAnyHit)
     .value("ActiveDOFs",CO_ActiveDOFs);
+    enum_<CollisionBatchOptions>("CollisionBatchOptions" DOXY_ENUM(CollisionBatchOptions))
+    .value("CheckEnv",CBO_CheckEnv)
+    .value("CheckSelf",CBO_CheckSelf)
+    .value("StopAtFirstCollision",CBO_StopAtFirstCollision);
     enum_<CollisionAction>("CollisionAction" DOXY_ENUM(CollisionAction))
     .value("DefaultAction",CA_DefaultAction)
     .value("Ignore",CA_Ignore)
@@ -679,9 +838,12 @@ void init_openravepy_collisionchecker()
     .def("CheckCollision",pcolybr,args("ray","body","report"), DOXY_FN(CollisionCheckerBase,CheckCollision "const RAY; KinBodyConstPtr; CollisionReportPtr"))
     .def("CheckCollision",pcoly,args("ray"), DOXY_FN(CollisionCheckerBase,CheckCollision "const RAY; CollisionReportPtr"))
     .def("CheckCollision",pcolyr,args("ray"), DOXY_FN(CollisionCheckerBase,CheckCollision "const RAY; CollisionReportPtr"))
+    .def("CheckCollisionBatch",&PyCollisionCheckerBase::CheckCollisionBatch,CheckCollisionBatch_overloads(args("body","dofindices","configs","batchoptions","report"), DOXY_FN(CollisionCheckerBase,CheckCollisionBatch)))
+    .def("CreateQueryContext",&PyCollisionCheckerBase::CreateQueryContext,CreateQueryContext_overloads(args("body","queryoptions"), DOXY_FN(CollisionCheckerBase,CreateQueryContext)))
+    .def("CheckCollisionInContext",&PyCollisionCheckerBase::CheckCollisionInContext,CheckCollisionInContext_overloads(args("context","linktransforms","report"), DOXY_FN(CollisionCheckerBase,CheckCollisionInContext)))
     .def("CheckCollisionRays",&PyCollisionCheckerBase::CheckCollisionRays,
          CheckCollisionRays_overloads(args("rays","body","front_facing_only"),
-                                      "Check if any rays hit the body and returns their contact points along with a vector specifying if a collision occured or not. Rays is a Nx6 array, first 3 columsn are position, last 3 are direction+range."))
+                                      "Check if any rays hit the body and returns their contact points along with a vector specifying if a collision occured or not. Rays is a Nx6 array, first 3 columsn are position, last 3 are direction+range. All rays are cast in one call to CollisionCheckerBase::CheckCollisionRays."))
     ;
 
     def("RaveCreateCollisionChecker",openravepy::RaveCreateCollisionChecker,args("env","name"),DOXY_FN1(RaveCreateCollisionChecker));
@@ -1012,7 +1012,9 @@ public:
                 throw OPENRAVE_EXCEPTION_FORMAT0("ManipulatorIKGoalSampler parameterizations need to be all IkParameterization objeccts",ORE_InvalidArguments);
             }
         }
-        _sampler.reset(new OpenRAVE::planningutils::ManipulatorIKGoalSampler(GetRobotManipulator(pymanip), listparameterizations, nummaxsamples, nummaxtries));
+        RobotBase::ManipulatorPtr pmanip = GetRobotManipulator(pymanip);
+        _penv = pmanip->GetRobot()->GetEnv();
+        _sampler.reset(new OpenRAVE::planningutils::ManipulatorIKGoalSampler(pmanip, listparameterizations, nummaxsamples, nummaxtries));
         _sampler->SetJitter(jitter);
     }
     virtual ~PyManipulatorIKGoalSampler() {
@@ -1020,17 +1022,30 @@ public:
 
     object Sample(bool ikreturn = false, bool releasegil = false)
     {
+        IkReturnPtr pikreturn;
+        std::vector<dReal> vgoal;
+        bool bsuccess = false;
+        {
+            openravepy::PythonThreadSaverPtr statesaver;
+            if( releasegil ) {
+                statesaver.reset(new openravepy::PythonThreadSaver());
+            }
+            // lock after the GIL is released so that the locking order matches Environment.Lock
+            EnvironmentMutex::scoped_lock lock(_penv->GetMutex());
+            if( ikreturn ) {
+                pikreturn = _sampler->Sample();
+            }
+            else {
+                bsuccess = _sampler->Sample(vgoal);
+            }
+        }
         if( ikreturn ) {
-            IkReturnPtr pikreturn = _sampler->Sample();
             if( !!pikreturn ) {
                 return openravepy::toPyIkReturn(*pikreturn);
             }
         }
-        else {
-            std::vector<dReal> vgoal;
-            if( _sampler->Sample(vgoal) ) {
-                return toPyArray(vgoal);
-            }
+        else if( bsuccess ) {
+            return toPyArray(vgoal);
         }
         return object();
     }
@@ -1044,6 +1059,7 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            EnvironmentMutex::scoped_lock lock(_penv->GetMutex());
             _sampler->SampleAll(listreturns, maxsamples, maxchecksamples);
         }
         FOREACH(it,listreturns) {
@@ -1053,6 +1069,7 @@ public:
     }
 
     OpenRAVE::planningutils::ManipulatorIKGoalSamplerPtr _sampler;
+    EnvironmentBasePtr _penv;
 };
 
 typedef boost::shared_ptr<PyManipulatorIKGoalSampler> PyManipulatorIKGoalSamplerPtr;
@@ -73,14 +73,27 @@ class PyIkSolverBase : public PyInterfaceBase
 protected:
     IkSolverBasePtr _pIkSolver;
 
-    static IkReturn _CallCustomFilter(object fncallback, PyEnvironmentBasePtr pyenv, IkSolverBasePtr pIkSolver, std::vector<dReal>& values, RobotBase::ManipulatorConstPtr pmanip, const IkParameterization& ikparam)
+    /// \brief called from the ik solver, possibly while the GIL is released, so python objects are only touched while holding the GIL
+    static IkReturn _CallCustomFilter(const object& fncallback, PyEnvironmentBasePtr pyenv, IkSolverBasePtr pIkSolver, std::vector<dReal>& values, RobotBase::ManipulatorConstPtr pmanip, const IkParameterization& ikparam)
     {
-        object res;
         PyGILState_STATE gstate = PyGILState_Ensure();
         std::string errmsg;
+        IkReturn ikfr(IKRA_Success);
         try {
             RobotBase::ManipulatorPtr pmanip2 = boost::const_pointer_cast<RobotBase::Manipulator>(pmanip);
-            res = fncallback(toPyArray(values), openravepy::toPyRobotManipulator(pmanip2,pyenv),toPyIkParameterization(ikparam));
+            object res = fncallback(toPyArray(values), openravepy::toPyRobotManipulator(pmanip2,pyenv),toPyIkParameterization(ikparam));
+            if( res == object() ) {
+                ikfr._action = IKRA_Reject;
+            }
+            else if( !openravepy::ExtractIkReturn(res,ikfr) ) {
+                extract<IkReturnAction> ikfra(res);
+                if( ikfra.check() ) {
+                    ikfr._action = (IkReturnAction)ikfra;
+                }
+                else {
+                    errmsg = "failed to convert return type of filter to IkReturn";
+                }
+            }
         }
         catch(...) {
             errmsg = boost::str(boost::format("exception occured in python custom filter callback of iksolver %s: %s")%pIkSolver->GetXMLId()%GetPyErrorString());
@@ -89,19 +102,7 @@ protected:
         if( errmsg.size() > 0 ) {
             throw openrave_exception(errmsg,ORE_Assert);
         }
-        if( res == object() ) {
-            return IKRA_Reject;
-        }
-        IkReturn ikfr(IKRA_Success);
-        if( openravepy::ExtractIkReturn(res,ikfr) ) {
-            return ikfr;
-        }
-        extract<IkReturnAction> ikfra(res);
-        if( ikfra.check() ) {
-            ikfr._action = (IkReturnAction)ikfra;
-            return ikfr;
-        }
-        throw openrave_exception("failed to convert return type of filter to IkReturn",ORE_Assert);
+        return ikfr;
     }
 
 public:
@@ -157,6 +158,27 @@ public:
         return pyreturns;
     }
 
+    object SolveBatch(object oparams, object oq0, int filteroptions, int numthreads=0)
+    {
+        std::vector<IkParameterization> vparams(len(oparams));
+        for(size_t i = 0; i < vparams.size(); ++i) {
+            if( !ExtractIkParameterization(oparams[i],vparams[i]) ) {
+                throw openrave_exception("first argument to IkSolver.SolveBatch needs to be a list of IkParameterization",ORE_InvalidArguments);
+            }
+        }
+        vector<dReal> q0;
+        if( !(oq0 == object()) ) {
+            q0 = ExtractArray<dReal>(oq0);
+        }
+        std::vector<IkReturnPtr> vikreturns;
+        _pIkSolver->SolveBatch(vparams, q0, filteroptions, vikreturns, numthreads);
+        boost::python::list pyreturns;
+        FOREACH(itikreturn,vikreturns) {
+            pyreturns.append(object(PyIkReturnPtr(new PyIkReturn(*itikreturn))));
+        }
+        return pyreturns;
+    }
+
     PyIkReturnPtr Solve(object oparam, object oq0, object oFreeParameters, int filteroptions)
     {
         PyIkReturnPtr pyreturn(new PyIkReturn(IKRA_Reject));
@@ -242,6 +264,8 @@ PyIkSolverBasePtr RaveCreateIkSolver(PyEnvironmentBasePtr pyenv, const std::stri
     return PyIkSolverBasePtr(new PyIkSolverBase(p,pyenv));
 }
 
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SolveBatch_overloads, SolveBatch, 3, 4)
+
 void init_openravepy_iksolver()
 {
     enum_<IkFilterOptions>("IkFilterOptions" DOXY_ENUM(IkFilterOptions))
@@ -289,6 +313,7 @@ void init_openravepy_iksolver()
         .def("Solve",SolveFree,args("ikparam","q0","freeparameters", "filteroptions"), DOXY_FN(IkSolverBase, Solve "const IkParameterization&; const std::vector; const std::vector; int; IkReturnPtr"))
         .def("SolveAll",SolveAll,args("ikparam","filteroptions"), DOXY_FN(IkSolverBase, SolveAll "const IkParameterization&; int; std::vector<IkReturnPtr>"))
         .def("SolveAll",SolveAllFree,args("ikparam","freeparameters","filteroptions"), DOXY_FN(IkSolverBase, SolveAll "const IkParameterization&; const std::vector; int; std::vector<IkReturnPtr>"))
+        .def("SolveBatch",&PyIkSolverBase::SolveBatch,SolveBatch_overloads(args("ikparams","q0","filteroptions","numthreads"), DOXY_FN(IkSolverBase,SolveBatch)))
         .def("GetNumFreeParameters",&PyIkSolverBase::GetNumFreeParameters, DOXY_FN(IkSolverBase,GetNumFreeParameters))
         .def("GetFreeParameters",&PyIkSolverBase::GetFreeParameters, DOXY_FN(IkSolverBase,GetFreeParameters))
         .def("Supports",&PyIkSolverBase::Supports, args("iktype"), DOXY_FN(IkSolverBase,Supports))
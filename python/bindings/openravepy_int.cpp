@@ -186,27 +186,28 @@ protected:
         _pviewer.reset();
     }
 
-    CollisionAction _CollisionCallback(object fncallback, CollisionReportPtr preport, bool bFromPhysics)
+    CollisionAction _CollisionCallback(const object& fncallback, CollisionReportPtr preport, bool bFromPhysics)
     {
-        object res;
+        CollisionAction action = CA_DefaultAction;
         PyGILState_STATE gstate = PyGILState_Ensure();
         try {
-            res = fncallback(openravepy::toPyCollisionReport(preport,shared_from_this()),bFromPhysics);
+            object res = fncallback(openravepy::toPyCollisionReport(preport,shared_from_this()),bFromPhysics);
+            if( res != object() && !!res ) {
+                extract<int> xi(res);
+                if( xi.check() ) {
+                    action = (CollisionAction)(int) xi;
+                }
+                else {
+                    RAVELOG_WARN("collision callback nothing returning, so executing default action\n");
+                }
+            }
         }
         catch(...) {
             RAVELOG_ERROR("exception occured in python collision callback:\n");
             PyErr_Print();
         }
         PyGILState_Release(gstate);
-        if(( res == object()) || !res ) {
-            return CA_DefaultAction;
-        }
-        extract<int> xi(res);
-        if( xi.check() ) {
-            return (CollisionAction)(int) xi;
-        }
-        RAVELOG_WARN("collision callback nothing returning, so executing default action\n");
-        return CA_DefaultAction;
+        return action;
     }
 
 public:
@@ -285,12 +286,19 @@ public:
     bool CheckCollision(PyKinBodyPtr pbody1)
     {
         CHECK_POINTER(pbody1);
-        return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)));
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)));
+        }
     }
     bool CheckCollision(PyKinBodyPtr pbody1, PyCollisionReportPtr pReport)
     {
         CHECK_POINTER(pbody1);
-        bool bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,shared_from_this());
         return bCollision;
     }
@@ -299,14 +307,21 @@ public:
     {
         CHECK_POINTER(pbody1);
         CHECK_POINTER(pbody2);
-        return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)));
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)));
+        }
     }
 
     bool CheckCollision(PyKinBodyPtr pbody1, PyKinBodyPtr pbody2, PyCollisionReportPtr pReport)
     {
         CHECK_POINTER(pbody1);
         CHECK_POINTER(pbody2);
-        bool bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)), openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody1)), KinBodyConstPtr(openravepy::GetKinBody(pbody2)), openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,shared_from_this());
         return bCollision;
     }
@@ -316,11 +331,17 @@ public:
         CHECK_POINTER(o1);
         KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
         if( !!plink ) {
-            return _penv->CheckCollision(plink);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _penv->CheckCollision(plink);
+            }
         }
         KinBodyConstPtr pbody = openravepy::GetKinBody(o1);
         if( !!pbody ) {
-            return _penv->CheckCollision(pbody);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _penv->CheckCollision(pbody);
+            }
         }
         throw OPENRAVE_EXCEPTION_FORMAT0("CheckCollision(object) invalid argument",ORE_InvalidArguments);
     }
@@ -331,12 +352,18 @@ public:
         KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
         bool bCollision;
         if( !!plink ) {
-            bCollision = _penv->CheckCollision(plink,openravepy::GetCollisionReport(pReport));
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _penv->CheckCollision(plink,openravepy::GetCollisionReport(pReport));
+            }
         }
         else {
             KinBodyConstPtr pbody = openravepy::GetKinBody(o1);
             if( !!pbody ) {
-                bCollision = _penv->CheckCollision(pbody,openravepy::GetCollisionReport(pReport));
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _penv->CheckCollision(pbody,openravepy::GetCollisionReport(pReport));
+                }
             }
             else {
                 throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument",ORE_InvalidArguments);
@@ -354,15 +381,25 @@ public:
         if( !!plink ) {
             KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
             if( !!plink2 ) {
-                return _penv->CheckCollision(plink,plink2);
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    return _penv->CheckCollision(plink,plink2);
+                }
             }
             KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
             if( !!pbody2 ) {
-                return _penv->CheckCollision(plink,pbody2);
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    return _penv->CheckCollision(plink,pbody2);
+                }
             }
             CollisionReportPtr preport2 = openravepy::GetCollisionReport(o2);
             if( !!preport2 ) {
-                bool bCollision = _penv->CheckCollision(plink,preport2);
+                bool bCollision;
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _penv->CheckCollision(plink,preport2);
+                }
                 openravepy::UpdateCollisionReport(o2,shared_from_this());
                 return bCollision;
             }
@@ -372,15 +409,25 @@ public:
         if( !!pbody ) {
             KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
             if( !!plink2 ) {
-                return _penv->CheckCollision(plink2,pbody);
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    return _penv->CheckCollision(plink2,pbody);
+                }
             }
             KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
             if( !!pbody2 ) {
-                return _penv->CheckCollision(pbody,pbody2);
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    return _penv->CheckCollision(pbody,pbody2);
+                }
             }
             CollisionReportPtr preport2 = openravepy::GetCollisionReport(o2);
             if( !!preport2 ) {
-                bool bCollision = _penv->CheckCollision(pbody,preport2);
+                bool bCollision;
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _penv->CheckCollision(pbody,preport2);
+                }
                 openravepy::UpdateCollisionReport(o2,shared_from_this());
                 return bCollision;
             }
@@ -397,12 +444,18 @@ public:
         if( !!plink ) {
             KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
             if( !!plink2 ) {
-                bCollision = _penv->CheckCollision(plink,plink2, openravepy::GetCollisionReport(pReport));
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _penv->CheckCollision(plink,plink2, openravepy::GetCollisionReport(pReport));
+                }
             }
             else {
                 KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
                 if( !!pbody2 ) {
-                    bCollision = _penv->CheckCollision(plink,pbody2, openravepy::GetCollisionReport(pReport));
+                    {
+                        openravepy::PythonThreadSaver threadsaver;
+                        bCollision = _penv->CheckCollision(plink,pbody2, openravepy::GetCollisionReport(pReport));
+                    }
                 }
                 else {
                     throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument 2",ORE_InvalidArguments);
@@ -414,12 +467,18 @@ public:
             if( !!pbody ) {
                 KinBody::LinkConstPtr plink2 = openravepy::GetKinBodyLinkConst(o2);
                 if( !!plink2 ) {
-                    bCollision = _penv->CheckCollision(plink2,pbody, openravepy::GetCollisionReport(pReport));
+                    {
+                        openravepy::PythonThreadSaver threadsaver;
+                        bCollision = _penv->CheckCollision(plink2,pbody, openravepy::GetCollisionReport(pReport));
+                    }
                 }
                 else {
                     KinBodyConstPtr pbody2 = openravepy::GetKinBody(o2);
                     if( !!pbody2 ) {
-                        bCollision = _penv->CheckCollision(pbody,pbody2, openravepy::GetCollisionReport(pReport));
+                        {
+                            openravepy::PythonThreadSaver threadsaver;
+                            bCollision = _penv->CheckCollision(pbody,pbody2, openravepy::GetCollisionReport(pReport));
+                        }
                     }
                     else {
                         throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument 2",ORE_InvalidArguments);
@@ -441,11 +500,17 @@ public:
         KinBodyConstPtr pbody2 = openravepy::GetKinBody(pybody2);
         KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
         if( !!plink ) {
-            return _penv->CheckCollision(plink,pbody2);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _penv->CheckCollision(plink,pbody2);
+            }
         }
         KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
         if( !!pbody1 ) {
-            return _penv->CheckCollision(pbody1,pbody2);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _penv->CheckCollision(pbody1,pbody2);
+            }
         }
         throw OPENRAVE_EXCEPTION_FORMAT0("CheckCollision(object) invalid argument",ORE_InvalidArguments);
     }
@@ -458,12 +523,18 @@ public:
         KinBody::LinkConstPtr plink = openravepy::GetKinBodyLinkConst(o1);
         bool bCollision = false;
         if( !!plink ) {
-            bCollision = _penv->CheckCollision(plink,pbody2,openravepy::GetCollisionReport(pReport));
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _penv->CheckCollision(plink,pbody2,openravepy::GetCollisionReport(pReport));
+            }
         }
         else {
             KinBodyConstPtr pbody1 = openravepy::GetKinBody(o1);
             if( !!pbody1 ) {
-                bCollision = _penv->CheckCollision(pbody1,pbody2,openravepy::GetCollisionReport(pReport));
+                {
+                    openravepy::PythonThreadSaver threadsaver;
+                    bCollision = _penv->CheckCollision(pbody1,pbody2,openravepy::GetCollisionReport(pReport));
+                }
             }
             else {
                 throw OPENRAVE_EXCEPTION_FORMAT0("CheckCollision(object) invalid argument",ORE_InvalidArguments);
@@ -504,10 +575,16 @@ public:
             }
         }
         if( !!plink1 ) {
-            return _penv->CheckCollision(plink1,vbodyexcluded,vlinkexcluded);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _penv->CheckCollision(plink1,vbodyexcluded,vlinkexcluded);
+            }
         }
         else if( !!pbody1 ) {
-            return _penv->CheckCollision(pbody1,vbodyexcluded,vlinkexcluded);
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                return _penv->CheckCollision(pbody1,vbodyexcluded,vlinkexcluded);
+            }
         }
         else {
             throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument 1",ORE_InvalidArguments);
@@ -542,10 +619,16 @@ public:
 
         bool bCollision=false;
         if( !!plink1 ) {
-            bCollision = _penv->CheckCollision(plink1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _penv->CheckCollision(plink1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+            }
         }
         else if( !!pbody1 ) {
-            bCollision = _penv->CheckCollision(pbody1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+            {
+                openravepy::PythonThreadSaver threadsaver;
+                bCollision = _penv->CheckCollision(pbody1, vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+            }
         }
         else {
             throw OPENRAVE_EXCEPTION_FORMAT0("invalid argument 1",ORE_InvalidArguments);
@@ -577,7 +660,10 @@ public:
                 RAVELOG_ERROR("failed to get excluded link\n");
             }
         }
-        return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)),vbodyexcluded,vlinkexcluded);
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)),vbodyexcluded,vlinkexcluded);
+        }
     }
 
     bool CheckCollision(PyKinBodyPtr pbody, object bodyexcluded, object linkexcluded, PyCollisionReportPtr pReport)
@@ -603,19 +689,30 @@ public:
             }
         }
 
-        bool bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)), vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _penv->CheckCollision(KinBodyConstPtr(openravepy::GetKinBody(pbody)), vbodyexcluded, vlinkexcluded, openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,shared_from_this());
         return bCollision;
     }
 
     bool CheckCollision(boost::shared_ptr<PyRay> pyray, PyKinBodyPtr pbody)
     {
-        return _penv->CheckCollision(pyray->r,KinBodyConstPtr(openravepy::GetKinBody(pbody)));
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _penv->CheckCollision(pyray->r,KinBodyConstPtr(openravepy::GetKinBody(pbody)));
+        }
     }
 
     bool CheckCollision(boost::shared_ptr<PyRay> pyray, PyKinBodyPtr pbody, PyCollisionReportPtr pReport)
     {
-        bool bCollision = _penv->CheckCollision(pyray->r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _penv->CheckCollision(pyray->r, KinBodyConstPtr(openravepy::GetKinBody(pbody)), openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,shared_from_this());
         return bCollision;
     }
@@ -674,12 +771,19 @@ public:
 
     bool CheckCollision(boost::shared_ptr<PyRay> pyray)
     {
-        return _penv->CheckCollision(pyray->r);
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            return _penv->CheckCollision(pyray->r);
+        }
     }
 
     bool CheckCollision(boost::shared_ptr<PyRay> pyray, PyCollisionReportPtr pReport)
     {
-        bool bCollision = _penv->CheckCollision(pyray->r, openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _penv->CheckCollision(pyray->r, openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,shared_from_this());
         return bCollision;
     }
@@ -882,6 +986,23 @@ public:
     uint64_t GetSimulationTime() {
         return _penv->GetSimulationTime();
     }
+    void SetSensorSimulationThreads(int numthreads) {
+        _penv->SetSensorSimulationThreads(numthreads);
+    }
+    int GetSensorSimulationThreads() {
+        return _penv->GetSensorSimulationThreads();
+    }
+    /// returns a list of (sensor, numsteps, totaltime, maxtime, lasttime) tuples
+    object GetSensorSimulationStats(bool reset=false)
+    {
+        std::vector<EnvironmentBase::SensorSimulationStats> vstats;
+        _penv->GetSensorSimulationStats(vstats,reset);
+        boost::python::list ostats;
+        FOREACH(itstats,vstats) {
+            ostats.append(boost::python::make_tuple(openravepy::toPySensor(itstats->psensor,shared_from_this()),itstats->numsteps,itstats->totaltime,itstats->maxtime,itstats->lasttime));
+        }
+        return ostats;
+    }
 
     void Lock()
     {
@@ -1330,6 +1451,7 @@ PyInterfaceBasePtr RaveCreateInterface(PyEnvironmentBasePtr pyenv, InterfaceType
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(LoadURI_overloads, LoadURI, 1, 2)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SetCamera_overloads, SetCamera, 2, 4)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(StartSimulation_overloads, StartSimulation, 1, 2)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetSensorSimulationStats_overloads, GetSensorSimulationStats, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SetViewer_overloads, SetViewer, 1, 2)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(CheckCollisionRays_overloads, CheckCollisionRays, 2, 3)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(plot3_overloads, plot3, 2, 4)
@@ -1560,6 +1682,9 @@ The **releasegil** parameter controls whether the python Global Interpreter Lock
                     .def("StartSimulation",&PyEnvironmentBase::StartSimulation,StartSimulation_overloads(args("timestep","realtime"), DOXY_FN(EnvironmentBase,StartSimulation)))
                     .def("StopSimulation",&PyEnvironmentBase::StopSimulation, DOXY_FN(EnvironmentBase,StopSimulation))
                     .def("GetSimulationTime",&PyEnvironmentBase::GetSimulationTime, DOXY_FN(EnvironmentBase,GetSimulationTime))
+                    .def("SetSensorSimulationThreads",&PyEnvironmentBase::SetSensorSimulationThreads,args("numthreads"), DOXY_FN(EnvironmentBase,SetSensorSimulationThreads))
+                    .def("GetSensorSimulationThreads",&PyEnvironmentBase::GetSensorSimulationThreads, DOXY_FN(EnvironmentBase,GetSensorSimulationThreads))
+                    .def("GetSensorSimulationStats",&PyEnvironmentBase::GetSensorSimulationStats,GetSensorSimulationStats_overloads(args("reset"), DOXY_FN(EnvironmentBase,GetSensorSimulationStats)))
                     .def("Lock",Lock1,"Locks the environment mutex.")
                     //.def("Lock",Lock2,args("timeout"), "Locks the environment mutex with a timeout.")
                     .def("Unlock",&PyEnvironmentBase::Unlock,"Unlocks the environment mutex.")
@@ -1385,6 +1385,47 @@ public:
         return otransforms;
     }
 
+    object ComputeLinkTransformationsBatch(object oconfigs, int numthreads=0)
+    {
+        int dof = _pbody->GetDOF();
+        size_t numlinks = _pbody->GetLinks().size();
+        // only converts when the input is not already a contiguous dReal array
+        PyObject* pyconfigs = PyArray_ContiguousFromAny(oconfigs.ptr(), sizeof(dReal)==8 ? PyArray_DOUBLE : PyArray_FLOAT, 1, 2);
+        if( !pyconfigs ) {
+            throw_error_already_set();
+        }
+        handle<> hconfigs(pyconfigs);
+        size_t numvalues = PyArray_SIZE(pyconfigs);
+        if( dof == 0 || numvalues % dof ) {
+            throw openrave_exception(boost::str(boost::format("configurations size %d is not a multiple of the dof %d")%numvalues%dof),ORE_InvalidArguments);
+        }
+        size_t numconfigs = numvalues/dof;
+        npy_intp dims[] = { numconfigs, numlinks, 7};
+        PyObject *pyposes = PyArray_SimpleNew(3,dims, sizeof(dReal)==8 ? PyArray_DOUBLE : PyArray_FLOAT);
+        if( !pyposes ) {
+            throw_error_already_set();
+        }
+        handle<> hposes(pyposes);
+        // the poses are written directly into the new array
+        const dReal* pconfigs = (const dReal*)PyArray_DATA(pyconfigs);
+        dReal* pfposes = (dReal*)PyArray_DATA(pyposes);
+        {
+            PythonThreadSaver saver;
+            _pbody->ComputeLinkTransformationsBatch(pconfigs, numconfigs, pfposes, 7*numlinks, numthreads);
+        }
+        return static_cast<numeric::array>(hposes);
+    }
+
+    void SetFastKinematics(bool bEnable)
+    {
+        _pbody->SetFastKinematics(bEnable);
+    }
+
+    bool IsFastKinematics() const
+    {
+        return _pbody->IsFastKinematics();
+    }
+
     void SetLinkTransformations(object transforms, object odofbranches=object())
     {
         size_t numtransforms = len(transforms);
@@ -1751,11 +1792,16 @@ public:
     }
 
     bool CheckSelfCollision() {
+        openravepy::PythonThreadSaver threadsaver;
         return _pbody->CheckSelfCollision();
     }
     bool CheckSelfCollision(PyCollisionReportPtr pReport)
     {
-        bool bCollision = _pbody->CheckSelfCollision(openravepy::GetCollisionReport(pReport));
+        bool bCollision;
+        {
+            openravepy::PythonThreadSaver threadsaver;
+            bCollision = _pbody->CheckSelfCollision(openravepy::GetCollisionReport(pReport));
+        }
         openravepy::UpdateCollisionReport(pReport,GetEnv());
         return bCollision;
     }
@@ -2061,6 +2107,8 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            // lock after the GIL is released, otherwise a thread holding the environment lock and waiting on the GIL deadlocks with this one. lock is destroyed before statesaver
+            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             return _pmanip->FindIKSolution(ikparam,solution,filteroptions);
 
         }
@@ -2070,6 +2118,7 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             return _pmanip->FindIKSolution(ikparam,vFreeParameters, solution,filteroptions);
         }
         bool _FindIKSolution(const IkParameterization& ikparam, int filteroptions, IkReturn& ikreturn, bool releasegil) const
@@ -2078,6 +2127,7 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             return _pmanip->FindIKSolution(ikparam,filteroptions,IkReturnPtr(&ikreturn,utils::null_deleter()));
         }
         bool _FindIKSolution(const IkParameterization& ikparam, const std::vector<dReal>& vFreeParameters, int filteroptions, IkReturn& ikreturn, bool releasegil) const
@@ -2086,6 +2136,7 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             return _pmanip->FindIKSolution(ikparam,vFreeParameters, filteroptions,IkReturnPtr(&ikreturn,utils::null_deleter()));
         }
 
@@ -2095,6 +2146,7 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             return _pmanip->FindIKSolutions(ikparam,solutions,filteroptions);
         }
         bool _FindIKSolutions(const IkParameterization& ikparam, const std::vector<dReal>& vFreeParameters, std::vector<std::vector<dReal> >& solutions, int filteroptions, bool releasegil) const
@@ -2103,6 +2155,7 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             return _pmanip->FindIKSolutions(ikparam,vFreeParameters,solutions,filteroptions);
         }
         bool _FindIKSolutions(const IkParameterization& ikparam, int filteroptions, std::vector<IkReturnPtr>& vikreturns, bool releasegil) const
@@ -2111,6 +2164,7 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             return _pmanip->FindIKSolutions(ikparam,filteroptions,vikreturns);
         }
         bool _FindIKSolutions(const IkParameterization& ikparam, const std::vector<dReal>& vFreeParameters, int filteroptions, std::vector<IkReturnPtr>& vikreturns, bool releasegil) const
@@ -2119,13 +2173,13 @@ public:
             if( releasegil ) {
                 statesaver.reset(new openravepy::PythonThreadSaver());
             }
+            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             return _pmanip->FindIKSolutions(ikparam,vFreeParameters,filteroptions,vikreturns);
         }
 
         object FindIKSolution(object oparam, int filteroptions, bool ikreturn=false, bool releasegil=false) const
         {
             IkParameterization ikparam;
-            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             if( ExtractIkParameterization(oparam,ikparam) ) {
                 if( ikreturn ) {
                     IkReturn ikreturn(IKRA_Reject);
@@ -2161,7 +2215,6 @@ public:
         {
             vector<dReal> vfreeparams = ExtractArray<dReal>(freeparams);
             IkParameterization ikparam;
-            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             if( ExtractIkParameterization(oparam,ikparam) ) {
                 if( ikreturn ) {
                     IkReturn ikreturn(IKRA_Reject);
@@ -2196,7 +2249,6 @@ public:
         object FindIKSolutions(object oparam, int filteroptions, bool ikreturn=false, bool releasegil=false) const
         {
             IkParameterization ikparam;
-            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             if( ikreturn ) {
                 std::vector<IkReturnPtr> vikreturns;
                 if( ExtractIkParameterization(oparam,ikparam) ) {
@@ -2243,7 +2295,6 @@ public:
         {
             vector<dReal> vfreeparams = ExtractArray<dReal>(freeparams);
             IkParameterization ikparam;
-            EnvironmentMutex::scoped_lock lock(openravepy::GetEnvironment(_pyenv)->GetMutex()); // lock just in case since many users call this without locking...
             if( ikreturn ) {
                 std::vector<IkReturnPtr> vikreturns;
                 if( ExtractIkParameterization(oparam,ikparam) ) {
@@ -3269,6 +3320,7 @@ BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetMaxVel_overloads, GetMaxVel, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetMaxAccel_overloads, GetMaxAccel, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetMaxTorque_overloads, GetMaxTorque, 0, 1)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetLinkTransformations_overloads, GetLinkTransformations, 0, 1)
+BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(ComputeLinkTransformationsBatch_overloads, ComputeLinkTransformationsBatch, 1, 2)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(SetLinkTransformations_overloads, SetLinkTransformations, 1, 2)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(GetIkParameterization_overloads, GetIkParameterization, 1, 2)
 BOOST_PYTHON_MEMBER_FUNCTION_OVERLOADS(FindIKSolution_overloads, FindIKSolution, 2, 4)
@@ -3403,6 +3455,9 @@ void init_openravepy_kinbody()
                         .def("GetTransform",&PyKinBody::GetTransform, DOXY_FN(KinBody,GetTransform))
                         .def("GetLinkTransformations",&PyKinBody::GetLinkTransformations, GetLinkTransformations_overloads(args("returndofbranches"), DOXY_FN(KinBody,GetLinkTransformations)))
                         .def("GetBodyTransformations",&PyKinBody::GetLinkTransformations, DOXY_FN(KinBody,GetLinkTransformations))
+                        .def("ComputeLinkTransformationsBatch",&PyKinBody::ComputeLinkTransformationsBatch, ComputeLinkTransformationsBatch_overloads(args("configs","numthreads"), DOXY_FN(KinBody,ComputeLinkTransformationsBatch)))
+                        .def("SetFastKinematics",&PyKinBody::SetFastKinematics,args("enable"), DOXY_FN(KinBody,SetFastKinematics))
+                        .def("IsFastKinematics",&PyKinBody::IsFastKinematics, DOXY_FN(KinBody,IsFastKinematics))
                         .def("SetLinkTransformations",&PyKinBody::SetLinkTransformations,SetLinkTransformations_overloads(args("transforms","dofbranches"), DOXY_FN(KinBody,SetLinkTransformations)))
                         .def("SetBodyTransformations",&PyKinBody::SetLinkTransformations,args("transforms"), DOXY_FN(KinBody,SetLinkTransformations))
                         .def("SetLinkVelocities",&PyKinBody::SetLinkVelocities,args("velocities"), DOXY_FN(KinBody,SetLinkVelocities))
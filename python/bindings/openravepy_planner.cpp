@@ -92,6 +92,11 @@ public:
             _paramswrite->vinitialconfig = ExtractArray<dReal>(o);
         }
 
+        void SetContinuousCheck(bool bContinuousCheck)
+        {
+            _paramswrite->_bContinuousCheck = bContinuousCheck;
+        }
+
         string __repr__() {
             stringstream ss;
             ss << std::setprecision(std::numeric_limits<dReal>::digits10+1);         /// have to do this or otherwise precision gets lost
@@ -154,28 +159,29 @@ public:
         return PyPlannerParametersPtr(new PyPlannerParameters(params));
     }
 
-    static PlannerAction _PlanCallback(object fncallback, PyEnvironmentBasePtr pyenv, const PlannerBase::PlannerProgress& progress)
+    static PlannerAction _PlanCallback(const object& fncallback, PyEnvironmentBasePtr pyenv, const PlannerBase::PlannerProgress& progress)
     {
-        object res;
+        PlannerAction action = PA_None;
         PyGILState_STATE gstate = PyGILState_Ensure();
         try {
             boost::shared_ptr<PyPlannerProgress> pyprogress(new PyPlannerProgress(progress));
-            res = fncallback(object(pyprogress));
+            object res = fncallback(object(pyprogress));
+            if( res != object() && !!res ) {
+                extract<PlannerAction> xb(res);
+                if( xb.check() ) {
+                    action = (PlannerAction)xb;
+                }
+                else {
+                    RAVELOG_WARN("plan callback nothing returning, so executing default action\n");
+                }
+            }
         }
         catch(...) {
             RAVELOG_ERROR("exception occured in _PlanCallback:\n");
             PyErr_Print();
         }
         PyGILState_Release(gstate);
-        if(( res == object()) || !res ) {
-            return PA_None;
-        }
-        extract<PlannerAction> xb(res);
-        if( xb.check() ) {
-            return (PlannerAction)xb;
-        }
-        RAVELOG_WARN("plan callback nothing returning, so executing default action\n");
-        return PA_None;
+        return action;
     }
 
     object RegisterPlanCallback(object fncallback)
@@ -263,6 +269,7 @@ void init_openravepy_planner()
         .def("SetExtraParameters",&PyPlannerBase::PyPlannerParameters::SetExtraParameters, args("extra"), DOXY_FN(PlannerBase::PlannerParameters, SetExtraParameters))
         .def("SetGoalConfig",&PyPlannerBase::PyPlannerParameters::SetGoalConfig,args("values"),"sets PlannerParameters::vgoalconfig")
         .def("SetInitialConfig",&PyPlannerBase::PyPlannerParameters::SetInitialConfig,args("values"),"sets PlannerParameters::vinitialconfig")
+        .def("SetContinuousCheck",&PyPlannerBase::PyPlannerParameters::SetContinuousCheck,args("continuouscheck"),"sets PlannerParameters::_bContinuousCheck")
         .def("__str__",&PyPlannerBase::PyPlannerParameters::__str__)
         .def("__unicode__",&PyPlannerBase::PyPlannerParameters::__unicode__)
         .def("__repr__",&PyPlannerBase::PyPlannerParameters::__repr__)
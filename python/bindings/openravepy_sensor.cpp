@@ -91,13 +91,16 @@ public:
             if( (int)pdata->vimagedata.size() != pgeom->height*pgeom->width*3 ) {
                 throw openrave_exception("bad image data");
             }
+            // pdata is refilled by every GetSensorData call, so hand its buffers to numpy instead of copying them
             {
-                npy_intp dims[] = { pgeom->height,pgeom->width,3};
-                PyObject *pyvalues = PyArray_SimpleNew(3,dims, PyArray_UINT8);
-                if( pdata->vimagedata.size() > 0 ) {
-                    memcpy(PyArray_DATA(pyvalues),&pdata->vimagedata[0],pdata->vimagedata.size());
-                }
-                imagedata = static_cast<numeric::array>(handle<>(pyvalues));
+                std::vector<npy_intp> dims(3);
+                dims[0] = pgeom->height; dims[1] = pgeom->width; dims[2] = 3;
+                imagedata = toPyArraySwap(pdata->vimagedata, dims);
+            }
+            if( (int)pdata->vdepthdata.size() == pgeom->height*pgeom->width ) {
+                std::vector<npy_intp> dims(2);
+                dims[0] = pgeom->height; dims[1] = pgeom->width;
+                depthdata = toPyArraySwap(pdata->vdepthdata, dims);
             }
             KK = intrinsics.K;
         }
@@ -117,7 +120,7 @@ public:
         }
         virtual ~PyCameraSensorData() {
         }
-        object imagedata, KK;
+        object imagedata, depthdata, KK;
         PyCameraIntrinsics intrinsics;
     };
 
@@ -439,6 +442,7 @@ void init_openravepy_sensor()
         class_<PySensorBase::PyCameraSensorData, boost::shared_ptr<PySensorBase::PyCameraSensorData>, bases<PySensorBase::PySensorData> >("CameraSensorData", DOXY_CLASS(SensorBase::CameraSensorData),no_init)
         .def_readonly("transform",&PySensorBase::PyCameraSensorData::transform)
         .def_readonly("imagedata",&PySensorBase::PyCameraSensorData::imagedata)
+        .def_readonly("depthdata",&PySensorBase::PyCameraSensorData::depthdata)
         .def_readonly("KK",&PySensorBase::PyCameraSensorData::KK)
         ;
         class_<PySensorBase::PyJointEncoderSensorData, boost::shared_ptr<PySensorBase::PyJointEncoderSensorData>, bases<PySensorBase::PySensorData> >("JointEncoderSensorData", DOXY_CLASS(SensorBase::JointEncoderSensorData),no_init)
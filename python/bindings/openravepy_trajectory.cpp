@@ -76,6 +76,34 @@ public:
         return toPyArray(values);
     }
 
+    object SamplePoints(object otimes) const
+    {
+        vector<dReal> values;
+        _ptrajectory->SamplePoints(values,ExtractArray<dReal>(otimes));
+        return toPyArraySwap(values);
+    }
+
+    object SamplePoints(object otimes, PyConfigurationSpecificationPtr pyspec) const
+    {
+        vector<dReal> values;
+        _ptrajectory->SamplePoints(values,ExtractArray<dReal>(otimes),openravepy::GetConfigurationSpecification(pyspec));
+        return toPyArraySwap(values);
+    }
+
+    object SampleRange(dReal starttime, dReal stoptime, dReal deltatime) const
+    {
+        vector<dReal> values;
+        _ptrajectory->SampleRange(values,starttime,stoptime,deltatime);
+        return toPyArraySwap(values);
+    }
+
+    object SampleRange(dReal starttime, dReal stoptime, dReal deltatime, PyConfigurationSpecificationPtr pyspec) const
+    {
+        vector<dReal> values;
+        _ptrajectory->SampleRange(values,starttime,stoptime,deltatime,openravepy::GetConfigurationSpecification(pyspec));
+        return toPyArraySwap(values);
+    }
+
     object GetConfigurationSpecification() const {
         return object(openravepy::toPyConfigurationSpecification(_ptrajectory->GetConfigurationSpecification()));
     }
@@ -88,14 +116,14 @@ public:
     {
         vector<dReal> values;
         _ptrajectory->GetWaypoints(startindex,endindex,values);
-        return toPyArray(values);
+        return toPyArraySwap(values);
     }
 
     object GetWaypoints(size_t startindex, size_t endindex, PyConfigurationSpecificationPtr pyspec) const
     {
         vector<dReal> values;
         _ptrajectory->GetWaypoints(startindex,endindex,values,openravepy::GetConfigurationSpecification(pyspec));
-        return toPyArray(values);
+        return toPyArraySwap(values);
     }
 
     object GetWaypoint(int index) const
@@ -191,10 +219,18 @@ void init_openravepy_trajectory()
     void (PyTrajectoryBase::*Insert4)(size_t,object,PyConfigurationSpecificationPtr,bool) = &PyTrajectoryBase::Insert;
     object (PyTrajectoryBase::*Sample1)(dReal) const = &PyTrajectoryBase::Sample;
     object (PyTrajectoryBase::*Sample2)(dReal, PyConfigurationSpecificationPtr) const = &PyTrajectoryBase::Sample;
+    object (PyTrajectoryBase::*SamplePoints1)(object) const = &PyTrajectoryBase::SamplePoints;
+    object (PyTrajectoryBase::*SamplePoints2)(object, PyConfigurationSpecificationPtr) const = &PyTrajectoryBase::SamplePoints;
+    object (PyTrajectoryBase::*SampleRange1)(dReal,dReal,dReal) const = &PyTrajectoryBase::SampleRange;
+    object (PyTrajectoryBase::*SampleRange2)(dReal,dReal,dReal,PyConfigurationSpecificationPtr) const = &PyTrajectoryBase::SampleRange;
     object (PyTrajectoryBase::*GetWaypoints1)(size_t,size_t) const = &PyTrajectoryBase::GetWaypoints;
     object (PyTrajectoryBase::*GetWaypoints2)(size_t,size_t,PyConfigurationSpecificationPtr) const = &PyTrajectoryBase::GetWaypoints;
     object (PyTrajectoryBase::*GetWaypoint1)(int) const = &PyTrajectoryBase::GetWaypoint;
     object (PyTrajectoryBase::*GetWaypoint2)(int,PyConfigurationSpecificationPtr) const = &PyTrajectoryBase::GetWaypoint;
+    enum_<TrajectorySerializationOptions>("TrajectorySerializationOptions" DOXY_ENUM(TrajectorySerializationOptions))
+    .value("Binary",TSO_Binary)
+    .value("Compressed",TSO_Compressed)
+    ;
     class_<PyTrajectoryBase, boost::shared_ptr<PyTrajectoryBase>, bases<PyInterfaceBase> >("Trajectory", DOXY_CLASS(TrajectoryBase), no_init)
     .def("Init",&PyTrajectoryBase::Init,args("spec"),DOXY_FN(TrajectoryBase,Init))
     .def("Insert",Insert1,args("index","data"),DOXY_FN(TrajectoryBase,Insert "size_t; const std::vector; bool"))
@@ -204,6 +240,10 @@ void init_openravepy_trajectory()
     .def("Remove",&PyTrajectoryBase::Remove,args("startindex","endindex"),DOXY_FN(TrajectoryBase,Remove))
     .def("Sample",Sample1,args("time"),DOXY_FN(TrajectoryBase,Sample "std::vector; dReal"))
     .def("Sample",Sample2,args("time","spec"),DOXY_FN(TrajectoryBase,Sample "std::vector; dReal; const ConfigurationSpecification"))
+    .def("SamplePoints",SamplePoints1,args("times"),DOXY_FN(TrajectoryBase,SamplePoints "std::vector; const std::vector"))
+    .def("SamplePoints",SamplePoints2,args("times","spec"),DOXY_FN(TrajectoryBase,SamplePoints "std::vector; const std::vector; const ConfigurationSpecification"))
+    .def("SampleRange",SampleRange1,args("starttime","stoptime","deltatime"),DOXY_FN(TrajectoryBase,SampleRange "std::vector; dReal; dReal; dReal"))
+    .def("SampleRange",SampleRange2,args("starttime","stoptime","deltatime","spec"),DOXY_FN(TrajectoryBase,SampleRange "std::vector; dReal; dReal; dReal; const ConfigurationSpecification"))
     .def("GetConfigurationSpecification",&PyTrajectoryBase::GetConfigurationSpecification,DOXY_FN(TrajectoryBase,GetConfigurationSpecification))
     .def("GetNumWaypoints",&PyTrajectoryBase::GetNumWaypoints,DOXY_FN(TrajectoryBase,GetNumWaypoints))
     .def("GetWaypoints",GetWaypoints1,args("startindex","endindex"),DOXY_FN(TrajectoryBase, GetWaypoints "size_t; size_t; std::vector"))
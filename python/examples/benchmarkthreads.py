@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+# Copyright (C) 2012 Rosen Diankov (rosen.diankov@gmail.com)
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""Measures how collision checking and inverse kinematics scale with the number of python threads.
+
+.. examplepre-block:: benchmarkthreads
+
+Description
+-----------
+
+Every thread works on its own clone of the environment. :meth:`.Environment.CheckCollision` always
+releases the python GIL and :meth:`.Manipulator.FindIKSolution` is called with releasegil=True, so the
+calls can run in parallel. For each thread count the same number of random configurations is split among the threads
+and the speedup over a single thread is printed.
+
+.. examplepost-block:: benchmarkthreads
+"""
+from __future__ import with_statement # for python 2.5
+__author__ = 'Rosen Diankov'
+
+import openravepy
+if not __openravepy_build_doc__:
+    from openravepy import *
+    from numpy import *
+
+try:
+    from multiprocessing import cpu_count
+except:
+    def cpu_count(): return 1
+
+import time, threading
+
+def worker(env,robotname,configs,iktype,results,index):
+    with env:
+        robot = env.GetRobot(robotname)
+        manip = robot.GetActiveManipulator()
+        robot.SetActiveDOFs(manip.GetArmIndices())
+        numcollisions = 0
+        numiksolutions = 0
+        for config in configs:
+            robot.SetActiveDOFValues(config)
+            if env.CheckCollision(robot) or robot.CheckSelfCollision():
+                numcollisions += 1
+            elif iktype is not None:
+                ikparam = manip.GetIkParameterization(iktype)
+                if manip.FindIKSolution(ikparam,IkFilterOptions.CheckEnvCollisions,ikreturn=False,releasegil=True) is not None:
+                    numiksolutions += 1
+        results[index] = (numcollisions,numiksolutions)
+
+def main(env,options):
+    "Main example code."
+    env.Load(options.scene)
+    robot = env.GetRobots()[0]
+    if options.manipname is not None:
+        robot.SetActiveManipulator(options.manipname)
+    manip = robot.GetActiveManipulator()
+    iktype = None
+    if not options.noik:
+        ikmodel = databases.inversekinematics.InverseKinematicsModel(robot=robot,iktype=IkParameterization.Type.Transform6D)
+        if not ikmodel.load():
+            ikmodel.autogenerate()
+        iktype = IkParameterization.Type.Transform6D
+    with env:
+        lower,upper = robot.GetDOFLimits(manip.GetArmIndices())
+    configs = lower+random.rand(options.num,len(lower))*(upper-lower)
+
+    maxthreads = options.maxthreads if options.maxthreads is not None else cpu_count()
+    envs = [env.CloneSelf(CloningOptions.Bodies) for i in range(maxthreads)]
+    basetime = None
+    numthreads = 1
+    while numthreads <= maxthreads:
+        results = [None]*numthreads
+        threads = [threading.Thread(target=worker,args=(envs[i],robot.GetName(),configs[i::numthreads],iktype,results,i)) for i in range(numthreads)]
+        starttime = time.time()
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        elapsedtime = time.time()-starttime
+        if basetime is None:
+            basetime = elapsedtime
+        print '%d threads: %fs for %d configurations (%d in collision, %d ik solutions), speedup %.2f'%(numthreads,elapsedtime,len(configs),sum(r[0] for r in results),sum(r[1] for r in results),basetime/elapsedtime)
+        numthreads *= 2
+    for clonedenv in envs:
+        clonedenv.Destroy()
+
+from optparse import OptionParser
+from openravepy.misc import OpenRAVEGlobalArguments
+
+@openravepy.with_destroy
+def run(args=None):
+    """Command-line execution of the example.
+
+    :param args: arguments for script to parse, if not specified will use sys.argv
+    """
+    parser = OptionParser(description='Measures how collision checking and inverse kinematics scale with the number of python threads.')
+    OpenRAVEGlobalArguments.addOptions(parser)
+    parser.add_option('--scene', action="store",type='string',dest='scene',default='data/lab1.env.xml',
+                      help='Scene file to load (default=%default)')
+    parser.add_option('--manipname', action="store",type='string',dest='manipname',default=None,
+                      help='Choose the manipulator to perform the benchmark on')
+    parser.add_option('--num', action="store",type='int',dest='num',default=200,
+                      help='Number of random configurations to test (default=%default)')
+    parser.add_option('--maxthreads', action="store",type='int',dest='maxthreads',default=None,
+                      help='Maximum number of threads, doubled starting from 1 (default is the number of cpus)')
+    parser.add_option('--noik', action="store_true",dest='noik',default=False,
+                      help='Only check collisions, do not call the inverse kinematics')
+    (options, leftargs) = parser.parse_args(args=args)
+    OpenRAVEGlobalArguments.parseAndCreateThreadedUser(options,main,defaultviewer=False)
+
+if __name__=='__main__':
+    run()
@@ -0,0 +1,127 @@
+/** \example orconcurrentcollision.cpp
+    \author Rosen Diankov
+
+    Shows how to query collisions of the same environment from many threads at once without cloning it,
+    and measures how the query throughput scales with the number of threads.
+
+    Every thread creates its own context with \ref OpenRAVE::CollisionCheckerBase::CreateQueryContext and checks the robot
+    at precomputed link transforms with \ref OpenRAVE::CollisionCheckerBase::CheckCollisionInContext. The environment
+    is not locked during the queries.
+
+    Usage:
+    \verbatim
+    orconcurrentcollision [scene] [numconfigurations] [maxthreads]
+    \endverbatim
+
+    <b>Full Example Code:</b>
+ */
+#include <openrave-core.h>
+#include <openrave/utils.h>
+#include <vector>
+#include <sstream>
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+
+#include "orexample.h"
+
+using namespace OpenRAVE;
+using namespace std;
+
+namespace cppexamples {
+
+class ConcurrentCollisionExample : public OpenRAVEExample
+{
+public:
+    ConcurrentCollisionExample() : OpenRAVEExample("") {
+    }
+
+    void _QueryThread(CollisionCheckerBasePtr pchecker, RobotBasePtr probot, const std::vector< std::vector<Transform> >& vlinktransforms, size_t istart, size_t istep, std::vector<uint8_t>* pvcollisions)
+    {
+        UserDataPtr context;
+        {
+            EnvironmentMutex::scoped_lock lock(penv->GetMutex());
+            context = pchecker->CreateQueryContext(probot);
+        }
+        // every thread writes to different configurations
+        for(size_t i = istart; i < vlinktransforms.size(); i += istep) {
+            pvcollisions->at(i) = pchecker->CheckCollisionInContext(context,vlinktransforms[i]);
+        }
+    }
+
+    virtual void demothread(int argc, char ** argv) {
+        string scenefilename = argc > 1 ? argv[1] : "data/lab1.env.xml";
+        int numconfigurations = argc > 2 ? atoi(argv[2]) : 2000;
+        int maxthreads = argc > 3 ? atoi(argv[3]) : max(1,(int)boost::thread::hardware_concurrency());
+
+        CollisionCheckerBasePtr pchecker = RaveCreateCollisionChecker(penv,"pqp");
+        if( !pchecker ) {
+            RAVELOG_ERROR("failed to create pqp checker\n");
+            return;
+        }
+        penv->SetCollisionChecker(pchecker);
+        penv->Load(scenefilename);
+
+        vector<RobotBasePtr> vrobots;
+        penv->GetRobots(vrobots);
+        RobotBasePtr probot = vrobots.at(0);
+        probot->ReleaseAllGrabbed();
+
+        // sample random configurations serially, the queries only need the link transforms
+        vector< vector<Transform> > vlinktransforms(numconfigurations);
+        vector<uint8_t> vserialcollisions(numconfigurations);
+        {
+            EnvironmentMutex::scoped_lock lock(penv->GetMutex());
+            KinBody::KinBodyStateSaver saver(probot);
+            vector<dReal> vlower, vupper, vvalues(probot->GetDOF());
+            probot->GetDOFLimits(vlower,vupper);
+            for(int i = 0; i < numconfigurations; ++i) {
+                for(size_t j = 0; j < vvalues.size(); ++j) {
+                    vvalues[j] = vlower[j] + RaveRandomFloat()*(vupper[j]-vlower[j]);
+                }
+                probot->SetDOFValues(vvalues);
+                probot->GetLinkTransformations(vlinktransforms[i]);
+                vserialcollisions[i] = penv->CheckCollision(KinBodyConstPtr(probot)) || probot->CheckSelfCollision();
+            }
+        }
+        int numserialcollisions = 0;
+        for(int i = 0; i < numconfigurations; ++i) {
+            numserialcollisions += vserialcollisions[i];
+        }
+
+        uint64_t basetime = 0;
+        for(int numthreads = 1; numthreads <= maxthreads; numthreads *= 2) {
+            vector<uint8_t> vcollisions(numconfigurations,0);
+            vector<boost::shared_ptr<boost::thread> > vthreads(numthreads);
+            uint64_t starttime = utils::GetMicroTime();
+            for(int i = 0; i < numthreads; ++i) {
+                vthreads[i].reset(new boost::thread(boost::bind(&ConcurrentCollisionExample::_QueryThread,this,pchecker,probot,boost::cref(vlinktransforms),i,numthreads,&vcollisions)));
+            }
+            for(int i = 0; i < numthreads; ++i) {
+                vthreads[i]->join();
+            }
+            uint64_t elapsedtime = utils::GetMicroTime()-starttime;
+            if( numthreads == 1 ) {
+                basetime = elapsedtime;
+            }
+            int numcollisions = 0, nummismatches = 0;
+            for(int i = 0; i < numconfigurations; ++i) {
+                numcollisions += vcollisions[i];
+                if( vcollisions[i] != vserialcollisions[i] ) {
+                    ++nummismatches;
+                }
+            }
+            RAVELOG_INFO(str(boost::format("threads=%d, queries/s=%f, speedup=%f, collisions=%d/%d (serial %d)\n")%numthreads%(numconfigurations*1e6/max(elapsedtime,(uint64_t)1))%(basetime/(double)max(elapsedtime,(uint64_t)1))%numcollisions%numconfigurations%numserialcollisions));
+            if( nummismatches > 0 ) {
+                RAVELOG_ERROR(str(boost::format("threads=%d, %d/%d configurations disagree with the serial checks\n")%numthreads%nummismatches%numconfigurations));
+            }
+        }
+    }
+};
+
+} // end namespace cppexamples
+
+int main(int argc, char ** argv)
+{
+    cppexamples::ConcurrentCollisionExample example;
+    return example.main(argc,argv);
+}
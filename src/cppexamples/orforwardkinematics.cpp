@@ -0,0 +1,107 @@
+/** \example orforwardkinematics.cpp
+    \author Rosen Diankov
+
+    Measures how many forward kinematics calls per second \ref OpenRAVE::KinBody::SetDOFValues can do for a set of robots.
+
+    Random configurations inside the joint limits are generated first, then each robot is set to every configuration
+    with and without checking the joint limits. The time to compute the manipulator end effector transform is also
+    reported since it is the most common use of the forward kinematics.
+
+    Usage:
+    \verbatim
+    orforwardkinematics [numiterations] [robot1] [robot2] ...
+    \endverbatim
+
+    <b>Full Example Code:</b>
+ */
+#include <openrave-core.h>
+#include <openrave/utils.h>
+#include <vector>
+#include <sstream>
+
+#include "orexample.h"
+
+using namespace OpenRAVE;
+using namespace std;
+
+namespace cppexamples {
+
+class ForwardKinematicsExample : public OpenRAVEExample
+{
+public:
+    ForwardKinematicsExample() : OpenRAVEExample("") {
+    }
+
+    void _Benchmark(RobotBasePtr probot, int numiterations)
+    {
+        int dof = probot->GetDOF();
+        if( dof == 0 ) {
+            RAVELOG_INFO(str(boost::format("%s has no degrees of freedom\n")%probot->GetName()));
+            return;
+        }
+        vector<dReal> vlower, vupper, vvalues(dof), vconfigs(numiterations*dof);
+        probot->GetDOFLimits(vlower,vupper);
+        for(int i = 0; i < numiterations; ++i) {
+            for(int j = 0; j < dof; ++j) {
+                vconfigs[i*dof+j] = vlower[j] + (vupper[j]-vlower[j])*RaveRandomFloat();
+            }
+        }
+
+        const char* names[] = { "no limits", "check limits"};
+        for(int icheck = 0; icheck < 2; ++icheck) {
+            uint64_t starttime = utils::GetMicroTime();
+            for(int i = 0; i < numiterations; ++i) {
+                std::copy(vconfigs.begin()+i*dof,vconfigs.begin()+(i+1)*dof,vvalues.begin());
+                probot->SetDOFValues(vvalues,icheck ? KinBody::CLA_CheckLimits : KinBody::CLA_Nothing);
+            }
+            uint64_t elapsed = max(utils::GetMicroTime()-starttime,(uint64_t)1);
+            RAVELOG_INFO(str(boost::format("%s (%d dof, %d links), %s: %f calls/s\n")%probot->GetName()%dof%probot->GetLinks().size()%names[icheck]%(numiterations*1e6/elapsed)));
+        }
+
+        RobotBase::ManipulatorPtr pmanip = probot->GetActiveManipulator();
+        if( !!pmanip ) {
+            uint64_t starttime = utils::GetMicroTime();
+            for(int i = 0; i < numiterations; ++i) {
+                std::copy(vconfigs.begin()+i*dof,vconfigs.begin()+(i+1)*dof,vvalues.begin());
+                probot->SetDOFValues(vvalues,KinBody::CLA_Nothing);
+                pmanip->GetTransform();
+            }
+            uint64_t elapsed = max(utils::GetMicroTime()-starttime,(uint64_t)1);
+            RAVELOG_INFO(str(boost::format("%s, end effector %s: %f calls/s\n")%probot->GetName()%pmanip->GetName()%(numiterations*1e6/elapsed)));
+        }
+    }
+
+    virtual void demothread(int argc, char ** argv) {
+        int numiterations = argc > 1 ? atoi(argv[1]) : 100000;
+        vector<string> vrobotfiles;
+        for(int i = 2; i < argc; ++i) {
+            vrobotfiles.push_back(argv[i]);
+        }
+        if( vrobotfiles.size() == 0 ) {
+            vrobotfiles.push_back("robots/barrettwam.robot.xml");
+            vrobotfiles.push_back("robots/puma.robot.xml");
+            vrobotfiles.push_back("robots/pa10schunk.robot.xml");
+            vrobotfiles.push_back("robots/pr2-beta-static.zae");
+        }
+
+        EnvironmentMutex::scoped_lock lock(penv->GetMutex());
+        for(size_t i = 0; i < vrobotfiles.size(); ++i) {
+            RobotBasePtr probot = penv->ReadRobotURI(vrobotfiles[i]);
+            if( !probot ) {
+                RAVELOG_WARN(str(boost::format("failed to load %s\n")%vrobotfiles[i]));
+                continue;
+            }
+            penv->Add(probot,true);
+            _Benchmark(probot,numiterations);
+            penv->Remove(probot);
+        }
+    }
+};
+
+} // end namespace cppexamples
+
+int main(int argc, char ** argv)
+{
+    cppexamples::ForwardKinematicsExample example;
+    return example.main(argc,argv);
+}
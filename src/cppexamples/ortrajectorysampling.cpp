@@ -0,0 +1,97 @@
+/** \example ortrajectorysampling.cpp
+    \author Rosen Diankov
+
+    Compares sampling a dense trajectory one time at a time with \ref OpenRAVE::TrajectoryBase::Sample against sampling
+    all the times at once with \ref OpenRAVE::TrajectoryBase::SampleRange.
+
+    Random waypoints of the robot are retimed with linear and parabolic interpolation, and both trajectories are
+    sampled at a fixed time step. The example checks that the two methods return the same points.
+
+    Usage:
+    \verbatim
+    ortrajectorysampling [scene] [numwaypoints] [timestep]
+    \endverbatim
+
+    <b>Full Example Code:</b>
+ */
+#include <openrave-core.h>
+#include <openrave/utils.h>
+#include <openrave/planningutils.h>
+#include <vector>
+#include <sstream>
+
+#include "orexample.h"
+
+using namespace OpenRAVE;
+using namespace std;
+
+namespace cppexamples {
+
+class TrajectorySamplingExample : public OpenRAVEExample
+{
+public:
+    TrajectorySamplingExample() : OpenRAVEExample("") {
+    }
+
+    void _Benchmark(TrajectoryBasePtr traj, dReal timestep, const std::string& name)
+    {
+        const ConfigurationSpecification& spec = traj->GetConfigurationSpecification();
+        vector<dReal> vsingledata, vpoint, vrangedata;
+        uint64_t starttime = utils::GetMicroTime();
+        for(dReal ftime = 0; ftime <= traj->GetDuration(); ftime += timestep) {
+            traj->Sample(vpoint,ftime);
+            vsingledata.insert(vsingledata.end(),vpoint.begin(),vpoint.end());
+        }
+        uint64_t singletime = utils::GetMicroTime()-starttime;
+
+        starttime = utils::GetMicroTime();
+        traj->SampleRange(vrangedata,0,traj->GetDuration(),timestep);
+        uint64_t rangetime = utils::GetMicroTime()-starttime;
+
+        size_t numsamples = min(vsingledata.size(),vrangedata.size())/spec.GetDOF();
+        dReal fmaxerror = 0;
+        for(size_t i = 0; i < numsamples*spec.GetDOF(); ++i) {
+            fmaxerror = max(fmaxerror,RaveFabs(vsingledata[i]-vrangedata[i]));
+        }
+        RAVELOG_INFO(str(boost::format("%s: %d samples, Sample=%fs, SampleRange=%fs, speedup=%f, max error=%e\n")%name%numsamples%(singletime*1e-6)%(rangetime*1e-6)%(singletime/(double)max(rangetime,(uint64_t)1))%fmaxerror));
+    }
+
+    virtual void demothread(int argc, char ** argv) {
+        string scenefilename = argc > 1 ? argv[1] : "data/lab1.env.xml";
+        int numwaypoints = argc > 2 ? atoi(argv[2]) : 1000;
+        dReal timestep = argc > 3 ? atof(argv[3]) : 0.001;
+        penv->Load(scenefilename);
+        vector<RobotBasePtr> vrobots;
+        penv->GetRobots(vrobots);
+        RobotBasePtr probot = vrobots.at(0);
+
+        EnvironmentMutex::scoped_lock lock(penv->GetMutex());
+        // random walk inside the joint limits
+        vector<dReal> vlower, vupper, vvalues, vwaypoints;
+        probot->GetActiveDOFLimits(vlower,vupper);
+        probot->GetActiveDOFValues(vvalues);
+        for(int i = 0; i < numwaypoints; ++i) {
+            for(size_t j = 0; j < vvalues.size(); ++j) {
+                vvalues[j] = max(vlower[j],min(vupper[j],vvalues[j]+0.2f*(RaveRandomFloat()-0.5f)));
+            }
+            vwaypoints.insert(vwaypoints.end(),vvalues.begin(),vvalues.end());
+        }
+
+        const char* retimers[] = { "LinearTrajectoryRetimer", "ParabolicTrajectoryRetimer"};
+        for(int iretimer = 0; iretimer < 2; ++iretimer) {
+            TrajectoryBasePtr traj = RaveCreateTrajectory(penv,"");
+            traj->Init(probot->GetActiveConfigurationSpecification());
+            traj->Insert(0,vwaypoints);
+            planningutils::RetimeActiveDOFTrajectory(traj,probot,false,1,1,retimers[iretimer]);
+            _Benchmark(traj,timestep,retimers[iretimer]);
+        }
+    }
+};
+
+} // end namespace cppexamples
+
+int main(int argc, char ** argv)
+{
+    cppexamples::TrajectorySamplingExample example;
+    return example.main(argc,argv);
+}
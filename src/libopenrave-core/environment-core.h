@@ -86,6 +86,19 @@ protected:
     friend class CollisionCallbackData;
     typedef boost::shared_ptr<CollisionCallbackData> CollisionCallbackDataPtr;
 
+    /// \brief immutable index of the bodies in the environment, replaced as a whole whenever a body is added, removed, or renamed
+    class BodyRegistry
+    {
+public:
+        BodyRegistry() : stamp(0) {
+        }
+        int stamp;     ///< value of _nBodyRegistryStamp when the registry was built
+        boost::shared_ptr<std::vector<KinBodyPtr> > pvecbodies;     ///< copy of _vecbodies, returned by GetBodiesSnapshot
+        boost::unordered_map<std::string, KinBodyPtr> mapbodies;     ///< name -> body, the first body wins if names collide
+        boost::unordered_map<std::string, RobotBasePtr> maprobots;     ///< name -> robot
+    };
+    typedef boost::shared_ptr<BodyRegistry const> BodyRegistryConstPtr;
+
 public:
     Environment() : EnvironmentBase()
     {
@@ -93,6 +106,7 @@ public:
         RAVELOG_DEBUG(str(boost::format("setting openrave home directory to %s")%_homedirectory));
 
         _nBodiesModifiedStamp = 0;
+        _nBodyRegistryStamp = 0;
         _nEnvironmentIndex = 1;
 
         _fDeltaSimTime = 0.01f;
@@ -101,6 +115,11 @@ public:
         _bRealTime = true;
         _bInit = false;
         _bEnableSimulation = true;     // need to start by default
+        _nSensorThreads = 1;
+        _nNextSensorStep = 0;
+        _nSensorStepsDone = 0;
+        _fSensorTimeStep = 0;
+        _bShutdownSensorThreads = false;
 
         _handlegenericrobot = RaveRegisterInterface(PT_Robot,"GenericRobot", RaveGetInterfaceHash(PT_Robot), GetHash(), CreateGenericRobot);
         _handlegenerictrajectory = RaveRegisterInterface(PT_Trajectory,"GenericTrajectory", RaveGetInterfaceHash(PT_Trajectory), GetHash(), CreateGenericTrajectory);
@@ -195,6 +214,7 @@ public:
             _threadSimulation->join();     // might not return?
         }
         _threadSimulation.reset();
+        _StopSensorThreads();
 
         // destroy the modules (their destructors could attempt to lock environment, so have to do it before global lock)
         // however, do not clear the _listModules yet
@@ -247,6 +267,8 @@ public:
                 _vecrobots.clear();
                 _vPublishedBodies.clear();
                 _nBodiesModifiedStamp++;
+                _mapBodyNameCallbacks.clear();
+                _InvalidateBodyRegistry();
                 FOREACH(itsensor,_listSensors) {
                     (*itsensor)->Configure(SensorBase::CC_PowerOff);
                     (*itsensor)->Configure(SensorBase::CC_RenderGeometryOff);
@@ -298,6 +320,8 @@ public:
             _vecrobots.clear();
             _vPublishedBodies.clear();
             _nBodiesModifiedStamp++;
+            _mapBodyNameCallbacks.clear();
+            _InvalidateBodyRegistry();
 
             _mapBodies.clear();
 
@@ -542,6 +566,7 @@ public:
             _vecbodies.push_back(pbody);
             SetEnvironmentId(pbody);
             _nBodiesModifiedStamp++;
+            _InvalidateBodyRegistry();
         }
         pbody->_ComputeInternalInformation();
         _pCurrentChecker->InitKinBody(pbody);
@@ -575,6 +600,7 @@ public:
             _vecrobots.push_back(robot);
             SetEnvironmentId(robot);
             _nBodiesModifiedStamp++;
+            _InvalidateBodyRegistry();
         }
         robot->_ComputeInternalInformation();
         _pCurrentChecker->InitKinBody(robot);
@@ -639,9 +665,11 @@ public:
             if( !!_pPhysicsEngine ) {
                 _pPhysicsEngine->RemoveKinBody(*it);
             }
+            _mapBodyNameCallbacks.erase(pbody->GetEnvironmentId());
             RemoveEnvironmentId(pbody);
             _vecbodies.erase(it);
             _nBodiesModifiedStamp++;
+            _InvalidateBodyRegistry();
             return true;
         }
         case PT_Sensor: {
@@ -683,11 +711,10 @@ public:
 
     virtual KinBodyPtr GetKinBody(const std::string& pname) const
     {
-        boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
-        FOREACHC(it, _vecbodies) {
-            if((*it)->GetName()==pname) {
-                return *it;
-            }
+        BodyRegistryConstPtr pregistry = _GetBodyRegistry();
+        boost::unordered_map<std::string, KinBodyPtr>::const_iterator it = pregistry->mapbodies.find(pname);
+        if( it != pregistry->mapbodies.end() ) {
+            return it->second;
         }
         //RAVELOG_VERBOSE(str(boost::format("Environment::GetKinBody - Error: Unknown body %s\n")%pname));
         return KinBodyPtr();
@@ -695,11 +722,10 @@ public:
 
     virtual RobotBasePtr GetRobot(const std::string& pname) const
     {
-        boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
-        FOREACHC(it, _vecrobots) {
-            if((*it)->GetName()==pname) {
-                return *it;
-            }
+        BodyRegistryConstPtr pregistry = _GetBodyRegistry();
+        boost::unordered_map<std::string, RobotBasePtr>::const_iterator it = pregistry->maprobots.find(pname);
+        if( it != pregistry->maprobots.end() ) {
+            return it->second;
         }
         //RAVELOG_VERBOSE(str(boost::format("Environment::GetRobot - Error: Unknown body %s\n")%pname));
         return RobotBasePtr();
@@ -904,19 +930,55 @@ public:
         }
 
         // simulate the sensors last (ie, they always reflect the most recent bodies
-        FOREACH(itsensor, listSensors) {
-            (*itsensor)->SimulationStep(fTimeStep);
-        }
+        vector<SensorBasePtr> vsensors(listSensors.begin(), listSensors.end());
         FOREACH(itrobot, vecrobots) {
             FOREACH(itsensor, (*itrobot)->GetAttachedSensors()) {
                 if( !!(*itsensor)->GetSensor() ) {
-                    (*itsensor)->GetSensor()->SimulationStep(fTimeStep);
+                    vsensors.push_back((*itsensor)->GetSensor());
                 }
             }
         }
+        _StepSensors(vsensors, vecbodies, fTimeStep);
         _nCurSimTime += step;
     }
 
+    virtual void SetSensorSimulationThreads(int numthreads)
+    {
+        if( numthreads <= 0 ) {
+            numthreads = max(1,(int)boost::thread::hardware_concurrency());
+        }
+        // cannot change the threads in the middle of a step
+        EnvironmentMutex::scoped_lock lockenv(GetMutex());
+        if( numthreads < _nSensorThreads ) {
+            _StopSensorThreads();
+        }
+        _nSensorThreads = numthreads;
+    }
+
+    virtual int GetSensorSimulationThreads() const {
+        return _nSensorThreads;
+    }
+
+    virtual void GetSensorSimulationStats(std::vector<SensorSimulationStats>& vstats, bool bReset)
+    {
+        vstats.resize(0);
+        boost::mutex::scoped_lock lock(_mutexSensorStats);
+        FOREACH_NOINC(itstats, _mapSensorStats) {
+            SensorBasePtr psensor = itstats->first.lock();
+            if( !psensor ) {
+                _mapSensorStats.erase(itstats++);
+                continue;
+            }
+            vstats.push_back(itstats->second);
+            vstats.back().psensor = psensor;
+            ++itstats;
+        }
+        if( bReset ) {
+            _mapSensorStats.clear();
+        }
+        std::sort(vstats.begin(), vstats.end(), _CompareSensorStatsTime);
+    }
+
     virtual EnvironmentMutex& GetMutex() const {
         return _mutexEnvironment;
     }
@@ -936,6 +998,15 @@ public:
         }
     }
 
+    virtual boost::shared_ptr<std::vector<KinBodyPtr> const> GetBodiesSnapshot(int* pstamp) const
+    {
+        BodyRegistryConstPtr pregistry = _GetBodyRegistry();
+        if( !!pstamp ) {
+            *pstamp = pregistry->stamp;
+        }
+        return pregistry->pvecbodies;
+    }
+
     virtual void GetRobots(std::vector<RobotBasePtr>& robots, uint64_t timeout) const
     {
         if( timeout == 0 ) {
@@ -1616,7 +1687,7 @@ public:
     {
         boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
         boost::mutex::scoped_lock locknetwork(_mutexEnvironmentIds);
-        map<int, KinBodyWeakPtr>::iterator it = _mapBodies.find(id);
+        boost::unordered_map<int, KinBodyWeakPtr>::iterator it = _mapBodies.find(id);
         if( it != _mapBodies.end() ) {
             return KinBodyPtr(it->second);
         }
@@ -1769,9 +1840,11 @@ protected:
                 }
                 _vecrobots.clear();
                 _vPublishedBodies.clear();
+                _mapBodyNameCallbacks.clear();
+                _InvalidateBodyRegistry();
             }
             // a little tricky due to a deadlocking situation
-            std::map<int, KinBodyWeakPtr> mapBodies;
+            boost::unordered_map<int, KinBodyWeakPtr> mapBodies;
             {
                 boost::mutex::scoped_lock locknetworkid(_mutexEnvironmentIds);
                 mapBodies = _mapBodies;
@@ -1841,6 +1914,11 @@ protected:
             std::vector<KinBodyPtr> vecbodies;
             std::vector<std::pair<Vector,Vector> > linkvelocities;
             _mapBodies.clear();
+            // the recorded update stamps are only valid for the environment that was last cloned from
+            if( !bCheckSharedResources || _pCloneSource.lock() != r ) {
+                _mapCloneUpdateStamps.clear();
+            }
+            _pCloneSource = r;
             if( bCheckSharedResources ) {
                 // delete any bodies/robots from mapBodies that are not in r->_vecrobots and r->_vecbodies
                 vecrobots.swap(_vecrobots);
@@ -1853,7 +1931,7 @@ protected:
                     RobotBasePtr pnewrobot;
                     if( bCheckSharedResources ) {
                         FOREACH(itrobot2,vecrobots) {
-                            if( (*itrobot2)->GetName() == (*itrobot)->GetName() && (*itrobot2)->GetKinematicsGeometryHash() == (*itrobot)->GetKinematicsGeometryHash() ) {
+                            if( (*itrobot2)->GetName() == (*itrobot)->GetName() && (_IsClonedBodyUnchanged(*itrobot2,*itrobot) || (*itrobot2)->GetKinematicsGeometryHash() == (*itrobot)->GetKinematicsGeometryHash()) ) {
                                 pnewrobot = *itrobot2;
                                 break;
                             }
@@ -1887,7 +1965,7 @@ protected:
                     KinBodyPtr pnewbody;
                     if( bCheckSharedResources ) {
                         FOREACH(itbody2,vecbodies) {
-                            if( (*itbody2)->GetName() == (*itbody)->GetName() && (*itbody2)->GetKinematicsGeometryHash() == (*itbody)->GetKinematicsGeometryHash() ) {
+                            if( (*itbody2)->GetName() == (*itbody)->GetName() && (_IsClonedBodyUnchanged(*itbody2,*itbody) || (*itbody2)->GetKinematicsGeometryHash() == (*itbody)->GetKinematicsGeometryHash()) ) {
                                 pnewbody = *itbody2;
                                 break;
                             }
@@ -1914,6 +1992,10 @@ protected:
             if( listToCopyState.size() > 0 ) {
                 FOREACH(itbody,listToCopyState) {
                     KinBodyPtr pnewbody = _mapBodies[(*itbody)->GetEnvironmentId()].lock();
+                    // the stamps do not track robot states like the active dofs or link velocities, so only skip bodies
+                    if( !pnewbody->IsRobot() && !(options & Clone_Simulation) && !bCollisionCheckerChanged && !bPhysicsEngineChanged && _IsClonedBodyUnchanged(pnewbody,*itbody) ) {
+                        continue;
+                    }
                     if( bCollisionCheckerChanged ) {
                         GetCollisionChecker()->InitKinBody(pnewbody);
                     }
@@ -1927,11 +2009,13 @@ protected:
                         // don't clone grabbed bodies!
                         RobotBase::RobotStateSaver saver(poldrobot, 0xffffffff&~KinBody::Save_GrabbedBodies);
                         saver.Restore(pnewrobot);
+                        saver.Release(); // the reference environment keeps its state, so do not touch its update stamps
                         pnewrobot->__hashrobotstructure = poldrobot->__hashrobotstructure;
                     }
                     else {
                         KinBody::KinBodyStateSaver saver(*itbody, 0xffffffff);
                         saver.Restore(pnewbody);
+                        saver.Release();
                     }
                 }
             }
@@ -1969,10 +2053,12 @@ protected:
                     // need to also update active dof/active manip since it is erased by _ComputeInternalInformation
                     RobotBase::RobotStateSaver saver(poldrobot, KinBody::Save_GrabbedBodies|KinBody::Save_LinkVelocities|KinBody::Save_ActiveDOF|KinBody::Save_ActiveManipulator);
                     saver.Restore(pnewrobot);
+                    saver.Release();
                 }
                 else {
                     KinBody::KinBodyStateSaver saver(*itbody, KinBody::Save_LinkVelocities); // all the others should have been saved?
                     saver.Restore(pnewbody);
+                    saver.Release();
                 }
             }
             if( listToCopyState.size() > 0 ) {
@@ -1983,10 +2069,29 @@ protected:
                         RobotBasePtr pnewrobot = RaveInterfaceCast<RobotBase>(_mapBodies[(*itbody)->GetEnvironmentId()].lock());
                         RobotBase::RobotStateSaver saver(poldrobot, KinBody::Save_GrabbedBodies);
                         saver.Restore(pnewrobot);
+                        saver.Release();
+                    }
+                }
+            }
+
+            // remember the stamps so that the next Clone from r only copies the state of the bodies that moved
+            _mapCloneUpdateStamps.clear();
+            FOREACHC(itbody, r->_vecbodies) {
+                boost::unordered_map<int, KinBodyWeakPtr>::iterator itnewbody = _mapBodies.find((*itbody)->GetEnvironmentId());
+                if( itnewbody != _mapBodies.end() ) {
+                    KinBodyPtr pnewbody = itnewbody->second.lock();
+                    if( !!pnewbody ) {
+                        _mapCloneUpdateStamps[pnewbody->GetEnvironmentId()] = make_pair((*itbody)->GetUpdateStamp(),pnewbody->GetUpdateStamp());
                     }
                 }
             }
         }
+        if( options & Clone_Bodies ) {
+            // the bodies were replaced and might have taken over environment ids, so register the name callbacks from scratch
+            boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
+            _mapBodyNameCallbacks.clear();
+            _InvalidateBodyRegistry();
+        }
         if( options & Clone_Sensors ) {
             boost::timed_mutex::scoped_lock lock(r->_mutexInterfaces);
             FOREACHC(itsensor,r->_listSensors) {
@@ -2052,6 +2157,16 @@ protected:
         }
     }
 
+    /// \brief true if neither body changed since pnewbody was last cloned from pbody. Every change of the kinematics, geometry or state increments the update stamps.
+    bool _IsClonedBodyUnchanged(KinBodyConstPtr pnewbody, KinBodyConstPtr pbody) const
+    {
+        if( pnewbody->GetEnvironmentId() != pbody->GetEnvironmentId() ) {
+            return false;
+        }
+        std::map<int, std::pair<int,int> >::const_iterator itstamp = _mapCloneUpdateStamps.find(pbody->GetEnvironmentId());
+        return itstamp != _mapCloneUpdateStamps.end() && itstamp->second.first == pbody->GetUpdateStamp() && itstamp->second.second == pnewbody->GetUpdateStamp();
+    }
+
     virtual bool _CheckUniqueName(KinBodyConstPtr pbody, bool bDoThrow=false) const
     {
         FOREACHC(itbody,_vecbodies) {
@@ -2105,6 +2220,64 @@ protected:
         pbody->_environmentid = 0;
     }
 
+    /// \brief returns the current body registry, building it if the bodies changed since the last call
+    BodyRegistryConstPtr _GetBodyRegistry() const
+    {
+        {
+            boost::mutex::scoped_lock lockregistry(_mutexBodyRegistry);
+            if( !!_pBodyRegistry ) {
+                return _pBodyRegistry;
+            }
+        }
+        boost::timed_mutex::scoped_lock lock(_mutexInterfaces);
+        return _UpdateBodyRegistry();
+    }
+
+    /// \brief builds and publishes a new body registry, _mutexInterfaces has to be locked
+    BodyRegistryConstPtr _UpdateBodyRegistry() const
+    {
+        int stamp;
+        {
+            boost::mutex::scoped_lock lockregistry(_mutexBodyRegistry);
+            if( !!_pBodyRegistry ) {
+                return _pBodyRegistry;
+            }
+            stamp = _nBodyRegistryStamp;
+        }
+
+        boost::shared_ptr<BodyRegistry> pregistry(new BodyRegistry());
+        pregistry->stamp = stamp;
+        pregistry->pvecbodies.reset(new std::vector<KinBodyPtr>(_vecbodies));
+        pregistry->mapbodies.rehash(_vecbodies.size());
+        FOREACHC(itbody, _vecbodies) {
+            pregistry->mapbodies.insert(make_pair((*itbody)->GetName(), *itbody));
+            // renaming a body does not go through the environment, so have the body tell us
+            UserDataPtr& pnamecallback = _mapBodyNameCallbacks[(*itbody)->GetEnvironmentId()];
+            if( !pnamecallback ) {
+                pnamecallback = (*itbody)->RegisterChangeCallback(KinBody::Prop_Name, boost::bind(&Environment::_InvalidateBodyRegistry, this));
+            }
+        }
+        pregistry->maprobots.rehash(_vecrobots.size());
+        FOREACHC(itrobot, _vecrobots) {
+            pregistry->maprobots.insert(make_pair((*itrobot)->GetName(), *itrobot));
+        }
+
+        boost::mutex::scoped_lock lockregistry(_mutexBodyRegistry);
+        if( _nBodyRegistryStamp == stamp ) {
+            _pBodyRegistry = pregistry;
+        }
+        // else a body was renamed while building, so the next call will build again
+        return pregistry;
+    }
+
+    /// \brief discards the current body registry, called whenever a body is added, removed, or renamed
+    void _InvalidateBodyRegistry() const
+    {
+        boost::mutex::scoped_lock lockregistry(_mutexBodyRegistry);
+        _nBodyRegistryStamp++;
+        _pBodyRegistry.reset();
+    }
+
     void _SimulationThread()
     {
         uint64_t nLastUpdateTime = utils::GetMicroTime();
@@ -2252,6 +2425,156 @@ protected:
         }
         return false;
     }
+    /// \brief calls SimulationStep of every sensor and updates their timing
+    ///
+    /// Has to be called with the environment locked. Batched ray casts of checkers that support concurrent rays do not initialize bodies,
+    /// so the collision models of the bodies that changed since the last step are brought up to date first. If several threads are used,
+    /// the sensor threads cannot lock the environment, so the bodies are also published beforehand.
+    void _StepSensors(const std::vector<SensorBasePtr>& vsensors, const std::vector<KinBodyPtr>& vecbodies, dReal fTimeStep)
+    {
+        vector<uint64_t> vsteptimes(vsensors.size(),0);
+        int numthreads = min(_nSensorThreads, (int)vsensors.size());
+        bool bconcurrentrays = _pCurrentChecker->IsRayBatchConcurrent();
+        if( numthreads > 1 && !bconcurrentrays ) {
+            RAVELOG_VERBOSE(str(boost::format("collision checker %s does not support concurrent rays, stepping sensors serially\n")%_pCurrentChecker->GetXMLId()));
+            numthreads = 1;
+        }
+        if( bconcurrentrays && vsensors.size() > 0 ) {
+            if( _pSensorInitChecker.lock() != _pCurrentChecker ) {
+                _mapSensorInitStamps.clear();
+                _pSensorInitChecker = _pCurrentChecker;
+            }
+            std::map<int, int> mapinitstamps;
+            FOREACHC(itbody, vecbodies) {
+                int environmentid = (*itbody)->GetEnvironmentId();
+                if( environmentid ) {
+                    int stamp = (*itbody)->GetUpdateStamp();
+                    std::map<int, int>::const_iterator itstamp = _mapSensorInitStamps.find(environmentid);
+                    if( itstamp == _mapSensorInitStamps.end() || itstamp->second != stamp ) {
+                        _pCurrentChecker->InitKinBody(*itbody);
+                    }
+                    mapinitstamps[environmentid] = stamp;
+                }
+            }
+            _mapSensorInitStamps.swap(mapinitstamps);
+        }
+        if( numthreads <= 1 ) {
+            for(size_t i = 0; i < vsensors.size(); ++i) {
+                uint64_t starttime = utils::GetMicroTime();
+                vsensors[i]->SimulationStep(fTimeStep);
+                vsteptimes[i] = utils::GetMicroTime()-starttime;
+            }
+        }
+        else {
+            UpdatePublishedBodies();
+            while((int)_vSensorThreads.size() < numthreads-1) {
+                _vSensorThreads.push_back(boost::shared_ptr<boost::thread>(new boost::thread(boost::bind(&Environment::_SensorThread, this))));
+            }
+
+            // the calling thread steps sensors too
+            boost::mutex::scoped_lock lock(_mutexSensorThreads);
+            _vSensorsToStep = vsensors;
+            _vSensorStepTimes.swap(vsteptimes);
+            _nNextSensorStep = 0;
+            _nSensorStepsDone = 0;
+            _fSensorTimeStep = fTimeStep;
+            _sensorsteperror.resize(0);
+            _condSensorStep.notify_all();
+            while(_nNextSensorStep < _vSensorsToStep.size()) {
+                _StepNextSensor(lock);
+            }
+            while(_nSensorStepsDone < _vSensorsToStep.size()) {
+                _condSensorStepDone.wait(lock);
+            }
+            _vSensorsToStep.resize(0);
+            _vSensorStepTimes.swap(vsteptimes);
+            if( _sensorsteperror.size() > 0 ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("failed to step sensors: %s", _sensorsteperror, ORE_Failed);
+            }
+        }
+
+        boost::mutex::scoped_lock lock(_mutexSensorStats);
+        for(size_t i = 0; i < vsensors.size(); ++i) {
+            SensorSimulationStats& stats = _mapSensorStats[SensorBaseWeakPtr(vsensors[i])];
+            stats.numsteps++;
+            stats.totaltime += vsteptimes[i];
+            stats.maxtime = max(stats.maxtime, vsteptimes[i]);
+            stats.lasttime = vsteptimes[i];
+        }
+        if( _mapSensorStats.size() > 2*vsensors.size()+16 ) {
+            // remove the destroyed sensors
+            FOREACH_NOINC(itstats, _mapSensorStats) {
+                if( itstats->first.expired() ) {
+                    _mapSensorStats.erase(itstats++);
+                }
+                else {
+                    ++itstats;
+                }
+            }
+        }
+    }
+
+    /// \brief steps the next sensor of _vSensorsToStep, has to be called with _mutexSensorThreads locked by lock
+    void _StepNextSensor(boost::mutex::scoped_lock& lock)
+    {
+        size_t index = _nNextSensorStep++;
+        SensorBasePtr psensor = _vSensorsToStep[index];
+        dReal fTimeStep = _fSensorTimeStep;
+        lock.unlock();
+        string error;
+        uint64_t starttime = utils::GetMicroTime();
+        try {
+            psensor->SimulationStep(fTimeStep);
+        }
+        catch(const std::exception& ex) {
+            error = ex.what();
+        }
+        catch(...) {
+            error = "unknown exception";
+        }
+        uint64_t steptime = utils::GetMicroTime()-starttime;
+        lock.lock();
+        _vSensorStepTimes[index] = steptime;
+        if( error.size() > 0 && _sensorsteperror.size() == 0 ) {
+            _sensorsteperror = str(boost::format("%s: %s")%psensor->GetName()%error);
+        }
+        if( ++_nSensorStepsDone == _vSensorsToStep.size() ) {
+            _condSensorStepDone.notify_all();
+        }
+    }
+
+    void _SensorThread()
+    {
+        boost::mutex::scoped_lock lock(_mutexSensorThreads);
+        while(!_bShutdownSensorThreads) {
+            if( _nNextSensorStep < _vSensorsToStep.size() ) {
+                _StepNextSensor(lock);
+            }
+            else {
+                _condSensorStep.wait(lock);
+            }
+        }
+    }
+
+    void _StopSensorThreads()
+    {
+        {
+            boost::mutex::scoped_lock lock(_mutexSensorThreads);
+            _bShutdownSensorThreads = true;
+            _condSensorStep.notify_all();
+        }
+        FOREACH(itthread, _vSensorThreads) {
+            (*itthread)->join();
+        }
+        _vSensorThreads.clear();
+        _bShutdownSensorThreads = false;
+    }
+
+    static bool _CompareSensorStatsTime(const SensorSimulationStats& stats0, const SensorSimulationStats& stats1)
+    {
+        return stats0.totaltime > stats1.totaltime;
+    }
+
     static bool _IsRigidModelFile(const std::string& filename)
     {
         static boost::array<std::string,21> s_geometryextentsions = { { "iv","vrml","wrl","stl","blend","3ds","ase","obj","ply","dxf","lwo","lxo","ac","ms3d","x","mesh.xml","irrmesh","irr","nff","off","raw"}};
@@ -2292,14 +2615,35 @@ protected:
     PhysicsEngineBasePtr _pPhysicsEngine;
 
     int _nEnvironmentIndex;                   ///< next network index
-    std::map<int, KinBodyWeakPtr> _mapBodies;     ///< a map of all the bodies in the environment. Controlled through the KinBody constructor and destructors
+    boost::unordered_map<int, KinBodyWeakPtr> _mapBodies;     ///< a map of all the bodies in the environment. Controlled through the KinBody constructor and destructors
+    mutable BodyRegistryConstPtr _pBodyRegistry;     ///< index of the current bodies, empty if it has to be rebuilt, see _GetBodyRegistry
+    mutable int _nBodyRegistryStamp;     ///< incremented every time _pBodyRegistry is invalidated
+    mutable boost::unordered_map<int, UserDataPtr> _mapBodyNameCallbacks;     ///< environment id -> handle of the Prop_Name callback invalidating _pBodyRegistry, protected by _mutexInterfaces
+    boost::weak_ptr<Environment const> _pCloneSource; ///< the environment the bodies were last cloned from
+    std::map<int, std::pair<int,int> > _mapCloneUpdateStamps; ///< environment id -> (update stamp of the source body, update stamp of the cloned body) at the last clone
 
     boost::shared_ptr<boost::thread> _threadSimulation;                      ///< main loop for environment simulation
 
+    int _nSensorThreads;     ///< number of threads stepping the sensors, see SetSensorSimulationThreads
+    std::vector<boost::shared_ptr<boost::thread> > _vSensorThreads;     ///< helper threads of StepSimulation, the calling thread is not included
+    boost::mutex _mutexSensorThreads;     ///< protects the sensor step state below
+    boost::condition _condSensorStep, _condSensorStepDone;
+    std::vector<SensorBasePtr> _vSensorsToStep;     ///< the sensors of the current step
+    std::vector<uint64_t> _vSensorStepTimes;     ///< the time each sensor of _vSensorsToStep took
+    size_t _nNextSensorStep, _nSensorStepsDone;
+    dReal _fSensorTimeStep;
+    std::string _sensorsteperror;     ///< first exception thrown by a sensor of the current step
+    std::map<int, int> _mapSensorInitStamps;     ///< environment id -> update stamp of the bodies when they were last initialized in _pSensorInitChecker by _StepSensors
+    CollisionCheckerBaseWeakPtr _pSensorInitChecker;
+    bool _bShutdownSensorThreads;
+    boost::mutex _mutexSensorStats;
+    std::map<SensorBaseWeakPtr, SensorSimulationStats> _mapSensorStats;     ///< timing of every sensor stepped, psensor is not set
+
     mutable EnvironmentMutex _mutexEnvironment;          ///< protects internal data from multithreading issues
     mutable boost::mutex _mutexEnvironmentIds;      ///< protects _vecbodies/_vecrobots from multithreading issues
     mutable boost::timed_mutex _mutexInterfaces;     ///< lock when managing interfaces like _listOwnedInterfaces, _listModules, _mapBodies
     mutable boost::mutex _mutexInit;     ///< lock for destroying the environment
+    mutable boost::mutex _mutexBodyRegistry;     ///< protects _pBodyRegistry and _nBodyRegistryStamp, only held for swapping the pointer
 
     vector<KinBody::BodyState> _vPublishedBodies;
     string _homedirectory;
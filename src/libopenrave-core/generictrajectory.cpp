@@ -72,6 +72,7 @@ public:
             _bInit = false;
             _vgroupinterpolators.resize(0);
             _vgroupvalidators.resize(0);
+            _vgroupinlineinterpolation.resize(0);
             _vderivoffsets.resize(0);
             _spec = spec;
             // order the groups based on computation order
@@ -84,6 +85,7 @@ public:
             }
             _vgroupinterpolators.resize(_spec._vgroups.size());
             _vgroupvalidators.resize(_spec._vgroups.size());
+            _vgroupinlineinterpolation.resize(_spec._vgroups.size(),0);
             _vderivoffsets.resize(_spec.GetDOF(),-1);
             for(size_t i = 0; i < _spec._vgroups.size(); ++i) {
                 const string& interpolation = _spec._vgroups[i].interpolation;
@@ -105,6 +107,7 @@ public:
                     else {
                         _vgroupinterpolators[i] = boost::bind(&GenericTrajectory::_InterpolateLinear,this,boost::ref(_spec._vgroups[i]),_1,_2,_3);
                         _vgroupvalidators[i] = boost::bind(&GenericTrajectory::_ValidateLinear,this,boost::ref(_spec._vgroups[i]),_1,_2);
+                        _vgroupinlineinterpolation[i] = 1;
                     }
                     nNeedDerivatives = 2;
                 }
@@ -119,6 +122,7 @@ public:
                     else {
                         _vgroupinterpolators[i] = boost::bind(&GenericTrajectory::_InterpolateQuadratic,this,boost::ref(_spec._vgroups[i]),_1,_2,_3);
                         _vgroupvalidators[i] = boost::bind(&GenericTrajectory::_ValidateQuadratic,this,boost::ref(_spec._vgroups[i]),_1,_2);
+                        _vgroupinlineinterpolation[i] = 2;
                     }
                     nNeedDerivatives = 3;
                 }
@@ -297,6 +301,37 @@ public:
         }
     }
 
+    void SamplePoints(std::vector<dReal>& data, const std::vector<dReal>& times) const
+    {
+        BOOST_ASSERT(_bInit);
+        BOOST_ASSERT(_timeoffset>=0);
+        _ComputeInternal();
+        _VerifySampling();
+        data.resize(times.size()*_spec.GetDOF());
+        if( times.size() > 0 ) {
+            _SamplePoints(&times[0],times.size(),&data[0]);
+        }
+    }
+
+    void SamplePoints(std::vector<dReal>& data, const std::vector<dReal>& times, const ConfigurationSpecification& spec) const
+    {
+        if( spec == _spec ) {
+            SamplePoints(data,times);
+            return;
+        }
+        BOOST_ASSERT(_bInit);
+        BOOST_ASSERT(_timeoffset>=0);
+        _ComputeInternal();
+        _VerifySampling();
+        vector<dReal> vinternaldata(times.size()*_spec.GetDOF());
+        data.resize(0);
+        data.resize(times.size()*spec.GetDOF(),0);
+        if( times.size() > 0 ) {
+            _SamplePoints(&times[0],times.size(),&vinternaldata[0]);
+            ConfigurationSpecification::ConvertData(data.begin(),spec,vinternaldata.begin(),_spec,times.size(),GetEnv());
+        }
+    }
+
     const ConfigurationSpecification& GetConfigurationSpecification() const
     {
         return _spec;
@@ -335,6 +370,10 @@ public:
 
     void serialize(std::ostream& O, int options) const
     {
+        if( options & TSO_Binary ) {
+            TrajectoryBase::serialize(O,options);
+            return;
+        }
         O << "<trajectory>" << endl << _spec;
         O << "<data count=\"" << GetNumWaypoints() << "\">" << endl;
         FOREACHC(it,_vtrajdata) {
@@ -414,6 +453,88 @@ protected:
         _bSamplingVerified = false;
     }
 
+    /// \brief samples numtimes points into pdata, same as calling Sample for every time.
+    ///
+    /// The waypoint search continues from the previous sample, and linear and quadratic groups are evaluated inline
+    /// instead of going through _vgroupinterpolators. Assumes _ComputeInternal and _VerifySampling have finished.
+    void _SamplePoints(const dReal* ptimes, size_t numtimes, dReal* pdata) const
+    {
+        const int dof = _spec.GetDOF();
+        const dReal duration = _vaccumtime.size() > 0 ? _vaccumtime.back() : 0;
+        const dReal* ptrajdata = &_vtrajdata[0];
+        std::vector<dReal> vpoint; // for groups that are not inline
+        size_t index = 0;
+        for(size_t isample = 0; isample < numtimes; ++isample, pdata += dof) {
+            dReal time = ptimes[isample];
+            BOOST_ASSERT(time >= 0);
+            if( time >= duration ) {
+                std::copy(_vtrajdata.end()-dof,_vtrajdata.end(),pdata);
+                continue;
+            }
+            // index is the first waypoint whose time is >= time, the same as std::lower_bound
+            if( index > 0 && _vaccumtime[index-1] >= time ) {
+                index = std::lower_bound(_vaccumtime.begin(),_vaccumtime.end(),time)-_vaccumtime.begin();
+            }
+            else {
+                while(_vaccumtime[index] < time) {
+                    ++index;
+                }
+            }
+            if( index == 0 ) {
+                std::copy(_vtrajdata.begin(),_vtrajdata.begin()+dof,pdata);
+                continue;
+            }
+
+            size_t ipoint = index-1;
+            dReal deltatime = time-_vaccumtime[ipoint];
+            const dReal* p0 = ptrajdata+ipoint*dof;
+            const dReal* p1 = p0+dof;
+            std::fill(pdata,pdata+dof,dReal(0));
+            for(size_t igroup = 0; igroup < _vgroupinterpolators.size(); ++igroup) {
+                const ConfigurationSpecification::Group& g = _spec._vgroups[igroup];
+                switch(_vgroupinlineinterpolation[igroup]) {
+                case 1: {
+                    int derivoffset = _vderivoffsets[g.offset];
+                    if( derivoffset < 0 ) {
+                        dReal f = _vdeltainvtime[ipoint+1]*deltatime;
+                        for(int i = 0; i < g.dof; ++i) {
+                            pdata[g.offset+i] = p0[g.offset+i]*(1-f) + f*p1[g.offset+i];
+                        }
+                    }
+                    else {
+                        for(int i = 0; i < g.dof; ++i) {
+                            pdata[g.offset+i] = p0[g.offset+i] + deltatime*p1[derivoffset+i];
+                        }
+                    }
+                    break;
+                }
+                case 2: {
+                    if( deltatime > g_fEpsilon ) {
+                        int derivoffset = _vderivoffsets[g.offset];
+                        dReal halfinvtime = 0.5*_vdeltainvtime[ipoint+1];
+                        for(int i = 0; i < g.dof; ++i) {
+                            dReal deriv0 = p0[derivoffset+i];
+                            dReal coeff = halfinvtime*(p1[derivoffset+i]-deriv0);
+                            pdata[g.offset+i] = p0[g.offset+i] + deltatime*(deriv0 + deltatime*coeff);
+                        }
+                    }
+                    else {
+                        std::copy(p0+g.offset,p0+g.offset+g.dof,pdata+g.offset);
+                    }
+                    break;
+                }
+                default:
+                    if( !!_vgroupinterpolators[igroup] ) {
+                        vpoint.resize(dof);
+                        _vgroupinterpolators[igroup](ipoint,deltatime,vpoint);
+                        std::copy(vpoint.begin()+g.offset,vpoint.begin()+g.offset+g.dof,pdata+g.offset);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
     /// \brief assumes _ComputeInternal has finished
     void _VerifySampling() const
     {
@@ -671,6 +792,7 @@ protected:
     ConfigurationSpecification _spec;
     std::vector< boost::function<void(size_t,dReal,std::vector<dReal>&)> > _vgroupinterpolators;
     std::vector< boost::function<void(size_t,dReal)> > _vgroupvalidators;
+    std::vector<uint8_t> _vgroupinlineinterpolation; ///< for every group, 1 if linear and 2 if quadratic interpolation can be computed inline by _SamplePoints, 0 if _vgroupinterpolators has to be called
     std::vector<int> _vderivoffsets; ///< for every group that relies on derivatives, this will point to the offset (-1 if invalid and not needed, -2 if invalid and needed)
     int _timeoffset;
     bool _bInit;
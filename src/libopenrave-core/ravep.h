@@ -300,6 +300,7 @@ bool CreateGeometries(EnvironmentBasePtr penv, const std::string& filename, cons
 #include <boost/thread/mutex.hpp>
 #include <boost/thread/condition.hpp>
 #include <boost/tuple/tuple.hpp>
+#include <boost/unordered_map.hpp>
 #include <boost/assert.hpp>
 #include <boost/version.hpp>
 
@@ -229,7 +229,7 @@ static bool _AssimpCreateTriMesh(const aiScene* scene, aiNode* node, const Vecto
 
 #endif
 
-bool CreateTriMeshData(EnvironmentBasePtr penv, const std::string& filename, const Vector& vscale, KinBody::Link::TRIMESH& trimesh, RaveVector<float>& diffuseColor, RaveVector<float>& ambientColor, float& ftransparency)
+static bool _ParseTriMeshData(EnvironmentBasePtr penv, const std::string& filename, const Vector& vscale, KinBody::Link::TRIMESH& trimesh, RaveVector<float>& diffuseColor, RaveVector<float>& ambientColor, float& ftransparency)
 {
     string extension;
     if( filename.find_last_of('.') != string::npos ) {
@@ -319,6 +319,272 @@ bool CreateTriMeshData(EnvironmentBasePtr penv, const std::string& filename, con
     return false;
 }
 
+/// \brief a parsed mesh file
+struct CachedTriMesh
+{
+    KinBody::Link::TRIMESH trimesh;
+    RaveVector<float> diffuseColor, ambientColor; ///< negative if not set by the file
+    float ftransparency; ///< negative if not set by the file
+};
+typedef boost::shared_ptr<CachedTriMesh const> CachedTriMeshConstPtr;
+
+/// \brief meshes parsed by the process, the least recently used ones are dropped once they take more than s_nTriMeshCacheMaxBytes
+struct TriMeshCache
+{
+    TriMeshCache() : _nBytes(0) {
+    }
+    typedef std::list< std::pair<std::string, CachedTriMeshConstPtr> > MeshList;
+    boost::mutex _mutex;
+    MeshList _listMeshes; ///< most recently used first
+    std::map<std::string, MeshList::iterator> _mapMeshes; ///< indexed by the md5 of the contents of the files and the scale
+    size_t _nBytes; ///< memory taken by the meshes of _listMeshes
+};
+
+static TriMeshCache s_trimeshcache;
+static const size_t s_nTriMeshCacheMaxBytes = 256*1024*1024;
+static const size_t s_nMaxTriMeshDependencies = 64; ///< stop looking for referenced files after this many were found
+static const int s_nMaxTriMeshDependencyDepth = 2; ///< how deep to follow files referenced by referenced files
+
+static size_t _GetCachedTriMeshBytes(const CachedTriMesh& mesh)
+{
+    return sizeof(CachedTriMesh) + mesh.trimesh.vertices.size()*sizeof(Vector) + mesh.trimesh.indices.size()*sizeof(int);
+}
+
+static CachedTriMeshConstPtr _FindCachedTriMesh(const std::string& hash)
+{
+    boost::mutex::scoped_lock lock(s_trimeshcache._mutex);
+    std::map<std::string, TriMeshCache::MeshList::iterator>::iterator it = s_trimeshcache._mapMeshes.find(hash);
+    if( it == s_trimeshcache._mapMeshes.end() ) {
+        return CachedTriMeshConstPtr();
+    }
+    s_trimeshcache._listMeshes.splice(s_trimeshcache._listMeshes.begin(), s_trimeshcache._listMeshes, it->second);
+    return it->second->second;
+}
+
+static void _AddCachedTriMesh(const std::string& hash, CachedTriMeshConstPtr pmesh)
+{
+    size_t nbytes = _GetCachedTriMeshBytes(*pmesh);
+    if( nbytes > s_nTriMeshCacheMaxBytes/4 ) {
+        // keeping it would push out most of the other meshes
+        return;
+    }
+    boost::mutex::scoped_lock lock(s_trimeshcache._mutex);
+    if( s_trimeshcache._mapMeshes.find(hash) != s_trimeshcache._mapMeshes.end() ) {
+        return;
+    }
+    s_trimeshcache._listMeshes.push_front(make_pair(hash,pmesh));
+    s_trimeshcache._mapMeshes[hash] = s_trimeshcache._listMeshes.begin();
+    s_trimeshcache._nBytes += nbytes;
+    while( s_trimeshcache._nBytes > s_nTriMeshCacheMaxBytes ) {
+        TriMeshCache::MeshList::iterator itlast = --s_trimeshcache._listMeshes.end();
+        s_trimeshcache._nBytes -= _GetCachedTriMeshBytes(*itlast->second);
+        s_trimeshcache._mapMeshes.erase(itlast->first);
+        s_trimeshcache._listMeshes.erase(itlast);
+    }
+}
+
+/// \brief true if token looks like the name of a file, such as an inline, a texture, or a material library
+static bool _IsFileNameToken(const std::string& token)
+{
+    size_t pos = token.find_last_of('.');
+    if( token.size() < 3 || token.size() > 1024 || pos == string::npos || pos == 0 || token.size()-pos-1 < 1 || token.size()-pos-1 > 5 || !isalpha(token[pos+1]) ) {
+        return false;
+    }
+    for(size_t i = pos+1; i < token.size(); ++i) {
+        if( !isalnum(token[i]) ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// \brief appends the files that the mesh data refers to by name.
+///
+/// The parsers do not tell which files they read, so every token of the data that names an existing file
+/// relative to the directory of the mesh (or an absolute path) is treated as one.
+static void _GetTriMeshDependencies(const std::string& filename, const std::string& data, int depth, std::map<std::string, std::string>& mapdependencies)
+{
+    string directory;
+    size_t pos = filename.find_last_of("/\\");
+    if( pos != string::npos ) {
+        directory = filename.substr(0,pos+1);
+    }
+    std::set<std::string> settokens;
+    const char* delimiters = "\"'<>()[]{},;=|#";
+    size_t i = 0;
+    while( i < data.size() && mapdependencies.size() < s_nMaxTriMeshDependencies ) {
+        while( i < data.size() && (data[i] <= ' ' || data[i] >= 127 || strchr(delimiters,data[i]) != NULL) ) {
+            ++i;
+        }
+        size_t start = i;
+        while( i < data.size() && data[i] > ' ' && data[i] < 127 && strchr(delimiters,data[i]) == NULL ) {
+            ++i;
+        }
+        string token = data.substr(start,i-start);
+        if( token.size() > 7 && token.substr(0,7) == "file://" ) {
+            token = token.substr(7);
+        }
+        if( !_IsFileNameToken(token) || !settokens.insert(token).second ) {
+            continue;
+        }
+        string dependency = (token[0] == '/' || directory.size() == 0) ? token : directory + token;
+        if( dependency == filename || mapdependencies.find(dependency) != mapdependencies.end() ) {
+            continue;
+        }
+        ifstream f(dependency.c_str(), ios::in|ios::binary);
+        if( !f ) {
+            continue;
+        }
+        stringstream ss;
+        ss << f.rdbuf();
+        mapdependencies[dependency] = ss.str();
+        if( depth+1 < s_nMaxTriMeshDependencyDepth ) {
+            _GetTriMeshDependencies(dependency, mapdependencies[dependency], depth+1, mapdependencies);
+        }
+    }
+}
+
+static const uint32_t s_nTriMeshCacheVersion = 0x4d545231; ///< changes whenever the file format or the parsers change
+
+/// \brief reads a mesh written by _SaveCachedTriMesh, fails on any inconsistency
+static CachedTriMeshConstPtr _LoadCachedTriMesh(const std::string& filename)
+{
+    ifstream f(filename.c_str(), ios::in|ios::binary);
+    if( !f ) {
+        return CachedTriMeshConstPtr();
+    }
+    uint32_t header[4];
+    if( !f.read((char*)header, sizeof(header)) || header[0] != s_nTriMeshCacheVersion || header[1] != sizeof(dReal) ) {
+        return CachedTriMeshConstPtr();
+    }
+    // check the counts against the size of the file before allocating anything, a corrupted header could otherwise request gigabytes
+    float colors[9];
+    uint64_t expectedsize = sizeof(header) + 3*(uint64_t)header[2]*sizeof(dReal) + (uint64_t)header[3]*sizeof(int) + sizeof(colors);
+    f.seekg(0, ios::end);
+    if( !f || (uint64_t)f.tellg() != expectedsize ) {
+        return CachedTriMeshConstPtr();
+    }
+    f.seekg(sizeof(header), ios::beg);
+    boost::shared_ptr<CachedTriMesh> pmesh(new CachedTriMesh());
+    vector<dReal> vertices(3*(size_t)header[2]);
+    pmesh->trimesh.indices.resize(header[3]);
+    if( vertices.size() > 0 && !f.read((char*)&vertices[0], vertices.size()*sizeof(dReal)) ) {
+        return CachedTriMeshConstPtr();
+    }
+    if( pmesh->trimesh.indices.size() > 0 && !f.read((char*)&pmesh->trimesh.indices[0], pmesh->trimesh.indices.size()*sizeof(int)) ) {
+        return CachedTriMeshConstPtr();
+    }
+    if( !f.read((char*)colors, sizeof(colors)) ) {
+        return CachedTriMeshConstPtr();
+    }
+    FOREACHC(itindex, pmesh->trimesh.indices) {
+        if( *itindex < 0 || *itindex >= (int)header[2] ) {
+            return CachedTriMeshConstPtr();
+        }
+    }
+    pmesh->trimesh.vertices.resize(header[2]);
+    for(size_t i = 0; i < pmesh->trimesh.vertices.size(); ++i) {
+        pmesh->trimesh.vertices[i] = Vector(vertices[3*i],vertices[3*i+1],vertices[3*i+2]);
+    }
+    pmesh->diffuseColor = RaveVector<float>(colors[0],colors[1],colors[2],colors[3]);
+    pmesh->ambientColor = RaveVector<float>(colors[4],colors[5],colors[6],colors[7]);
+    pmesh->ftransparency = colors[8];
+    return pmesh;
+}
+
+static void _SaveCachedTriMesh(const std::string& filename, const CachedTriMesh& mesh)
+{
+    // write to a temporary file first so that other processes never read a partial file, the name is unique so that processes saving the same mesh do not write into each other's file
+    string tempfilename = str(boost::format("%s.%x.tmp")%filename%utils::GetNanoTime());
+    {
+        ofstream f(tempfilename.c_str(), ios::out|ios::binary);
+        if( !f ) {
+            RAVELOG_DEBUG(str(boost::format("cannot write mesh cache %s\n")%tempfilename));
+            return;
+        }
+        uint32_t header[4] = { s_nTriMeshCacheVersion, sizeof(dReal), (uint32_t)mesh.trimesh.vertices.size(), (uint32_t)mesh.trimesh.indices.size() };
+        vector<dReal> vertices; vertices.reserve(3*mesh.trimesh.vertices.size());
+        FOREACHC(itv, mesh.trimesh.vertices) {
+            vertices.push_back(itv->x); vertices.push_back(itv->y); vertices.push_back(itv->z);
+        }
+        float colors[9] = { mesh.diffuseColor.x, mesh.diffuseColor.y, mesh.diffuseColor.z, mesh.diffuseColor.w, mesh.ambientColor.x, mesh.ambientColor.y, mesh.ambientColor.z, mesh.ambientColor.w, mesh.ftransparency };
+        f.write((const char*)header, sizeof(header));
+        if( vertices.size() > 0 ) {
+            f.write((const char*)&vertices[0], vertices.size()*sizeof(dReal));
+        }
+        if( mesh.trimesh.indices.size() > 0 ) {
+            f.write((const char*)&mesh.trimesh.indices[0], mesh.trimesh.indices.size()*sizeof(int));
+        }
+        f.write((const char*)colors, sizeof(colors));
+        if( !f ) {
+            f.close();
+            remove(tempfilename.c_str());
+            return;
+        }
+    }
+    if( rename(tempfilename.c_str(), filename.c_str()) != 0 ) {
+        remove(tempfilename.c_str());
+    }
+}
+
+/// \brief parses a mesh file, reusing the meshes already parsed by this process or saved in the OpenRAVE home directory.
+///
+/// Meshes are indexed by the md5 of the contents of the file and of the files it refers to, and the scale, so edited files are parsed again.
+bool CreateTriMeshData(EnvironmentBasePtr penv, const std::string& filename, const Vector& vscale, KinBody::Link::TRIMESH& trimesh, RaveVector<float>& diffuseColor, RaveVector<float>& ambientColor, float& ftransparency)
+{
+    string hash;
+    {
+        ifstream f(filename.c_str(), ios::in|ios::binary);
+        if( !!f ) {
+            stringstream ssdata;
+            ssdata << f.rdbuf();
+            string data = ssdata.str();
+            std::map<std::string, std::string> mapdependencies;
+            _GetTriMeshDependencies(filename, data, 0, mapdependencies);
+            stringstream ss;
+            ss << data;
+            FOREACHC(itdependency, mapdependencies) {
+                ss << " " << itdependency->first << " " << itdependency->second.size() << " " << itdependency->second;
+            }
+            ss << std::setprecision(std::numeric_limits<dReal>::digits10+1) << " " << vscale.x << " " << vscale.y << " " << vscale.z;
+            hash = utils::GetMD5HashString(ss.str());
+        }
+    }
+    if( hash.size() == 0 ) {
+        // not a local file
+        return _ParseTriMeshData(penv,filename,vscale,trimesh,diffuseColor,ambientColor,ftransparency);
+    }
+
+    CachedTriMeshConstPtr pmesh = _FindCachedTriMesh(hash);
+    if( !pmesh ) {
+        string cachefilename = RaveGetHomeDirectory() + string("/trimesh.") + hash + string(".cache");
+        pmesh = _LoadCachedTriMesh(cachefilename);
+        if( !pmesh ) {
+            boost::shared_ptr<CachedTriMesh> pnewmesh(new CachedTriMesh());
+            // negative values mark the properties the file does not set, so the caller keeps its own
+            pnewmesh->diffuseColor = pnewmesh->ambientColor = RaveVector<float>(-1,-1,-1,-1);
+            pnewmesh->ftransparency = -1;
+            if( !_ParseTriMeshData(penv,filename,vscale,pnewmesh->trimesh,pnewmesh->diffuseColor,pnewmesh->ambientColor,pnewmesh->ftransparency) ) {
+                return false;
+            }
+            _SaveCachedTriMesh(cachefilename, *pnewmesh);
+            pmesh = pnewmesh;
+        }
+        _AddCachedTriMesh(hash, pmesh);
+    }
+    trimesh = pmesh->trimesh;
+    if( pmesh->diffuseColor.x >= 0 ) {
+        diffuseColor = pmesh->diffuseColor;
+    }
+    if( pmesh->ambientColor.x >= 0 ) {
+        ambientColor = pmesh->ambientColor;
+    }
+    if( pmesh->ftransparency >= 0 ) {
+        ftransparency = pmesh->ftransparency;
+    }
+    return true;
+}
+
 
 struct XMLREADERDATA
 {
@@ -65,6 +65,7 @@ public:
         IkSolverBasePtr iksolver = _iksolverweak.lock();
         if( !!iksolver ) {
             iksolver->__listRegisteredFilters.erase(_iterator);
+            ++iksolver->__nUpdateStamp;
         }
     }
 
@@ -143,6 +144,135 @@ bool IkSolverBase::SolveAll(const IkParameterization& param, const std::vector<d
     return vsolutions.size() > 0;
 }
 
+int IkSolverBase::SolveBatch(const std::vector<IkParameterization>& vparams, const std::vector<dReal>& q0, int filteroptions, std::vector<IkReturnPtr>& ikreturns, int numthreads)
+{
+    ikreturns.resize(vparams.size());
+    FOREACH(itikreturn, ikreturns) {
+        if( !*itikreturn ) {
+            itikreturn->reset(new IkReturn(IKRA_Reject));
+        }
+        else {
+            (*itikreturn)->Clear();
+            (*itikreturn)->_action = IKRA_Reject;
+        }
+    }
+    if( numthreads <= 0 ) {
+        numthreads = max(1,(int)boost::thread::hardware_concurrency());
+    }
+    numthreads = min(numthreads,(int)vparams.size());
+    if( numthreads > 1 && !(filteroptions & IKFO_IgnoreCustomFilters) ) {
+        FOREACHC(it,__listRegisteredFilters) {
+            if( !!it->lock() ) {
+                RAVELOG_VERBOSE("custom filters are registered, so SolveBatch has to solve serially\n");
+                numthreads = 1;
+                break;
+            }
+        }
+    }
+
+    RobotBase::ManipulatorPtr pmanip = GetManipulator();
+    if( numthreads > 1 && !!pmanip ) {
+        // synchronize the environment clones of every thread and initialize an ik solver for each of them
+        try {
+            RobotBasePtr probot = pmanip->GetRobot();
+            if( __vBatchContexts.size() < (size_t)numthreads ) {
+                __vBatchContexts.resize(numthreads);
+            }
+            for(int ithread = 0; ithread < numthreads; ++ithread) {
+                std::pair<EnvironmentBasePtr, IkSolverBasePtr>& context = __vBatchContexts[ithread];
+                if( !context.first ) {
+                    context.first = GetEnv()->CloneSelf(Clone_Bodies);
+                    context.first->StopSimulation();
+                }
+                else {
+                    context.first->Clone(GetEnv(), Clone_Bodies);
+                }
+                RobotBase::ManipulatorPtr pclonemanip;
+                RobotBasePtr pclonerobot = context.first->GetRobot(probot->GetName());
+                if( !!pclonerobot ) {
+                    FOREACHC(itmanip, pclonerobot->GetManipulators()) {
+                        if( (*itmanip)->GetName() == pmanip->GetName() ) {
+                            pclonemanip = *itmanip;
+                            break;
+                        }
+                    }
+                }
+                OPENRAVE_ASSERT_FORMAT(!!pclonemanip, "could not find manipulator %s:%s in environment clone", probot->GetName()%pmanip->GetName(), ORE_Failed);
+                if( !context.second || context.second->GetManipulator() != pclonemanip ) {
+                    context.second = RaveCreateIkSolver(context.first, GetXMLId());
+                    OPENRAVE_ASSERT_FORMAT(!!context.second, "failed to create ik solver '%s' in environment clone", GetXMLId(), ORE_InvalidPlugin);
+                    context.second->Clone(shared_from_this(), 0);
+                    if( !context.second->Init(pclonemanip) ) {
+                        context.second.reset();
+                        throw OPENRAVE_EXCEPTION_FORMAT("failed to initialize ik solver '%s' in environment clone", GetXMLId(), ORE_Failed);
+                    }
+                }
+                else {
+                    // pick up any changed settings
+                    context.second->Clone(shared_from_this(), 0);
+                }
+            }
+        }
+        catch(const std::exception& ex) {
+            RAVELOG_WARN(str(boost::format("failed to prepare SolveBatch threads, solving serially: %s\n")%ex.what()));
+            numthreads = 1;
+        }
+    }
+
+    if( numthreads <= 1 || !pmanip ) {
+        for(size_t i = 0; i < vparams.size(); ++i) {
+            Solve(vparams[i], q0, filteroptions, ikreturns[i]);
+        }
+    }
+    else {
+        __nextBatchIndex = 0;
+        __batcherror.resize(0);
+        boost::thread_group threads;
+        for(int ithread = 1; ithread < numthreads; ++ithread) {
+            threads.create_thread(boost::bind(&IkSolverBase::__SolveBatchThread, this, __vBatchContexts[ithread].first, __vBatchContexts[ithread].second, boost::cref(vparams), boost::cref(q0), filteroptions, boost::ref(ikreturns)));
+        }
+        // the calling thread works on the first clone
+        __SolveBatchThread(__vBatchContexts[0].first, __vBatchContexts[0].second, vparams, q0, filteroptions, ikreturns);
+        threads.join_all();
+        if( __batcherror.size() > 0 ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("SolveBatch failed: %s", __batcherror, ORE_Failed);
+        }
+    }
+
+    int numsolved = 0;
+    FOREACHC(itikreturn, ikreturns) {
+        if( (*itikreturn)->_action == IKRA_Success ) {
+            ++numsolved;
+        }
+    }
+    return numsolved;
+}
+
+void IkSolverBase::__SolveBatchThread(EnvironmentBasePtr penv, IkSolverBasePtr iksolver, const std::vector<IkParameterization>& vparams, const std::vector<dReal>& q0, int filteroptions, std::vector<IkReturnPtr>& ikreturns)
+{
+    EnvironmentMutex::scoped_lock lock(penv->GetMutex());
+    while(1) {
+        size_t index;
+        {
+            boost::mutex::scoped_lock lockbatch(__mutexBatch);
+            if( __nextBatchIndex >= vparams.size() || __batcherror.size() > 0 ) {
+                break;
+            }
+            index = __nextBatchIndex++;
+        }
+        try {
+            iksolver->Solve(vparams[index], q0, filteroptions, ikreturns[index]);
+        }
+        catch(const std::exception& ex) {
+            boost::mutex::scoped_lock lockbatch(__mutexBatch);
+            if( __batcherror.size() == 0 ) {
+                __batcherror = ex.what();
+            }
+            break;
+        }
+    }
+}
+
 UserDataPtr IkSolverBase::RegisterCustomFilter(int priority, const IkSolverBase::IkFilterCallbackFn &filterfn)
 {
     CustomIkSolverFilterDataPtr pdata(new CustomIkSolverFilterData(priority,filterfn,shared_iksolver()));
@@ -154,9 +284,16 @@ UserDataPtr IkSolverBase::RegisterCustomFilter(int priority, const IkSolverBase:
         }
     }
     pdata->_iterator = __listRegisteredFilters.insert(it,pdata);
+    ++__nUpdateStamp;
     return pdata;
 }
 
+bool IkSolverBase::SendCommand(std::ostream& os, std::istream& is)
+{
+    ++__nUpdateStamp;
+    return InterfaceBase::SendCommand(os,is);
+}
+
 IkReturnAction IkSolverBase::_CallFilters(std::vector<dReal>& solution, RobotBase::ManipulatorPtr manipulator, const IkParameterization& param, IkReturnPtr filterreturn)
 {
     vector<dReal> vtestsolution,vtestsolution2;
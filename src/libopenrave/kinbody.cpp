@@ -123,6 +123,8 @@ KinBody::KinBody(InterfaceType type, EnvironmentBasePtr penv) : InterfaceBase(ty
     _environmentid = 0;
     _nNonAdjacentLinkCache = 0x80000000;
     _nUpdateStampId = 0;
+    _bFastKinematics = false;
+    _bFastKinematicsEnabled = true;
 }
 
 KinBody::~KinBody()
@@ -161,6 +163,7 @@ void KinBody::Destroy()
     _vClosedLoops.clear();
     _vClosedLoopIndices.clear();
     _vForcedAdjacentLinks.clear();
+    _bFastKinematics = false;
     _nHierarchyComputed = 0;
     _nParametersChanged = 0;
     _pManageData.reset();
@@ -1084,6 +1087,147 @@ void KinBody::GetLinkTransformations(vector<Transform>& vtrans, std::vector<int>
     }
 }
 
+void KinBody::SetFastKinematics(bool bEnable)
+{
+    if( _bFastKinematicsEnabled != bEnable ) {
+        _bFastKinematicsEnabled = bEnable;
+        if( _nHierarchyComputed == 2 ) {
+            _ComputeFastKinematics();
+        }
+    }
+}
+
+bool KinBody::IsFastKinematics() const
+{
+    return _bFastKinematics;
+}
+
+void KinBody::ComputeLinkTransformationsBatch(const std::vector<dReal>& vconfigs, std::vector<Transform>& vlinktransforms, int numthreads)
+{
+    CHECK_INTERNAL_COMPUTATION;
+    int dof = GetDOF();
+    if( dof == 0 ) {
+        OPENRAVE_ASSERT_OP_FORMAT0(vconfigs.size(),==,0,"body has no degrees of freedom",ORE_InvalidArguments);
+        vlinktransforms.resize(0);
+        return;
+    }
+    OPENRAVE_ASSERT_OP_FORMAT((int)(vconfigs.size()%dof),==,0,"configurations size %d is not a multiple of the dof %d", vconfigs.size()%dof, ORE_InvalidArguments);
+    size_t numconfigs = vconfigs.size()/dof;
+    vlinktransforms.resize(numconfigs*_veclinks.size());
+    if( numconfigs == 0 ) {
+        return;
+    }
+    _ComputeLinkTransformationsBatch(&vconfigs[0], numconfigs, &vlinktransforms[0], NULL, 0, numthreads);
+}
+
+void KinBody::ComputeLinkTransformationsBatch(const dReal* pconfigs, size_t numconfigs, dReal* pposes, size_t posestride, int numthreads)
+{
+    CHECK_INTERNAL_COMPUTATION;
+    if( numconfigs == 0 ) {
+        return;
+    }
+    OPENRAVE_ASSERT_OP_FORMAT0(GetDOF(),>,0,"body has no degrees of freedom",ORE_InvalidArguments);
+    OPENRAVE_ASSERT_OP(posestride,>=,7*_veclinks.size());
+    _ComputeLinkTransformationsBatch(pconfigs, numconfigs, NULL, pposes, posestride, numthreads);
+}
+
+void KinBody::_ComputeLinkTransformationsBatch(const dReal* pconfigs, size_t numconfigs, Transform* ptransforms, dReal* pposes, size_t posestride, int numthreads)
+{
+    int dof = GetDOF();
+    size_t numlinks = _veclinks.size();
+    if( !_bFastKinematics ) {
+        // have to go through the general forward kinematics
+        KinBodyStateSaver saver(shared_kinbody(), Save_LinkTransformation);
+        vector<dReal> vvalues(dof);
+        for(size_t iconfig = 0; iconfig < numconfigs; ++iconfig) {
+            std::copy(pconfigs+iconfig*dof, pconfigs+(iconfig+1)*dof, vvalues.begin());
+            SetDOFValues(vvalues, CLA_Nothing);
+            for(size_t ilink = 0; ilink < numlinks; ++ilink) {
+                const Transform& t = _veclinks[ilink]->_t;
+                if( !!ptransforms ) {
+                    ptransforms[iconfig*numlinks+ilink] = t;
+                }
+                else {
+                    dReal* ppose = pposes + iconfig*posestride + 7*ilink;
+                    ppose[0] = t.rot.x; ppose[1] = t.rot.y; ppose[2] = t.rot.z; ppose[3] = t.rot.w;
+                    ppose[4] = t.trans.x; ppose[5] = t.trans.y; ppose[6] = t.trans.z;
+                }
+            }
+        }
+        return;
+    }
+
+    // links not set by any joint keep their current transformation
+    vector<Transform> vinitial(numlinks);
+    for(size_t ilink = 0; ilink < numlinks; ++ilink) {
+        vinitial[ilink] = _veclinks[ilink]->_t;
+    }
+
+    if( numthreads <= 0 ) {
+        numthreads = max(1,(int)boost::thread::hardware_concurrency());
+    }
+    if( find(_vFastKinematicsDOFIndices.begin(), _vFastKinematicsDOFIndices.end(), -1) != _vFastKinematicsDOFIndices.end() ) {
+        // mimic equations share their parser state
+        numthreads = 1;
+    }
+    // do not start threads for a handful of configurations
+    numthreads = min(numthreads, (int)(numconfigs+63)/64);
+    if( numthreads <= 1 ) {
+        _ComputeLinkTransformationsBatchRange(pconfigs, vinitial, ptransforms, pposes, posestride, 0, numconfigs);
+        return;
+    }
+
+    boost::thread_group threads;
+    size_t chunksize = (numconfigs+numthreads-1)/numthreads;
+    for(size_t istart = 0; istart < numconfigs; istart += chunksize) {
+        threads.create_thread(boost::bind(&KinBody::_ComputeLinkTransformationsBatchRange, this, pconfigs, boost::cref(vinitial), ptransforms, pposes, posestride, istart, min(istart+chunksize,numconfigs)));
+    }
+    threads.join_all();
+}
+
+void KinBody::_ComputeLinkTransformationsBatchRange(const dReal* pconfigs, const std::vector<Transform>& vinitial, Transform* ptransforms, dReal* pposes, size_t posestride, size_t istart, size_t iend)
+{
+    int dof = GetDOF();
+    size_t numlinks = _veclinks.size();
+    vector<dReal> vmimicvalues, vmimiceval;
+    // poses are not laid out like Transform, so they are computed in a scratch buffer first
+    vector<Transform> vtransforms;
+    if( !ptransforms ) {
+        vtransforms.resize(numlinks);
+    }
+    for(size_t iconfig = istart; iconfig < iend; ++iconfig) {
+        const dReal* pvalues = pconfigs + iconfig*dof;
+        Transform* pconfigtransforms = !!ptransforms ? ptransforms + iconfig*numlinks : &vtransforms[0];
+        std::copy(vinitial.begin(), vinitial.end(), pconfigtransforms);
+        for(size_t ijoint = 0; ijoint < _vFastKinematicsDOFIndices.size(); ++ijoint) {
+            int dofindex = _vFastKinematicsDOFIndices[ijoint];
+            dReal fvalue = 0;
+            if( dofindex >= 0 ) {
+                fvalue = pvalues[dofindex];
+            }
+            else if( dofindex == -1 ) {
+                Joint& joint = *_vTopologicallySortedJointsAll[ijoint];
+                vmimicvalues.resize(0);
+                FOREACHC(itdof,joint._vmimic[0]->_vdofformat) {
+                    vmimicvalues.push_back(pvalues[itdof->dofindex]);
+                }
+                _EvaluateMimicValue(joint, 0, vmimicvalues, vmimiceval, CLA_Nothing, fvalue);
+            }
+            Transform tlocal;
+            _ComputeFastKinematicsLocalTransform(ijoint, fvalue, tlocal);
+            pconfigtransforms[_vFastKinematicsChildLinks[ijoint]] = pconfigtransforms[_vFastKinematicsParentLinks[ijoint]] * tlocal;
+        }
+        if( !ptransforms ) {
+            dReal* ppose = pposes + iconfig*posestride;
+            FOREACHC(itt, vtransforms) {
+                ppose[0] = itt->rot.x; ppose[1] = itt->rot.y; ppose[2] = itt->rot.z; ppose[3] = itt->rot.w;
+                ppose[4] = itt->trans.x; ppose[5] = itt->trans.y; ppose[6] = itt->trans.z;
+                ppose += 7;
+            }
+        }
+    }
+}
+
 KinBody::JointPtr KinBody::GetJointFromDOFIndex(int dofindex) const
 {
     return _vecjoints.at(_vDOFIndices.at(dofindex));
@@ -1237,12 +1381,11 @@ void KinBody::SetDOFValues(const std::vector<dReal>& vJointValues, uint32_t chec
         }
         dReal* ptempjoints = &_vTempJoints[0];
 
-        // check the limits
-        vector<dReal> upperlim, lowerlim;
+        // check the limits, read them directly from the joints since this is called for every configuration
         FOREACHC(it, _vecjoints) {
             const dReal* p = pJointValues+(*it)->GetDOFIndex();
             OPENRAVE_ASSERT_OP( (*it)->GetDOF(), <=, 3 );
-            (*it)->GetLimits(lowerlim, upperlim);
+            const boost::array<dReal,3>& lowerlim = (*it)->_vlowerlimit, &upperlim = (*it)->_vupperlimit;
             if( (*it)->GetType() == JointSpherical ) {
                 dReal fcurang = fmod(RaveSqrt(p[0]*p[0]+p[1]*p[1]+p[2]*p[2]),2*PI);
                 if( fcurang < lowerlim[0] ) {
@@ -1306,6 +1449,38 @@ void KinBody::SetDOFValues(const std::vector<dReal>& vJointValues, uint32_t chec
         pJointValues = &_vTempJoints[0];
     }
 
+    if( _bFastKinematics ) {
+        for(size_t ijoint = 0; ijoint < _vFastKinematicsDOFIndices.size(); ++ijoint) {
+            int dofindex = _vFastKinematicsDOFIndices[ijoint];
+            Transform tlocal;
+            if( dofindex == -2 ) {
+                // static joint
+                _ComputeFastKinematicsLocalTransform(ijoint, 0, tlocal);
+            }
+            else {
+                Joint& joint = *_vTopologicallySortedJointsAll[ijoint];
+                dReal fvalue = 0;
+                if( dofindex >= 0 ) {
+                    fvalue = pJointValues[dofindex];
+                }
+                else {
+                    // mimic joint that only depends on dofs
+                    _vTempMimicValues.resize(0);
+                    FOREACHC(itdof,joint._vmimic[0]->_vdofformat) {
+                        _vTempMimicValues.push_back(pJointValues[itdof->dofindex]);
+                    }
+                    _EvaluateMimicValue(joint, 0, _vTempMimicValues, _vTempMimicEval, checklimits, fvalue);
+                }
+                _ComputeFastKinematicsLocalTransform(ijoint, fvalue, tlocal);
+                if( _vFastKinematicsRevolute[ijoint] ) {
+                    joint._dofbranches[0] = CountCircularBranches(fvalue-joint._voffsets[0]);
+                }
+            }
+            _veclinks[_vFastKinematicsChildLinks[ijoint]]->_t = _veclinks[_vFastKinematicsParentLinks[ijoint]]->_t * tlocal;
+        }
+        return;
+    }
+
     boost::array<dReal,3> dummyvalues; // dummy values for a joint
     std::vector<dReal> vtempvalues, veval;
 
@@ -1358,81 +1533,7 @@ void KinBody::SetDOFValues(const std::vector<dReal>& vJointValues, uint32_t chec
                             vtempvalues.push_back(vPassiveJointValues.at(itdof->jointindex-_vecjoints.size()).at(itdof->axis));
                         }
                     }
-                    int err = pjoint->_Eval(i, 0, vtempvalues, veval);
-                    if( err ) {
-                        RAVELOG_WARN(str(boost::format("failed to evaluate joint %s, fparser error %d")%pjoint->GetName()%err));
-                    }
-                    else {
-                        vector<dReal> vevalcopy = veval;
-                        vector<dReal>::iterator iteval = veval.begin();
-                        while(iteval != veval.end()) {
-                            bool removevalue = false;
-                            if( pjoint->GetType() == JointSpherical || pjoint->IsCircular(i) ) {
-                            }
-                            else if( *iteval < pjoint->_vlowerlimit[i] ) {
-                                if(*iteval >= pjoint->_vlowerlimit[i]-g_fEpsilonJointLimit ) {
-                                    *iteval = pjoint->_vlowerlimit[i];
-                                }
-                                else {
-                                    removevalue=true;
-                                }
-                            }
-                            else if( *iteval > pjoint->_vupperlimit[i] ) {
-                                if(*iteval <= pjoint->_vupperlimit[i]+g_fEpsilonJointLimit ) {
-                                    *iteval = pjoint->_vupperlimit[i];
-                                }
-                                else {
-                                    removevalue=true;
-                                }
-                            }
-
-                            if( removevalue ) {
-                                iteval = veval.erase(iteval); // invalid value so remove from candidates
-                            }
-                            else {
-                                ++iteval;
-                            }
-                        }
-
-                        if( veval.empty() ) {
-                            FORIT(iteval,vevalcopy) {
-                                if( checklimits == CLA_Nothing || pjoint->GetType() == JointSpherical || pjoint->IsCircular(i) ) {
-                                    veval.push_back(*iteval);
-                                }
-                                else if( *iteval < pjoint->_vlowerlimit[i]-g_fEpsilonEvalJointLimit ) {
-                                    veval.push_back(pjoint->_vlowerlimit[i]);
-                                    if( checklimits == CLA_CheckLimits ) {
-                                        RAVELOG_WARN(str(boost::format("joint %s: lower limit (%e) is not followed: %e")%pjoint->GetName()%pjoint->_vlowerlimit[i]%*iteval));
-                                    }
-                                    else if( checklimits == CLA_CheckLimitsThrow ) {
-                                        throw OPENRAVE_EXCEPTION_FORMAT("joint %s: lower limit (%e) is not followed: %e", pjoint->GetName()%pjoint->_vlowerlimit[i]%*iteval, ORE_InvalidArguments);
-                                    }
-                                }
-                                else if( *iteval > pjoint->_vupperlimit[i]+g_fEpsilonEvalJointLimit ) {
-                                    veval.push_back(pjoint->_vupperlimit[i]);
-                                    if( checklimits == CLA_CheckLimits ) {
-                                        RAVELOG_WARN(str(boost::format("joint %s: upper limit (%e) is not followed: %e")%pjoint->GetName()%pjoint->_vupperlimit[i]%*iteval));
-                                    }
-                                    else if( checklimits == CLA_CheckLimitsThrow ) {
-                                        throw OPENRAVE_EXCEPTION_FORMAT("joint %s: upper limit (%e) is not followed: %e", pjoint->GetName()%pjoint->_vupperlimit[i]%*iteval, ORE_InvalidArguments);
-                                    }
-                                }
-                                else {
-                                    veval.push_back(*iteval);
-                                }
-                            }
-                            OPENRAVE_ASSERT_FORMAT(!veval.empty(), "no valid values for joint %s", pjoint->GetName(),ORE_Assert);
-                        }
-                        if( veval.size() > 1 ) {
-                            stringstream ss; ss << std::setprecision(std::numeric_limits<dReal>::digits10+1);
-                            ss << "multiplie values for joint " << pjoint->GetName() << ": ";
-                            FORIT(iteval,veval) {
-                                ss << *iteval << " ";
-                            }
-                            RAVELOG_WARN(ss.str());
-                        }
-                        dummyvalues[i] = veval.at(0);
-                    }
+                    _EvaluateMimicValue(*pjoint, i, vtempvalues, veval, checklimits, dummyvalues[i]);
 
                     // if joint is passive, update the stored joint values! This is necessary because joint value might be referenced in the future.
                     if( dofindex < 0 ) {
@@ -1536,6 +1637,87 @@ void KinBody::SetDOFValues(const std::vector<dReal>& vJointValues, uint32_t chec
     }
 }
 
+bool KinBody::_EvaluateMimicValue(Joint& joint, int iaxis, const std::vector<dReal>& vdependentvalues, std::vector<dReal>& veval, uint32_t checklimits, dReal& fvalue)
+{
+    int err = joint._Eval(iaxis, 0, vdependentvalues, veval);
+    if( err ) {
+        RAVELOG_WARN(str(boost::format("failed to evaluate joint %s, fparser error %d")%joint.GetName()%err));
+    }
+    else {
+        vector<dReal> vevalcopy = veval;
+        vector<dReal>::iterator iteval = veval.begin();
+        while(iteval != veval.end()) {
+            bool removevalue = false;
+            if( joint.GetType() == JointSpherical || joint.IsCircular(iaxis) ) {
+            }
+            else if( *iteval < joint._vlowerlimit[iaxis] ) {
+                if(*iteval >= joint._vlowerlimit[iaxis]-g_fEpsilonJointLimit ) {
+                    *iteval = joint._vlowerlimit[iaxis];
+                }
+                else {
+                    removevalue=true;
+                }
+            }
+            else if( *iteval > joint._vupperlimit[iaxis] ) {
+                if(*iteval <= joint._vupperlimit[iaxis]+g_fEpsilonJointLimit ) {
+                    *iteval = joint._vupperlimit[iaxis];
+                }
+                else {
+                    removevalue=true;
+                }
+            }
+
+            if( removevalue ) {
+                iteval = veval.erase(iteval); // invalid value so remove from candidates
+            }
+            else {
+                ++iteval;
+            }
+        }
+
+        if( veval.empty() ) {
+            FORIT(iteval,vevalcopy) {
+                if( checklimits == CLA_Nothing || joint.GetType() == JointSpherical || joint.IsCircular(iaxis) ) {
+                    veval.push_back(*iteval);
+                }
+                else if( *iteval < joint._vlowerlimit[iaxis]-g_fEpsilonEvalJointLimit ) {
+                    veval.push_back(joint._vlowerlimit[iaxis]);
+                    if( checklimits == CLA_CheckLimits ) {
+                        RAVELOG_WARN(str(boost::format("joint %s: lower limit (%e) is not followed: %e")%joint.GetName()%joint._vlowerlimit[iaxis]%*iteval));
+                    }
+                    else if( checklimits == CLA_CheckLimitsThrow ) {
+                        throw OPENRAVE_EXCEPTION_FORMAT("joint %s: lower limit (%e) is not followed: %e", joint.GetName()%joint._vlowerlimit[iaxis]%*iteval, ORE_InvalidArguments);
+                    }
+                }
+                else if( *iteval > joint._vupperlimit[iaxis]+g_fEpsilonEvalJointLimit ) {
+                    veval.push_back(joint._vupperlimit[iaxis]);
+                    if( checklimits == CLA_CheckLimits ) {
+                        RAVELOG_WARN(str(boost::format("joint %s: upper limit (%e) is not followed: %e")%joint.GetName()%joint._vupperlimit[iaxis]%*iteval));
+                    }
+                    else if( checklimits == CLA_CheckLimitsThrow ) {
+                        throw OPENRAVE_EXCEPTION_FORMAT("joint %s: upper limit (%e) is not followed: %e", joint.GetName()%joint._vupperlimit[iaxis]%*iteval, ORE_InvalidArguments);
+                    }
+                }
+                else {
+                    veval.push_back(*iteval);
+                }
+            }
+            OPENRAVE_ASSERT_FORMAT(!veval.empty(), "no valid values for joint %s", joint.GetName(),ORE_Assert);
+        }
+        if( veval.size() > 1 ) {
+            stringstream ss; ss << std::setprecision(std::numeric_limits<dReal>::digits10+1);
+            ss << "multiplie values for joint " << joint.GetName() << ": ";
+            FORIT(iteval,veval) {
+                ss << *iteval << " ";
+            }
+            RAVELOG_WARN(ss.str());
+        }
+        fvalue = veval.at(0);
+        return true;
+    }
+    return false;
+}
+
 KinBody::LinkPtr KinBody::GetLink(const std::string& linkname) const
 {
     for(std::vector<LinkPtr>::const_iterator it = _veclinks.begin(); it != _veclinks.end(); ++it) {
@@ -2977,6 +3159,8 @@ void KinBody::_ComputeInternalInformation()
     FOREACH(itlink,_veclinks) {
         (*itlink)->_index = lindex; // always reset, necessary since index cannot be initialized by custom links
         (*itlink)->_vParentLinks.clear();
+        // the readers and Init methods fill _collision directly
+        (*itlink)->_spheretree.Build((*itlink)->_collision);
         if((_veclinks.size() > 1)&&((*itlink)->GetName().size() == 0)) {
             RAVELOG_WARN(str(boost::format("%s link index %d has no name")%GetName()%lindex));
         }
@@ -3761,6 +3945,7 @@ void KinBody::_ComputeInternalInformation()
         }
         _ResetInternalCollisionCache();
     }
+    _ComputeFastKinematics();
     _nHierarchyComputed = 2;
     // because of mimic joints, need to call SetDOFValues at least once, also use this to check for links that are off
     {
@@ -4108,6 +4293,18 @@ void KinBody::Clone(InterfaceBaseConstPtr preference, int cloningoptions)
     _setAdjacentLinks = r->_setAdjacentLinks;
     _vInitialLinkTransformations = r->_vInitialLinkTransformations;
     _vForcedAdjacentLinks = r->_vForcedAdjacentLinks;
+    // the table only stores indices, so it is valid for the cloned joints and links
+    _bFastKinematics = r->_bFastKinematics;
+    _bFastKinematicsEnabled = r->_bFastKinematicsEnabled;
+    _vFastKinematicsRevolute = r->_vFastKinematicsRevolute;
+    _vFastKinematicsDOFIndices = r->_vFastKinematicsDOFIndices;
+    _vFastKinematicsParentLinks = r->_vFastKinematicsParentLinks;
+    _vFastKinematicsChildLinks = r->_vFastKinematicsChildLinks;
+    _vFastKinematicsRot0 = r->_vFastKinematicsRot0;
+    _vFastKinematicsRot1 = r->_vFastKinematicsRot1;
+    _vFastKinematicsTrans0 = r->_vFastKinematicsTrans0;
+    _vFastKinematicsTrans1 = r->_vFastKinematicsTrans1;
+    _vFastKinematicsTrans2 = r->_vFastKinematicsTrans2;
     _vAllPairsShortestPaths = r->_vAllPairsShortestPaths;
     _vClosedLoopIndices = r->_vClosedLoopIndices;
     _vClosedLoops.resize(0); _vClosedLoops.reserve(r->_vClosedLoops.size());
@@ -4153,6 +4350,115 @@ void KinBody::Clone(InterfaceBaseConstPtr preference, int cloningoptions)
     _nUpdateStampId++; // update the stamp instead of copying
 }
 
+void KinBody::_ComputeFastKinematics()
+{
+    _bFastKinematics = false;
+    _vFastKinematicsRevolute.resize(0);
+    _vFastKinematicsDOFIndices.resize(0);
+    _vFastKinematicsParentLinks.resize(0);
+    _vFastKinematicsChildLinks.resize(0);
+    _vFastKinematicsRot0.resize(0);
+    _vFastKinematicsRot1.resize(0);
+    _vFastKinematicsTrans0.resize(0);
+    _vFastKinematicsTrans1.resize(0);
+    _vFastKinematicsTrans2.resize(0);
+    if( !_bFastKinematicsEnabled || _veclinks.size() == 0 ) {
+        return;
+    }
+    vector<uint8_t> vlinkscomputed(_veclinks.size(),0);
+    vlinkscomputed[0] = 1;
+    FOREACHC(itjoint, _vTopologicallySortedJointsAll) {
+        Joint& joint = **itjoint;
+        if( (joint.GetType() != JointRevolute && joint.GetType() != JointPrismatic) || !joint.GetHierarchyChildLink() ) {
+            return;
+        }
+        int dofindex = joint.GetDOFIndex();
+        dReal fstaticvalue = 0;
+        if( joint.IsMimic() ) {
+            FOREACHC(itdof,joint._vmimic[0]->_vdofformat) {
+                if( itdof->dofindex < 0 ) {
+                    // depends on a passive joint
+                    return;
+                }
+            }
+            dofindex = -1;
+        }
+        else if( dofindex < 0 ) {
+            // passive joints are only supported if they cannot move, otherwise their values depend on the link transformations
+            if( !joint.IsStatic() ) {
+                return;
+            }
+            dofindex = -2;
+            fstaticvalue = joint._vlowerlimit[0];
+        }
+        int childindex = joint.GetHierarchyChildLink()->GetIndex();
+        if( vlinkscomputed.at(childindex) ) {
+            // link is set by more than one joint
+            return;
+        }
+        vlinkscomputed[childindex] = 1;
+        const Transform& tleft = joint._tLeftNoOffset, &tright = joint._tRightNoOffset;
+        Vector vaxis = joint._vaxes[0], vright = tright.trans;
+        if( joint.GetType() == JointRevolute ) {
+            dReal faxislength = RaveSqrt(vaxis.lengthsqr3());
+            if( faxislength == 0 ) {
+                return;
+            }
+            vaxis *= 1/faxislength;
+            Vector vparallel = vaxis*vaxis.dot3(vright);
+            Vector vrot0 = quatMultiply(tleft.rot,tright.rot);
+            Vector vrot1 = quatMultiply(quatMultiply(tleft.rot,Vector(0,vaxis.x,vaxis.y,vaxis.z)),tright.rot);
+            Vector vtrans0 = tleft*vparallel, vtrans1 = tleft.rotate(vright-vparallel), vtrans2 = tleft.rotate(vaxis.cross(vright));
+            if( dofindex == -2 ) {
+                vrot0 = vrot0*RaveCos(dReal(0.5)*fstaticvalue) + vrot1*RaveSin(dReal(0.5)*fstaticvalue);
+                vtrans0 += vtrans1*RaveCos(fstaticvalue) + vtrans2*RaveSin(fstaticvalue);
+                joint._dofbranches[0] = CountCircularBranches(fstaticvalue-joint._voffsets[0]);
+            }
+            _vFastKinematicsRevolute.push_back(1);
+            _vFastKinematicsRot0.push_back(vrot0);
+            _vFastKinematicsRot1.push_back(vrot1);
+            _vFastKinematicsTrans0.push_back(vtrans0);
+            _vFastKinematicsTrans1.push_back(vtrans1);
+            _vFastKinematicsTrans2.push_back(vtrans2);
+        }
+        else {
+            Vector vtrans0 = tleft*vright, vtrans1 = tleft.rotate(vaxis);
+            if( dofindex == -2 ) {
+                vtrans0 += vtrans1*fstaticvalue;
+            }
+            _vFastKinematicsRevolute.push_back(0);
+            _vFastKinematicsRot0.push_back(quatMultiply(tleft.rot,tright.rot));
+            _vFastKinematicsRot1.push_back(Vector(0,0,0,0));
+            _vFastKinematicsTrans0.push_back(vtrans0);
+            _vFastKinematicsTrans1.push_back(vtrans1);
+            _vFastKinematicsTrans2.push_back(Vector());
+        }
+        _vFastKinematicsDOFIndices.push_back(dofindex);
+        _vFastKinematicsParentLinks.push_back(!joint.GetHierarchyParentLink() ? 0 : joint.GetHierarchyParentLink()->GetIndex());
+        _vFastKinematicsChildLinks.push_back(childindex);
+    }
+    _bFastKinematics = true;
+}
+
+void KinBody::_ComputeFastKinematicsLocalTransform(size_t ijoint, dReal fvalue, Transform& tlocal) const
+{
+    if( _vFastKinematicsDOFIndices[ijoint] == -2 ) {
+        // static joints have their value baked in
+        tlocal.rot = _vFastKinematicsRot0[ijoint];
+        tlocal.trans = _vFastKinematicsTrans0[ijoint];
+    }
+    else if( _vFastKinematicsRevolute[ijoint] ) {
+        dReal fhalfcos = RaveCos(dReal(0.5)*fvalue), fhalfsin = RaveSin(dReal(0.5)*fvalue);
+        tlocal.rot = _vFastKinematicsRot0[ijoint]*fhalfcos + _vFastKinematicsRot1[ijoint]*fhalfsin;
+        // double angle formulas
+        tlocal.trans = _vFastKinematicsTrans0[ijoint] + _vFastKinematicsTrans1[ijoint]*(fhalfcos*fhalfcos-fhalfsin*fhalfsin) + _vFastKinematicsTrans2[ijoint]*(2*fhalfcos*fhalfsin);
+    }
+    else {
+        tlocal.rot = _vFastKinematicsRot0[ijoint];
+        tlocal.trans = _vFastKinematicsTrans0[ijoint] + _vFastKinematicsTrans1[ijoint]*fvalue;
+    }
+}
+
 void KinBody::_ParametersChanged(int parameters)
 {
     _nUpdateStampId++;
@@ -4167,6 +4473,10 @@ void KinBody::_ParametersChanged(int parameters)
         SetDOFValues(vzeros,Transform(),true);
         _ComputeInternalInformation();
     }
+    else if( (parameters & Prop_JointOffset) == Prop_JointOffset && _nHierarchyComputed == 2 ) {
+        // the offsets are baked into the joint transforms
+        _ComputeFastKinematics();
+    }
     // do not change hash if geometry changed!
     boost::array<int,3> hashproperties = {{Prop_LinkDynamics, Prop_LinkGeometry, Prop_JointMimic }};
     FOREACH(it, hashproperties) {
@@ -380,6 +380,7 @@ void KinBody::Link::_Update()
     FOREACH(itgeom,_vGeometries) {
         _collision.Append((*itgeom)->GetCollisionMesh(),(*itgeom)->GetTransform());
     }
+    _spheretree.Build(_collision);
     GetParent()->_ParametersChanged(Prop_LinkGeometry);
 }
 
@@ -1744,6 +1744,157 @@ std::istream& operator>>(std::istream& I, TriMesh& trimesh)
     return I;
 }
 
+/// \brief orders triangles by the coordinate of their centers along an axis
+class TriangleCenterCompare
+{
+public:
+    TriangleCenterCompare(const std::vector<Vector>& vcenters, int axis) : _vcenters(vcenters), _axis(axis) {
+    }
+    bool operator()(int i, int j) const {
+        return _vcenters[i][_axis] < _vcenters[j][_axis];
+    }
+private:
+    const std::vector<Vector>& _vcenters;
+    int _axis;
+};
+
+static void _BuildSphereTreeNode(SphereTree& tree, int inode, const TriMesh& trimesh, const std::vector<Vector>& vcenters, std::vector<int>& vtriangles, int start, int end, int maxleaftriangles, int depth)
+{
+    Vector vmin, vmax, vcentermin, vcentermax;
+    for(int i = start; i < end; ++i) {
+        for(int j = 0; j < 3; ++j) {
+            const Vector& v = trimesh.vertices.at(trimesh.indices.at(3*vtriangles[i]+j));
+            if( i == start && j == 0 ) {
+                vmin = vmax = v;
+            }
+            else {
+                vmin = Vector(min(vmin.x,v.x),min(vmin.y,v.y),min(vmin.z,v.z));
+                vmax = Vector(max(vmax.x,v.x),max(vmax.y,v.y),max(vmax.z,v.z));
+            }
+        }
+        const Vector& c = vcenters[vtriangles[i]];
+        if( i == start ) {
+            vcentermin = vcentermax = c;
+        }
+        else {
+            vcentermin = Vector(min(vcentermin.x,c.x),min(vcentermin.y,c.y),min(vcentermin.z,c.z));
+            vcentermax = Vector(max(vcentermax.x,c.x),max(vcentermax.y,c.y),max(vcentermax.z,c.z));
+        }
+    }
+    Vector vcenter = (dReal)0.5*(vmin+vmax);
+    dReal fradius2 = 0;
+    for(int i = start; i < end; ++i) {
+        for(int j = 0; j < 3; ++j) {
+            fradius2 = max(fradius2, (trimesh.vertices[trimesh.indices[3*vtriangles[i]+j]]-vcenter).lengthsqr3());
+        }
+    }
+    tree.vcentersx[inode] = vcenter.x;
+    tree.vcentersy[inode] = vcenter.y;
+    tree.vcentersz[inode] = vcenter.z;
+    tree.vradii[inode] = RaveSqrt(fradius2);
+    tree.vchildren[inode] = -1;
+    if( end-start <= maxleaftriangles || depth <= 0 ) {
+        return;
+    }
+
+    Vector vextents = vcentermax-vcentermin;
+    int axis = 0;
+    if( vextents.y > vextents[axis] ) {
+        axis = 1;
+    }
+    if( vextents.z > vextents[axis] ) {
+        axis = 2;
+    }
+    int mid = (start+end)/2;
+    std::nth_element(vtriangles.begin()+start, vtriangles.begin()+mid, vtriangles.begin()+end, TriangleCenterCompare(vcenters,axis));
+    int ichild = (int)tree.vradii.size();
+    tree.vchildren[inode] = ichild;
+    tree.vcentersx.resize(ichild+2);
+    tree.vcentersy.resize(ichild+2);
+    tree.vcentersz.resize(ichild+2);
+    tree.vradii.resize(ichild+2);
+    tree.vchildren.resize(ichild+2);
+    _BuildSphereTreeNode(tree, ichild, trimesh, vcenters, vtriangles, start, mid, maxleaftriangles, depth-1);
+    _BuildSphereTreeNode(tree, ichild+1, trimesh, vcenters, vtriangles, mid, end, maxleaftriangles, depth-1);
+}
+
+void SphereTree::Build(const TriMesh& trimesh, int maxleaftriangles, int maxdepth)
+{
+    Clear();
+    int numtriangles = (int)trimesh.indices.size()/3;
+    if( numtriangles == 0 ) {
+        return;
+    }
+    std::vector<Vector> vcenters(numtriangles);
+    std::vector<int> vtriangles(numtriangles);
+    for(int i = 0; i < numtriangles; ++i) {
+        vcenters[i] = (trimesh.vertices.at(trimesh.indices[3*i])+trimesh.vertices.at(trimesh.indices[3*i+1])+trimesh.vertices.at(trimesh.indices[3*i+2]))*(dReal(1)/3);
+        vtriangles[i] = i;
+    }
+    vcentersx.resize(1);
+    vcentersy.resize(1);
+    vcentersz.resize(1);
+    vradii.resize(1);
+    vchildren.resize(1);
+    _BuildSphereTreeNode(*this, 0, trimesh, vcenters, vtriangles, 0, numtriangles, max(1,maxleaftriangles), maxdepth);
+}
+
+void SphereTree::Clear()
+{
+    vcentersx.resize(0);
+    vcentersy.resize(0);
+    vcentersz.resize(0);
+    vradii.resize(0);
+    vchildren.resize(0);
+}
+
+const int SphereTree::s_nMaxOverlapTests;
+
+bool SphereTree::Overlaps(const TransformMatrix& t, const SphereTree& other, const TransformMatrix& tother, int maxtests) const
+{
+    if( IsEmpty() || other.IsEmpty() ) {
+        return false;
+    }
+    // work in the coordinate system of this tree
+    TransformMatrix trel = t.inverse()*tother;
+    // every test pushes at most two pairs and pops one, so the stack never holds more than maxtests+1 pairs
+    int stack[2*(s_nMaxOverlapTests+1)];
+    int stacksize = 2;
+    stack[0] = stack[1] = 0;
+    maxtests = min(maxtests, s_nMaxOverlapTests);
+    for(int itest = 0; stacksize > 0; ++itest) {
+        if( itest >= maxtests ) {
+            // too many spheres overlap, let the caller check the meshes
+            return true;
+        }
+        stacksize -= 2;
+        int i = stack[stacksize], j = stack[stacksize+1];
+        dReal x = other.vcentersx[j], y = other.vcentersy[j], z = other.vcentersz[j];
+        dReal dx = trel.m[0]*x + trel.m[1]*y + trel.m[2]*z + trel.trans.x - vcentersx[i];
+        dReal dy = trel.m[4]*x + trel.m[5]*y + trel.m[6]*z + trel.trans.y - vcentersy[i];
+        dReal dz = trel.m[8]*x + trel.m[9]*y + trel.m[10]*z + trel.trans.z - vcentersz[i];
+        // the margin keeps round-off of the relative transform from rejecting spheres that just touch
+        dReal fradius = vradii[i] + other.vradii[j] + g_fEpsilonLinear;
+        if( dx*dx + dy*dy + dz*dz > fradius*fradius ) {
+            continue;
+        }
+        int ichild = vchildren[i], jchild = other.vchildren[j];
+        if( ichild < 0 && jchild < 0 ) {
+            return true;
+        }
+        // descend into the larger sphere
+        if( jchild < 0 || (ichild >= 0 && vradii[i] >= other.vradii[j]) ) {
+            stack[stacksize++] = ichild; stack[stacksize++] = j;
+            stack[stacksize++] = ichild+1; stack[stacksize++] = j;
+        }
+        else {
+            stack[stacksize++] = i; stack[stacksize++] = jchild;
+            stack[stacksize++] = i; stack[stacksize++] = jchild+1;
+        }
+    }
+    return false;
+}
+
 
 // Dummy Reader
 DummyXMLReader::DummyXMLReader(const std::string& fieldname, const std::string& pparentname, boost::shared_ptr<std::ostream> osrecord) : _fieldname(fieldname), _osrecord(osrecord)
@@ -1834,6 +1985,77 @@ bool SensorBase::CameraSensorData::serialize(std::ostream& O) const
     return true;
 }
 
+int CollisionCheckerBase::CheckCollisionRays(const std::vector<RAY>& vrays, KinBodyConstPtr pbody, std::vector<dReal>& vhitdistances, std::vector<Vector>& vhitnormals, std::vector<KinBody::LinkConstPtr>& vhitlinks)
+{
+    vhitdistances.resize(vrays.size());
+    vhitnormals.resize(vrays.size());
+    vhitlinks.resize(0);
+    vhitlinks.resize(vrays.size());
+    // some checkers only compute the hit distance with CO_Distance
+    CollisionOptionsStateSaver optionsaver(shared_collisionchecker(),GetCollisionOptions()|CO_Distance,false);
+    CollisionReportPtr report(new CollisionReport());
+    int numhits = 0;
+    for(size_t i = 0; i < vrays.size(); ++i) {
+        bool bCollision = !pbody ? CheckCollision(vrays[i],report) : CheckCollision(vrays[i],pbody,report);
+        if( bCollision ) {
+            vhitdistances[i] = report->minDistance;
+            vhitnormals[i] = report->contacts.size() > 0 ? report->contacts[0].norm : Vector();
+            vhitlinks[i] = !!report->plink1 ? report->plink1 : report->plink2;
+            ++numhits;
+        }
+        else {
+            vhitdistances[i] = -1;
+            vhitnormals[i] = Vector();
+        }
+    }
+    return numhits;
+}
+
+void CollisionCheckerBase::_ValidateCollisionBatch(KinBodyConstPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& vconfigs, size_t& dof, size_t& numconfigs) const
+{
+    FOREACHC(itindex, dofindices) {
+        if( *itindex < 0 || *itindex >= pbody->GetDOF() ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("dof index %d is out of range [0,%d) for body %s", *itindex%pbody->GetDOF()%pbody->GetName(), ORE_InvalidArguments);
+        }
+    }
+    dof = dofindices.size() > 0 ? dofindices.size() : (size_t)pbody->GetDOF();
+    if( dof == 0 || (vconfigs.size()%dof) != 0 ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("configurations size %d is not a multiple of dof %d", vconfigs.size()%dof, ORE_InvalidArguments);
+    }
+    numconfigs = vconfigs.size()/dof;
+}
+
+int CollisionCheckerBase::CheckCollisionBatch(KinBodyPtr pbody, const std::vector<int>& dofindices, const std::vector<dReal>& vconfigs, std::vector<uint8_t>& vcollisions, int batchoptions, CollisionReportPtr report)
+{
+    size_t dof, numconfigs;
+    _ValidateCollisionBatch(pbody, dofindices, vconfigs, dof, numconfigs);
+    vcollisions.resize(0);
+    vcollisions.reserve(numconfigs);
+    KinBody::KinBodyStateSaver saver(pbody);
+    std::vector<dReal> vvalues(dof);
+    CollisionReportPtr reportcur = report;
+    for(size_t i = 0; i < numconfigs; ++i) {
+        std::copy(vconfigs.begin()+i*dof,vconfigs.begin()+(i+1)*dof,vvalues.begin());
+        pbody->SetDOFValues(vvalues,KinBody::CLA_Nothing,dofindices);
+        bool bCollision = false;
+        if( (batchoptions & CBO_CheckEnv) && CheckCollision(KinBodyConstPtr(pbody),reportcur) ) {
+            bCollision = true;
+        }
+        else if( (batchoptions & CBO_CheckSelf) && pbody->CheckSelfCollision(reportcur) ) {
+            bCollision = true;
+        }
+        vcollisions.push_back(bCollision);
+        if( bCollision ) {
+            if( batchoptions & CBO_StopAtFirstCollision ) {
+                break;
+            }
+            // only the first colliding configuration is reported
+            reportcur.reset();
+        }
+    }
+    return (int)vcollisions.size();
+}
+
 CollisionOptionsStateSaver::CollisionOptionsStateSaver(CollisionCheckerBasePtr p, int newoptions, bool required)
 {
     _oldoptions = p->GetCollisionOptions();
@@ -411,6 +411,30 @@ namespace LocalXML
 bool ParseXMLData(BaseXMLReaderPtr preader, const char* buffer, int size);
 }
 
+/// \brief fixed size part of the trajectory binary format written by \ref TrajectoryBase::serialize
+struct BinaryTrajectoryHeader
+{
+    static const size_t s_nSize = 32;
+    static const uint16_t s_nVersion = 1;
+    static const uint8_t s_nFlagCompressed = 1;
+
+    /// \brief parses s_nSize bytes, throws if the data is not a binary trajectory
+    void Read(const char* pbuffer);
+    void Write(std::ostream& O) const;
+
+    /// \brief offset of the waypoint block from the start of the header
+    inline size_t GetDataOffset() const {
+        return (s_nSize+speclength+descriptionlength+7)&~(size_t)7;
+    }
+
+    uint16_t version;
+    uint8_t realsize; ///< size of the stored floating-point values
+    uint8_t flags;
+    uint32_t speclength, descriptionlength;
+    uint64_t numwaypoints;
+    uint64_t datalength; ///< bytes in the waypoint block
+};
+
 #ifdef _WIN32
 inline const char *strcasestr(const char *s, const char *find)
 {
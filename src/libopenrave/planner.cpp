@@ -84,7 +84,7 @@ void PlannerBase::PlannerParameters::StateSaver::_Restore()
     _params->_setstatefn(_values);
 }
 
-PlannerBase::PlannerParameters::PlannerParameters() : XMLReadable("plannerparameters"), _fStepLength(0.04f), _nMaxIterations(0), _sPostProcessingPlanner("shortcut_linear")
+PlannerBase::PlannerParameters::PlannerParameters() : XMLReadable("plannerparameters"), _fStepLength(0.04f), _nMaxIterations(0), _bContinuousCheck(false), _sPostProcessingPlanner("shortcut_linear")
 {
     _diffstatefn = subtractstates;
     _neighstatefn = addstates;
@@ -101,6 +101,7 @@ PlannerBase::PlannerParameters::PlannerParameters() : XMLReadable("plannerparame
     _vXMLParameters.push_back("_vconfigresolution");
     _vXMLParameters.push_back("_nmaxiterations");
     _vXMLParameters.push_back("_fsteplength");
+    _vXMLParameters.push_back("_bcontinuouscheck");
     _vXMLParameters.push_back("_postprocessing");
 }
 
@@ -138,6 +139,7 @@ PlannerBase::PlannerParameters& PlannerBase::PlannerParameters::operator=(const
     _sExtraParameters.resize(0);
     _nMaxIterations = 0;
     _fStepLength = 0.04f;
+    _bContinuousCheck = false;
     _plannerparametersdepth = 0;
 
     // transfer data
@@ -194,6 +196,7 @@ bool PlannerBase::PlannerParameters::serialize(std::ostream& O) const
 
     O << "<_nmaxiterations>" << _nMaxIterations << "</_nmaxiterations>" << endl;
     O << "<_fsteplength>" << _fStepLength << "</_fsteplength>" << endl;
+    O << "<_bcontinuouscheck>" << _bContinuousCheck << "</_bcontinuouscheck>" << endl;
     O << "<_postprocessing planner=\"" << _sPostProcessingPlanner << "\">" << _sPostProcessingParameters << "</_postprocessing>" << endl;
     O << _sExtraParameters << endl;
     return !!O;
@@ -246,7 +249,7 @@ BaseXMLReader::ProcessElement PlannerBase::PlannerParameters::startElement(const
         return PE_Support;
     }
 
-    static const boost::array<std::string,10> names = {{"_vinitialconfig","_vgoalconfig","_vconfiglowerlimit","_vconfigupperlimit","_vconfigvelocitylimit","_vconfigaccelerationlimit","_vconfigresolution","_nmaxiterations","_fsteplength","_postprocessing"}};
+    static const boost::array<std::string,11> names = {{"_vinitialconfig","_vgoalconfig","_vconfiglowerlimit","_vconfigupperlimit","_vconfigvelocitylimit","_vconfigaccelerationlimit","_vconfigresolution","_nmaxiterations","_fsteplength","_bcontinuouscheck","_postprocessing"}};
     if( find(names.begin(),names.end(),name) != names.end() ) {
         __processingtag = name;
         return PE_Support;
@@ -304,6 +307,9 @@ bool PlannerBase::PlannerParameters::endElement(const std::string& name)
         else if( name == "_fsteplength") {
             _ss >> _fStepLength;
         }
+        else if( name == "_bcontinuouscheck") {
+            _ss >> _bContinuousCheck;
+        }
         if( name !=__processingtag ) {
             RAVELOG_WARN(str(boost::format("invalid tag %s!=%s\n")%name%__processingtag));
         }
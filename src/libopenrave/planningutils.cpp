@@ -224,14 +224,21 @@ public:
 
             if( trajectory->GetDuration() > 0 && samplingstep > 0 ) {
                 // use sampling and check segment constraints
-                std::vector<dReal> vprevdata, vprevdatavel;
+                std::vector<dReal> vprevdata, vtimes, vsampleddata;
                 PlannerBase::ConfigurationListPtr configs(new PlannerBase::ConfigurationList());
-                trajectory->Sample(vprevdata,0,_parameters->_configurationspecification);
-                trajectory->Sample(vprevdatavel,0,velspec);
+                // sample all the points at once, much faster than calling Sample for each time
+                vtimes.push_back(0);
+                for(dReal ftime = 0; ftime < trajectory->GetDuration(); ftime += samplingstep ) {
+                    vtimes.push_back(ftime+samplingstep);
+                }
+                trajectory->SamplePoints(vsampleddata,vtimes,_parameters->_configurationspecification);
+                std::vector<dReal>::const_iterator itsample = vsampleddata.begin();
+                vprevdata.assign(itsample,itsample+_parameters->GetDOF());
+                vdata.resize(_parameters->GetDOF());
                 for(dReal ftime = 0; ftime < trajectory->GetDuration(); ftime += samplingstep ) {
                     configs->clear();
-                    trajectory->Sample(vdata,ftime+samplingstep,_parameters->_configurationspecification);
-                    trajectory->Sample(vdatavel,ftime+samplingstep,velspec);
+                    itsample += _parameters->GetDOF();
+                    std::copy(itsample,itsample+_parameters->GetDOF(),vdata.begin());
                     vdiff = vdata;
                     _parameters->_diffstatefn(vdiff,vprevdata);
                     for(size_t i = 0; i < _parameters->_vConfigVelocityLimit.size(); ++i) {
@@ -261,7 +268,6 @@ public:
                         itprevconfig=itcurconfig;
                     }
                     vprevdata=vdata;
-                    vprevdatavel=vdatavel;
                 }
             }
             else {
@@ -1059,6 +1065,40 @@ TrajectoryBasePtr MergeTrajectories(const std::list<TrajectoryBaseConstPtr>& lis
     return presulttraj;
 }
 
+const dReal* GetBinaryTrajectoryWaypoints(const void* pbuffer, size_t buffersize, ConfigurationSpecification& spec, size_t& numwaypoints, std::string* pdescription)
+{
+    const char* p = static_cast<const char*>(pbuffer);
+    if( buffersize < BinaryTrajectoryHeader::s_nSize ) {
+        throw OPENRAVE_EXCEPTION_FORMAT0("binary trajectory header is truncated",ORE_InvalidArguments);
+    }
+    BinaryTrajectoryHeader header;
+    header.Read(p);
+    if( header.flags & BinaryTrajectoryHeader::s_nFlagCompressed ) {
+        throw OPENRAVE_EXCEPTION_FORMAT0("compressed trajectories cannot be read in-place, use TrajectoryBase::deserialize",ORE_InvalidArguments);
+    }
+    const uint16_t endiantest = 1;
+    if( header.realsize != sizeof(dReal) || *reinterpret_cast<const uint8_t*>(&endiantest) != 1 ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory real size %d does not match the native dReal, use TrajectoryBase::deserialize",(int)header.realsize,ORE_InvalidArguments);
+    }
+    if( buffersize < header.GetDataOffset() || buffersize-header.GetDataOffset() < header.datalength ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory needs %d bytes, but buffer has %d",(header.GetDataOffset()+header.datalength)%buffersize,ORE_InvalidArguments);
+    }
+    if( (reinterpret_cast<size_t>(p)%sizeof(dReal)) != 0 ) {
+        throw OPENRAVE_EXCEPTION_FORMAT0("binary trajectory buffer is not aligned",ORE_InvalidArguments);
+    }
+    stringstream ssspec(std::string(p+BinaryTrajectoryHeader::s_nSize,header.speclength));
+    ssspec >> spec;
+    // numwaypoints is bounded by datalength first so that the product cannot overflow
+    if( header.numwaypoints > header.datalength || header.datalength != header.numwaypoints*spec.GetDOF()*sizeof(dReal) ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory data has %d bytes, expected %d",header.datalength%(header.numwaypoints*spec.GetDOF()*sizeof(dReal)),ORE_InvalidArguments);
+    }
+    if( !!pdescription ) {
+        pdescription->assign(p+BinaryTrajectoryHeader::s_nSize+header.speclength,header.descriptionlength);
+    }
+    numwaypoints = header.numwaypoints;
+    return reinterpret_cast<const dReal*>(p+header.GetDataOffset());
+}
+
 void GetDHParameters(std::vector<DHParameter>& vparameters, KinBodyConstPtr pbody)
 {
     EnvironmentMutex::scoped_lock lockenv(pbody->GetEnv()->GetMutex());
@@ -1130,12 +1170,12 @@ void GetDHParameters(std::vector<DHParameter>& vparameters, KinBodyConstPtr pbod
     }
 }
 
-LineCollisionConstraint::LineCollisionConstraint() : _bCheckEnv(true)
+LineCollisionConstraint::LineCollisionConstraint() : _bCheckEnv(true), _bContinuousCheck(false), _bContinuousUnsupported(false)
 {
     _report.reset(new CollisionReport());
 }
 
-LineCollisionConstraint::LineCollisionConstraint(const std::list<KinBodyPtr>& listCheckCollisions, bool bCheckEnv) : _listCheckSelfCollisions(listCheckCollisions), _bCheckEnv(bCheckEnv)
+LineCollisionConstraint::LineCollisionConstraint(const std::list<KinBodyPtr>& listCheckCollisions, bool bCheckEnv) : _listCheckSelfCollisions(listCheckCollisions), _bCheckEnv(bCheckEnv), _bContinuousCheck(false), _bContinuousUnsupported(false)
 {
     _report.reset(new CollisionReport());
 }
@@ -1145,6 +1185,76 @@ void LineCollisionConstraint::SetUserCheckFunction(const boost::function<bool()
     _usercheckfns[bCallAfterCheckCollision] = usercheckfn;
 }
 
+void LineCollisionConstraint::SetContinuousCheck(bool bContinuousCheck)
+{
+    _bContinuousCheck = bContinuousCheck;
+}
+
+int LineCollisionConstraint::_CheckContinuous(PlannerBase::PlannerParametersPtr params, const std::vector<dReal>& pQ0, const std::vector<dReal>& pQ1, IntervalType interval)
+{
+    if( _listCheckSelfCollisions.size() != 1 || !_bCheckEnv || !!_usercheckfns[0] || !!_usercheckfns[1] ) {
+        return -1;
+    }
+    KinBodyPtr pbody = _listCheckSelfCollisions.front();
+    const ConfigurationSpecification& spec = params->_configurationspecification;
+    if( spec._vgroups.size() != 1 || spec._vgroups[0].dof != params->GetDOF() ) {
+        return -1;
+    }
+    stringstream ss(spec._vgroups[0].name);
+    string grouptype, bodyname;
+    ss >> grouptype >> bodyname;
+    if( grouptype != "joint_values" || bodyname != pbody->GetName() ) {
+        return -1;
+    }
+    _vcontinuousdofindices.resize(0);
+    int dofindex;
+    while( ss >> dofindex ) {
+        _vcontinuousdofindices.push_back(dofindex);
+    }
+    if( (int)_vcontinuousdofindices.size() != params->GetDOF() ) {
+        return -1;
+    }
+
+    // unwrap circular joints so that linear interpolation follows the same path as the planner
+    dQ = pQ1;
+    params->_diffstatefn(dQ,pQ0);
+    _vtempconfig.resize(pQ0.size());
+    for(size_t i = 0; i < pQ0.size(); ++i) {
+        _vtempconfig[i] = pQ0[i] + dQ[i];
+    }
+    try {
+        if( !pbody->GetEnv()->GetCollisionChecker()->CheckContinuousCollision(pbody, _vcontinuousdofindices, pQ0, _vtempconfig, _report) ) {
+            return 0;
+        }
+        // the continuous check always includes both ends, so let the discretization skip the open ends if one of them is colliding
+        if( interval == IT_Open || interval == IT_OpenStart ) {
+            params->_setstatefn(pQ0);
+            if( !_CheckState() ) {
+                return -1;
+            }
+        }
+        if( interval == IT_Open || interval == IT_OpenEnd ) {
+            params->_setstatefn(pQ1);
+            if( !_CheckState() ) {
+                return -1;
+            }
+        }
+        return 1;
+    }
+    catch(const openrave_exception& ex) {
+        if( ex.GetCode() == ORE_Timeout ) {
+            RAVELOG_VERBOSE(str(boost::format("discretizing segment: %s")%ex.what()));
+            return -1;
+        }
+        if( ex.GetCode() != ORE_NotImplemented ) {
+            throw;
+        }
+        RAVELOG_DEBUG(str(boost::format("disabling continuous collision checking: %s")%ex.what()));
+        _bContinuousUnsupported = true;
+    }
+    return -1;
+}
+
 bool LineCollisionConstraint::_CheckState()
 {
     if( !!_usercheckfns[0] ) {
@@ -1310,6 +1420,18 @@ bool LineCollisionConstraint::Check(PlannerBase::PlannerParametersWeakPtr _param
         BOOST_ASSERT(0);
     }
 
+    if( (_bContinuousCheck || params->_bContinuousCheck) && !_bContinuousUnsupported ) {
+        int ret = _CheckContinuous(params, pQ0, pQ1, interval);
+        if( ret > 0 ) {
+            RAVELOG_VERBOSE(str(boost::format("collision: %s")%_report->__str__()));
+            return false;
+        }
+        if( ret == 0 && !pvCheckedConfigurations ) {
+            return true;
+        }
+        // the discretization still has to fill the checked configurations
+    }
+
     // first make sure the end is free
     _vtempconfig.resize(params->GetDOF());
     if (bCheckEnd) {
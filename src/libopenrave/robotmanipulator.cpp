@@ -18,6 +18,133 @@
 
 namespace OpenRAVE {
 
+/// \brief results of FindIKSolution indexed by the quantized goal, see \ref RobotBase::Manipulator::SetIkCache
+class RobotBase::Manipulator::IkSolutionCache
+{
+public:
+    IkSolutionCache(dReal fresolution, size_t maxentries) : _fresolution(fresolution), _maxentries(maxentries), _numhits(0), _nummisses(0), _numinvalidations(0), _nvalidiksolverstamp(0), _nvalidcheckeroptions(0) {
+    }
+
+    /// \brief clears the entries if anything other than the arm joints changed since the last call
+    void Validate(RobotBasePtr probot, const std::vector<int>& varmdofindices, IkSolverBasePtr iksolver)
+    {
+        // the solver, its filters and settings, and the collision checker used by the filters also decide the solutions
+        CollisionCheckerBasePtr pchecker = probot->GetEnv()->GetCollisionChecker();
+        int checkeroptions = !!pchecker ? pchecker->GetCollisionOptions() : 0;
+        bool bsolverchanged = iksolver != _pvalidiksolver.lock() || iksolver->GetUpdateStamp() != _nvalidiksolverstamp || pchecker != _pvalidchecker.lock() || checkeroptions != _nvalidcheckeroptions;
+        // the update stamps of the robot and its grabbed bodies change with the arm, so their geometry is tracked with the kinematics/geometry hash and enabled links
+        _vbodystamps.resize(0);
+        _vhashes.resize(0);
+        _vhashes.push_back(probot->GetKinematicsGeometryHash());
+        probot->GetDOFValues(_vrobotstate);
+        FOREACHC(it, varmdofindices) {
+            _vrobotstate.at(*it) = 0;
+        }
+        _PushTransform(probot->GetTransform());
+        FOREACHC(itlink, probot->GetLinks()) {
+            _vrobotstate.push_back((*itlink)->IsEnabled());
+        }
+        // every body in the environment except for the robot, grabbed bodies move along with the arm
+        probot->GetEnv()->GetBodies(_vbodies);
+        FOREACHC(itbody, _vbodies) {
+            if( *itbody == probot ) {
+                continue;
+            }
+            KinBody::LinkPtr pgrabbinglink = probot->IsGrabbing(*itbody);
+            if( !!pgrabbinglink ) {
+                _vbodystamps.push_back(std::make_pair((*itbody)->GetEnvironmentId(),-1));
+                _vhashes.push_back((*itbody)->GetKinematicsGeometryHash());
+                _vrobotstate.push_back(pgrabbinglink->GetIndex());
+                _PushTransform(pgrabbinglink->GetTransform().inverse() * (*itbody)->GetTransform());
+                FOREACHC(itlink, (*itbody)->GetLinks()) {
+                    _vrobotstate.push_back((*itlink)->IsEnabled());
+                }
+            }
+            else {
+                _vbodystamps.push_back(std::make_pair((*itbody)->GetEnvironmentId(),(*itbody)->GetUpdateStamp()));
+            }
+        }
+        _vbodies.resize(0);
+        // joint values that are read back can drift by round-off when other joints are set, so compare with a tolerance
+        bool bstatechanged = _vrobotstate.size() != _vvalidrobotstate.size();
+        for(size_t i = 0; i < _vrobotstate.size() && !bstatechanged; ++i) {
+            bstatechanged = RaveFabs(_vrobotstate[i]-_vvalidrobotstate[i]) > g_fEpsilonLinear;
+        }
+        if( _vbodystamps != _vvalidbodystamps || _vhashes != _vvalidhashes || bstatechanged || bsolverchanged ) {
+            if( _mapentries.size() > 0 ) {
+                _mapentries.clear();
+                ++_numinvalidations;
+            }
+            _vvalidbodystamps.swap(_vbodystamps);
+            _vvalidhashes.swap(_vhashes);
+            _vvalidrobotstate.swap(_vrobotstate);
+            _pvalidiksolver = iksolver;
+            _nvalidiksolverstamp = iksolver->GetUpdateStamp();
+            _pvalidchecker = pchecker;
+            _nvalidcheckeroptions = checkeroptions;
+        }
+    }
+
+    void GetKey(const IkParameterization& localgoal, const std::vector<dReal>& vFreeParameters, int filteroptions, bool bikreturn, std::vector<int64_t>& vkey)
+    {
+        _vvalues.resize(localgoal.GetNumberOfValues());
+        localgoal.GetValues(_vvalues.begin());
+        _vvalues.insert(_vvalues.end(), vFreeParameters.begin(), vFreeParameters.end());
+        vkey.resize(0);
+        vkey.push_back(localgoal.GetType());
+        vkey.push_back(filteroptions);
+        vkey.push_back(bikreturn);
+        FOREACHC(it, _vvalues) {
+            vkey.push_back((int64_t)floor(*it/_fresolution+0.5));
+        }
+    }
+
+    IkReturnPtr Find(const std::vector<int64_t>& vkey)
+    {
+        std::map<std::vector<int64_t>, IkReturnPtr>::iterator it = _mapentries.find(vkey);
+        if( it == _mapentries.end() ) {
+            ++_nummisses;
+            return IkReturnPtr();
+        }
+        ++_numhits;
+        return it->second;
+    }
+
+    void Insert(const std::vector<int64_t>& vkey, IkReturnPtr ikreturn)
+    {
+        if( _mapentries.size() >= _maxentries ) {
+            _mapentries.clear();
+        }
+        _mapentries[vkey] = ikreturn;
+    }
+
+    void Clear() {
+        _mapentries.clear();
+    }
+
+    dReal _fresolution;
+    size_t _maxentries;
+    uint64_t _numhits, _nummisses, _numinvalidations;
+    std::map<std::vector<int64_t>, IkReturnPtr> _mapentries;
+
+private:
+    void _PushTransform(const Transform& t)
+    {
+        _vrobotstate.push_back(t.rot.x); _vrobotstate.push_back(t.rot.y); _vrobotstate.push_back(t.rot.z); _vrobotstate.push_back(t.rot.w);
+        _vrobotstate.push_back(t.trans.x); _vrobotstate.push_back(t.trans.y); _vrobotstate.push_back(t.trans.z);
+    }
+
+    std::vector< std::pair<int,int> > _vvalidbodystamps, _vbodystamps; ///< (environment id, update stamp) of the bodies
+    std::vector<std::string> _vvalidhashes, _vhashes; ///< kinematics/geometry hashes of the robot and its grabbed bodies
+    std::vector<dReal> _vvalidrobotstate, _vrobotstate; ///< dof values with the arm zeroed, the robot transform, enabled links and the grabbed bodies relative to their links
+    IkSolverBaseWeakPtr _pvalidiksolver;
+    int _nvalidiksolverstamp; ///< \see IkSolverBase::GetUpdateStamp
+    CollisionCheckerBaseWeakPtr _pvalidchecker;
+    int _nvalidcheckeroptions;
+    std::vector<KinBodyPtr> _vbodies;
+    std::vector<dReal> _vvalues;
+};
+
 RobotBase::Manipulator::Manipulator(RobotBasePtr probot, const RobotBase::ManipulatorInfo& info) : _info(info), __probot(probot) {
 }
 RobotBase::Manipulator::~Manipulator() {
@@ -27,6 +154,7 @@ RobotBase::Manipulator::Manipulator(const RobotBase::Manipulator& r)
 {
     *this = r;
     __pIkSolver.reset();
+    __pIkCache.reset();
     if( _info._sIkSolverXMLId.size() > 0 ) {
         __pIkSolver = RaveCreateIkSolver(GetRobot()->GetEnv(), _info._sIkSolverXMLId);
     }
@@ -43,6 +171,7 @@ RobotBase::Manipulator::Manipulator(RobotBasePtr probot, boost::shared_ptr<Robot
         __pEffector = probot->GetLinks().at(r->GetEndEffector()->GetIndex());
     }
     __pIkSolver.reset(); // will be initialized when needed
+    __pIkCache.reset();
 //    if( _info._sIkSolverXMLId.size() > 0 ) {
 //        //__pIkSolver = RaveCreateIkSolver(probot->GetEnv(), _info._sIkSolverXMLId);
 //        // cannot call __pIkSolver->Init since this is the constructor...
@@ -53,6 +182,9 @@ void RobotBase::Manipulator::SetLocalToolTransform(const Transform& t)
 {
     _info._sIkSolverXMLId.resize(0);
     __pIkSolver.reset();
+    if( !!__pIkCache ) {
+        __pIkCache->Clear();
+    }
     _info._tLocalTool = t;
     GetRobot()->_ParametersChanged(Prop_RobotManipulatorTool);
     __hashkinematicsstructure.resize(0);
@@ -120,6 +252,9 @@ bool RobotBase::Manipulator::SetIkSolver(IkSolverBasePtr iksolver)
     }
     if( iksolver->Init(shared_from_this()) ) {
         __pIkSolver = iksolver;
+        if( !!__pIkCache ) {
+            __pIkCache->Clear();
+        }
         _info._sIkSolverXMLId = iksolver->GetXMLId();
         GetRobot()->_ParametersChanged(Prop_RobotManipulatorSolver);
         return true;
@@ -151,8 +286,29 @@ bool RobotBase::Manipulator::FindIKSolution(const IkParameterization& goal, cons
     else {
         localgoal=goal;
     }
+    std::vector<int64_t> vcachekey;
+    if( !!__pIkCache ) {
+        __pIkCache->Validate(probot, __varmdofindices, pIkSolver);
+        __pIkCache->GetKey(localgoal, vFreeParameters, filteroptions, false, vcachekey);
+        IkReturnPtr pcached = __pIkCache->Find(vcachekey);
+        if( !!pcached ) {
+            if( pcached->_action == IKRA_Success ) {
+                solution = pcached->_vsolution;
+                return true;
+            }
+            return false;
+        }
+    }
     boost::shared_ptr< vector<dReal> > psolution(&solution, utils::null_deleter());
-    return vFreeParameters.size() == 0 ? pIkSolver->Solve(localgoal, solution, filteroptions, psolution) : pIkSolver->Solve(localgoal, solution, vFreeParameters, filteroptions, psolution);
+    bool bsuccess = vFreeParameters.size() == 0 ? pIkSolver->Solve(localgoal, solution, filteroptions, psolution) : pIkSolver->Solve(localgoal, solution, vFreeParameters, filteroptions, psolution);
+    if( !!__pIkCache ) {
+        IkReturnPtr pentry(new IkReturn(bsuccess ? IKRA_Success : IKRA_Reject));
+        if( bsuccess ) {
+            pentry->_vsolution = solution;
+        }
+        __pIkCache->Insert(vcachekey, pentry);
+    }
+    return bsuccess;
 }
 
 bool RobotBase::Manipulator::FindIKSolutions(const IkParameterization& goal, std::vector<std::vector<dReal> >& solutions, int filteroptions) const
@@ -199,7 +355,27 @@ bool RobotBase::Manipulator::FindIKSolution(const IkParameterization& goal, cons
     else {
         localgoal=goal;
     }
-    return vFreeParameters.size() == 0 ? pIkSolver->Solve(localgoal, solution, filteroptions, ikreturn) : pIkSolver->Solve(localgoal, solution, vFreeParameters, filteroptions, ikreturn);
+    std::vector<int64_t> vcachekey;
+    if( !!__pIkCache ) {
+        __pIkCache->Validate(probot, __varmdofindices, pIkSolver);
+        __pIkCache->GetKey(localgoal, vFreeParameters, filteroptions, !!ikreturn, vcachekey);
+        IkReturnPtr pcached = __pIkCache->Find(vcachekey);
+        if( !!pcached ) {
+            if( !!ikreturn ) {
+                *ikreturn = *pcached;
+            }
+            return pcached->_action == IKRA_Success;
+        }
+    }
+    bool bsuccess = vFreeParameters.size() == 0 ? pIkSolver->Solve(localgoal, solution, filteroptions, ikreturn) : pIkSolver->Solve(localgoal, solution, vFreeParameters, filteroptions, ikreturn);
+    if( !!__pIkCache ) {
+        IkReturnPtr pentry(new IkReturn(bsuccess ? IKRA_Success : IKRA_Reject));
+        if( !!ikreturn ) {
+            *pentry = *ikreturn;
+        }
+        __pIkCache->Insert(vcachekey, pentry);
+    }
+    return bsuccess;
 }
 
 bool RobotBase::Manipulator::FindIKSolutions(const IkParameterization& goal, int filteroptions, std::vector<IkReturnPtr>& vikreturns) const
@@ -222,6 +398,28 @@ bool RobotBase::Manipulator::FindIKSolutions(const IkParameterization& goal, con
     return vFreeParameters.size() == 0 ? pIkSolver->SolveAll(localgoal,filteroptions,vikreturns) : pIkSolver->SolveAll(localgoal,vFreeParameters,filteroptions,vikreturns);
 }
 
+void RobotBase::Manipulator::SetIkCache(dReal fresolution, size_t maxentries)
+{
+    if( fresolution <= 0 ) {
+        __pIkCache.reset();
+        return;
+    }
+    OPENRAVE_ASSERT_OP(maxentries,>,0);
+    __pIkCache.reset(new IkSolutionCache(fresolution, maxentries));
+}
+
+bool RobotBase::Manipulator::GetIkCacheStatistics(uint64_t& numhits, uint64_t& nummisses, uint64_t& numinvalidations, size_t& numentries) const
+{
+    if( !__pIkCache ) {
+        return false;
+    }
+    numhits = __pIkCache->_numhits;
+    nummisses = __pIkCache->_nummisses;
+    numinvalidations = __pIkCache->_numinvalidations;
+    numentries = __pIkCache->_mapentries.size();
+    return true;
+}
+
 IkParameterization RobotBase::Manipulator::GetIkParameterization(IkParameterizationType iktype, bool inworld) const
 {
     IkParameterization ikp;
@@ -19,14 +19,149 @@
 #include <openrave/planningutils.h>
 #include <openrave/xmlreaders.h>
 
+#ifdef OPENRAVE_HAS_ZLIB
+#include <zlib.h>
+#endif
+
 namespace OpenRAVE {
 
+static const char s_BinaryTrajectoryMagic[4] = { 'O', 'R', 'T', 'B'};
+
+static inline bool _IsLittleEndian()
+{
+    const uint16_t test = 1;
+    return *reinterpret_cast<const uint8_t*>(&test) == 1;
+}
+
+static inline uint64_t _ReadLittleEndian(const char* p, int numbytes)
+{
+    uint64_t value = 0;
+    for(int i = numbytes-1; i >= 0; --i) {
+        value = (value<<8)|static_cast<uint8_t>(p[i]);
+    }
+    return value;
+}
+
+static inline void _WriteLittleEndian(char* p, uint64_t value, int numbytes)
+{
+    for(int i = 0; i < numbytes; ++i) {
+        p[i] = static_cast<char>(value&0xff);
+        value >>= 8;
+    }
+}
+
+void BinaryTrajectoryHeader::Read(const char* pbuffer)
+{
+    if( memcmp(pbuffer,s_BinaryTrajectoryMagic,sizeof(s_BinaryTrajectoryMagic)) != 0 ) {
+        throw OPENRAVE_EXCEPTION_FORMAT0("data is not a binary trajectory",ORE_InvalidArguments);
+    }
+    version = _ReadLittleEndian(pbuffer+4,2);
+    realsize = _ReadLittleEndian(pbuffer+6,1);
+    flags = _ReadLittleEndian(pbuffer+7,1);
+    speclength = _ReadLittleEndian(pbuffer+8,4);
+    descriptionlength = _ReadLittleEndian(pbuffer+12,4);
+    numwaypoints = _ReadLittleEndian(pbuffer+16,8);
+    datalength = _ReadLittleEndian(pbuffer+24,8);
+    if( version != s_nVersion ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory version %d is not supported",version,ORE_InvalidArguments);
+    }
+    if( realsize != sizeof(float) && realsize != sizeof(double) ) {
+        throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory has invalid real size %d",(int)realsize,ORE_InvalidArguments);
+    }
+}
+
+void BinaryTrajectoryHeader::Write(std::ostream& O) const
+{
+    char buffer[s_nSize];
+    memcpy(buffer,s_BinaryTrajectoryMagic,sizeof(s_BinaryTrajectoryMagic));
+    _WriteLittleEndian(buffer+4,version,2);
+    _WriteLittleEndian(buffer+6,realsize,1);
+    _WriteLittleEndian(buffer+7,flags,1);
+    _WriteLittleEndian(buffer+8,speclength,4);
+    _WriteLittleEndian(buffer+12,descriptionlength,4);
+    _WriteLittleEndian(buffer+16,numwaypoints,8);
+    _WriteLittleEndian(buffer+24,datalength,8);
+    O.write(buffer,s_nSize);
+}
+
+/// \brief converts little-endian values of size realsize to dReal
+static void _ReadBinaryWaypoints(const char* pdata, size_t realsize, size_t numvalues, dReal* pvalues)
+{
+    if( realsize == sizeof(dReal) && _IsLittleEndian() ) {
+        memcpy(pvalues,pdata,numvalues*sizeof(dReal));
+        return;
+    }
+    for(size_t i = 0; i < numvalues; ++i, pdata += realsize) {
+        uint64_t bits = _ReadLittleEndian(pdata,realsize);
+        if( realsize == sizeof(float) ) {
+            uint32_t bits32 = static_cast<uint32_t>(bits);
+            float f;
+            memcpy(&f,&bits32,sizeof(f));
+            pvalues[i] = f;
+        }
+        else {
+            double f;
+            memcpy(&f,&bits,sizeof(f));
+            pvalues[i] = f;
+        }
+    }
+}
+
 TrajectoryBase::TrajectoryBase(EnvironmentBasePtr penv) : InterfaceBase(PT_Trajectory,penv)
 {
 }
 
 void TrajectoryBase::serialize(std::ostream& O, int options) const
 {
+    if( options & TSO_Binary ) {
+        std::vector<dReal> data;
+        GetWaypoints(0,GetNumWaypoints(),data);
+        if( !_IsLittleEndian() ) {
+            for(size_t i = 0; i < data.size(); ++i) {
+                char* p = reinterpret_cast<char*>(&data[i]);
+                std::reverse(p,p+sizeof(dReal));
+            }
+        }
+        const char* pdata = data.size() > 0 ? reinterpret_cast<const char*>(&data[0]) : NULL;
+        size_t datalength = data.size()*sizeof(dReal);
+        std::vector<uint8_t> vcompressed;
+        if( options & TSO_Compressed ) {
+#ifdef OPENRAVE_HAS_ZLIB
+            uLongf compressedlength = compressBound(datalength);
+            vcompressed.resize(max((uLongf)1,compressedlength));
+            int ret = compress2(&vcompressed[0],&compressedlength,reinterpret_cast<const Bytef*>(pdata),datalength,Z_DEFAULT_COMPRESSION);
+            if( ret != Z_OK ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("failed to compress trajectory data: %d",ret,ORE_Failed);
+            }
+            pdata = reinterpret_cast<const char*>(&vcompressed[0]);
+            datalength = compressedlength;
+#else
+            throw OPENRAVE_EXCEPTION_FORMAT0("cannot compress trajectory, openrave was compiled without zlib",ORE_NotImplemented);
+#endif
+        }
+
+        stringstream ssspec;
+        ssspec << GetConfigurationSpecification();
+        std::string spec = ssspec.str();
+        BinaryTrajectoryHeader header;
+        header.version = BinaryTrajectoryHeader::s_nVersion;
+        header.realsize = sizeof(dReal);
+        header.flags = (options & TSO_Compressed) ? BinaryTrajectoryHeader::s_nFlagCompressed : 0;
+        header.speclength = spec.size();
+        header.descriptionlength = GetDescription().size();
+        header.numwaypoints = GetNumWaypoints();
+        header.datalength = datalength;
+        header.Write(O);
+        O.write(spec.c_str(),spec.size());
+        O.write(GetDescription().c_str(),GetDescription().size());
+        const char padding[8] = { 0};
+        O.write(padding,header.GetDataOffset()-BinaryTrajectoryHeader::s_nSize-spec.size()-GetDescription().size());
+        if( datalength > 0 ) {
+            O.write(pdata,datalength);
+        }
+        return;
+    }
+
     O << "<trajectory type=\"" << GetXMLId() << "\">" << endl << GetConfigurationSpecification();
     O << "<data count=\"" << GetNumWaypoints() << "\">" << endl;
     std::vector<dReal> data;
@@ -43,6 +178,79 @@ void TrajectoryBase::serialize(std::ostream& O, int options) const
 
 InterfaceBasePtr TrajectoryBase::deserialize(std::istream& I)
 {
+    if( I.peek() == s_BinaryTrajectoryMagic[0] ) {
+        char headerbuffer[BinaryTrajectoryHeader::s_nSize];
+        BinaryTrajectoryHeader header;
+        if( !I.read(headerbuffer,sizeof(headerbuffer)) ) {
+            throw OPENRAVE_EXCEPTION_FORMAT0("binary trajectory header is truncated",ORE_InvalidArguments);
+        }
+        header.Read(headerbuffer);
+        // check the sizes against the stream before allocating anything, the header could be corrupted
+        uint64_t numbytes = header.GetDataOffset()-BinaryTrajectoryHeader::s_nSize;
+        if( header.datalength > std::numeric_limits<uint64_t>::max()-numbytes || numbytes+header.datalength > std::numeric_limits<size_t>::max() ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory data length %d is too big",header.datalength,ORE_InvalidArguments);
+        }
+        numbytes += header.datalength;
+        std::istream::pos_type posstart = I.tellg();
+        if( posstart != std::istream::pos_type(-1) && I.seekg(0,std::ios::end) ) {
+            std::istream::pos_type posend = I.tellg();
+            I.seekg(posstart);
+            if( posend != std::istream::pos_type(-1) && numbytes > static_cast<uint64_t>(posend-posstart) ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory needs %d bytes but the stream only has %d",numbytes%static_cast<uint64_t>(posend-posstart),ORE_InvalidArguments);
+            }
+        }
+        I.clear();
+        std::vector<char> vbuffer;
+        // streams that cannot seek are read in chunks so that a truncated stream fails before the whole length is allocated
+        const size_t nChunkSize = 1<<20;
+        while( vbuffer.size() < numbytes ) {
+            size_t offset = vbuffer.size();
+            vbuffer.resize(offset+min(nChunkSize,static_cast<size_t>(numbytes-offset)));
+            if( !I.read(&vbuffer[offset],vbuffer.size()-offset) ) {
+                throw OPENRAVE_EXCEPTION_FORMAT0("binary trajectory data is truncated",ORE_InvalidArguments);
+            }
+        }
+        ConfigurationSpecification spec;
+        stringstream ssspec(std::string(vbuffer.begin(),vbuffer.begin()+header.speclength));
+        ssspec >> spec;
+        std::string description(vbuffer.begin()+header.speclength,vbuffer.begin()+header.speclength+header.descriptionlength);
+        const char* pdata = vbuffer.size() > 0 ? &vbuffer[header.GetDataOffset()-BinaryTrajectoryHeader::s_nSize] : NULL;
+        uint64_t dof = spec.GetDOF();
+        if( dof > 0 && header.numwaypoints > std::numeric_limits<size_t>::max()/(dof*header.realsize) ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory has too many waypoints %d",header.numwaypoints,ORE_InvalidArguments);
+        }
+        size_t numvalues = header.numwaypoints*dof;
+        std::vector<char> vuncompressed;
+        if( header.flags & BinaryTrajectoryHeader::s_nFlagCompressed ) {
+#ifdef OPENRAVE_HAS_ZLIB
+            // deflate cannot compress by more than 1032:1
+            if( numvalues*header.realsize > (header.datalength+1)*1032 ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory data has %d compressed bytes, which cannot hold %d values",header.datalength%numvalues,ORE_InvalidArguments);
+            }
+            uLongf uncompressedlength = numvalues*header.realsize;
+            vuncompressed.resize(max((uLongf)1,uncompressedlength));
+            int ret = uncompress(reinterpret_cast<Bytef*>(&vuncompressed[0]),&uncompressedlength,reinterpret_cast<const Bytef*>(pdata),header.datalength);
+            if( ret != Z_OK || uncompressedlength != numvalues*header.realsize ) {
+                throw OPENRAVE_EXCEPTION_FORMAT("failed to uncompress trajectory data: %d",ret,ORE_InvalidArguments);
+            }
+            pdata = &vuncompressed[0];
+#else
+            throw OPENRAVE_EXCEPTION_FORMAT0("cannot read compressed trajectory, openrave was compiled without zlib",ORE_NotImplemented);
+#endif
+        }
+        else if( header.datalength != numvalues*header.realsize ) {
+            throw OPENRAVE_EXCEPTION_FORMAT("binary trajectory data has %d bytes, expected %d",header.datalength%(numvalues*header.realsize),ORE_InvalidArguments);
+        }
+        std::vector<dReal> data(numvalues);
+        if( numvalues > 0 ) {
+            _ReadBinaryWaypoints(pdata,header.realsize,numvalues,&data[0]);
+        }
+        Init(spec);
+        Insert(0,data);
+        SetDescription(description);
+        return shared_from_this();
+    }
+
     stringbuf buf;
     stringstream::streampos pos = I.tellg();
     I.get(buf, 0); // get all the data, yes this is inefficient, not sure if there anyway to search in streams
@@ -83,6 +291,56 @@ void TrajectoryBase::Sample(std::vector<dReal>& data, dReal time, const Configur
     ConfigurationSpecification::ConvertData(data.begin(),spec,vinternaldata.begin(),GetConfigurationSpecification(),1,GetEnv());
 }
 
+void TrajectoryBase::SamplePoints(std::vector<dReal>& data, const std::vector<dReal>& times) const
+{
+    RAVELOG_VERBOSE(str(boost::format("TrajectoryBase::SamplePoints: calling slow implementation %s")%GetXMLId()));
+    int dof = GetConfigurationSpecification().GetDOF();
+    data.resize(times.size()*dof);
+    vector<dReal> vpoint;
+    for(size_t i = 0; i < times.size(); ++i) {
+        Sample(vpoint,times[i]);
+        std::copy(vpoint.begin(),vpoint.end(),data.begin()+i*dof);
+    }
+}
+
+void TrajectoryBase::SamplePoints(std::vector<dReal>& data, const std::vector<dReal>& times, const ConfigurationSpecification& spec) const
+{
+    RAVELOG_VERBOSE(str(boost::format("TrajectoryBase::SamplePoints: calling slow implementation %s")%GetXMLId()));
+    data.resize(times.size()*spec.GetDOF());
+    vector<dReal> vpoint;
+    for(size_t i = 0; i < times.size(); ++i) {
+        Sample(vpoint,times[i],spec);
+        std::copy(vpoint.begin(),vpoint.end(),data.begin()+i*spec.GetDOF());
+    }
+}
+
+/// \brief fills times with starttime + i*deltatime <= stoptime
+static void _GetSampleRangeTimes(std::vector<dReal>& times, dReal starttime, dReal stoptime, dReal deltatime)
+{
+    OPENRAVE_ASSERT_OP(deltatime,>,0);
+    OPENRAVE_ASSERT_OP(starttime,<=,stoptime);
+    // multiply rather than accumulate so the last time does not drift
+    size_t numtimes = static_cast<size_t>((stoptime-starttime)/deltatime + g_fEpsilonLinear) + 1;
+    times.resize(numtimes);
+    for(size_t i = 0; i < numtimes; ++i) {
+        times[i] = min(starttime + i*deltatime, stoptime);
+    }
+}
+
+void TrajectoryBase::SampleRange(std::vector<dReal>& data, dReal starttime, dReal stoptime, dReal deltatime) const
+{
+    vector<dReal> times;
+    _GetSampleRangeTimes(times,starttime,stoptime,deltatime);
+    SamplePoints(data,times);
+}
+
+void TrajectoryBase::SampleRange(std::vector<dReal>& data, dReal starttime, dReal stoptime, dReal deltatime, const ConfigurationSpecification& spec) const
+{
+    vector<dReal> times;
+    _GetSampleRangeTimes(times,starttime,stoptime,deltatime);
+    SamplePoints(data,times,spec);
+}
+
 void TrajectoryBase::GetWaypoints(size_t startindex, size_t endindex, std::vector<dReal>& data, const ConfigurationSpecification& spec) const
 {
     RAVELOG_VERBOSE(str(boost::format("TrajectoryBase::GetWaypoints: calling slow implementation %s")%GetXMLId()));
@@ -0,0 +1,3 @@
+from assume import AppliedPredicate, global_assumptions, Predicate, AssumptionsContext
+from ask import Q, ask, register_handler, remove_handler
+from refine import refine
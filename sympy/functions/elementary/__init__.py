@@ -0,0 +1,6 @@
+import complexes
+import exponential
+import hyperbolic
+import integers
+import trigonometric
+import miscellaneous
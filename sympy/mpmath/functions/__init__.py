@@ -0,0 +1,13 @@
+from . import functions
+# Hack to update methods
+from . import factorials
+from . import hypergeometric
+from . import expintegrals
+from . import bessel
+from . import orthogonal
+from . import theta
+from . import elliptic
+from . import zeta
+from . import rszeta
+from . import zetazeros
+from . import qfunctions
@@ -0,0 +1,3 @@
+from sympy.mpmath.libmp import *
+from sympy.mpmath import *
+import random
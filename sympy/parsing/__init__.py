@@ -0,0 +1 @@
+"""Used for translating a string into a SymPy expression. """
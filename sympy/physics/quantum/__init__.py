@@ -0,0 +1,60 @@
+__all__ = []
+
+# The following pattern is used below for importing sub-modules:
+#
+# 1. "from foo import *".  This imports all the names from foo.__all__ into
+#    this module. But, this does not put those names into the __all__ of
+#    this module. This enables "from sympy.physics.quantum import State" to
+#    work.
+# 2. "import foo; __all__.extend(foo.__all__)". This adds all the names in
+#    foo.__all__ to the __all__ of this module. The names in __all__
+#    determine which names are imported when
+#    "from sympy.physics.quantum import *" is done.
+
+import anticommutator
+from anticommutator import *
+__all__.extend(anticommutator.__all__)
+
+import qapply as qapmod
+from qapply import *
+__all__.extend(qapmod.__all__)
+
+import commutator
+from commutator import *
+__all__.extend(commutator.__all__)
+
+import dagger
+from dagger import *
+__all__.extend(dagger.__all__)
+
+import hilbert
+from hilbert import *
+__all__.extend(hilbert.__all__)
+
+import innerproduct
+from innerproduct import *
+__all__.extend(innerproduct.__all__)
+
+import kronecker
+from kronecker import *
+__all__.extend(kronecker.__all__)
+
+import operator
+from operator import *
+__all__.extend(operator.__all__)
+
+import represent as repmod
+from represent import *
+__all__.extend(repmod.__all__)
+
+import state
+from state import *
+__all__.extend(state.__all__)
+
+import tensorproduct
+from tensorproduct import *
+__all__.extend(tensorproduct.__all__)
+
+import constants
+from constants import *
+__all__.extend(constants.__all__)
@@ -0,0 +1,145 @@
+"""Arithmetics of sparse polynomials in `K[x]` or `K[X]`. """
+
+def sup_add_ground(f, coeff, K):
+    pass
+
+def smp_add_ground(f, coeff, u, ord, K):
+    pass
+
+def sup_sub_ground(f, coeff, K):
+    pass
+
+def smp_sub_ground(f, coeff, u, ord, K):
+    pass
+
+def sup_mul_ground(f, coeff, K):
+    pass
+
+def smp_mul_ground(f, coeff, u, ord, K):
+    pass
+
+def sup_quo_ground(f, coeff, K):
+    pass
+
+def smp_quo_ground(f, coeff, u, ord, K):
+    pass
+
+def sup_exquo_ground(f, coeff, K):
+    pass
+
+def smp_exquo_ground(f, coeff, u, ord, K):
+    pass
+
+def sup_add_term(f, term, K):
+    pass
+
+def smp_add_term(f, term, u, ord, K):
+    pass
+
+def sup_sub_term(f, term, K):
+    pass
+
+def smp_sub_term(f, term, u, ord, K):
+    pass
+
+def sup_mul_term(f, term, K):
+    pass
+
+def smp_mul_term(f, term, u, ord, K):
+    pass
+
+def sup_abs(f, K):
+    pass
+
+def smp_abs(f, u, ord, K):
+    pass
+
+def sup_neg(f, K):
+    pass
+
+def smp_neg(f, u, ord, K):
+    pass
+
+def sup_add(f, g, K):
+    pass
+
+def smp_add(f, g, u, ord, K):
+    pass
+
+def sup_sub(f, g, K):
+    pass
+
+def smp_sub(f, g, u, ord, K):
+    pass
+
+def sup_mul(f, g, K):
+    pass
+
+def smp_mul(f, g, u, ord, K):
+    pass
+
+def sup_sqr(f, K):
+    pass
+
+def smp_sqr(f, u, ord, K):
+    pass
+
+def sup_pow(f, n, K):
+    pass
+
+def smp_pow(f, n, u, ord, K):
+    pass
+
+def sup_pdiv(f, g, K):
+    pass
+
+def smp_pdiv(f, g, u, ord, K):
+    pass
+
+def sup_prem(f, g, K):
+    pass
+
+def smp_prem(f, g, u, ord, K):
+    pass
+
+def sup_pquo(f, g, K):
+    pass
+
+def smp_pquo(f, g, u, ord, K):
+    pass
+
+def sup_pexquo(f, g, K):
+    pass
+
+def smp_pexquo(f, g, u, ord, K):
+    pass
+
+def sup_div(f, g, K):
+    pass
+
+def smp_div(f, g, u, ord, K):
+    pass
+
+def sup_rem(f, g, K):
+    pass
+
+def smp_rem(f, g, u, ord, K):
+    pass
+
+def sup_quo(f, g, K):
+    pass
+
+def smp_quo(f, g, u, ord, K):
+    pass
+
+def sup_exquo(f, g, K):
+    pass
+
+def smp_exquo(f, g, u, ord, K):
+    pass
+
+def sup_reduced(f, G, K):
+    pass
+
+def smp_reduced(f, G, u, ord, K):
+    pass
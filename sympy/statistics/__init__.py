@@ -0,0 +1,5 @@
+"""
+SymPy statistics module
+"""
+
+from distributions import Normal, Uniform
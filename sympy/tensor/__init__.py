@@ -0,0 +1,5 @@
+"""A module to manipulate symbolic objects with indices including tensors
+
+"""
+from indexed import IndexedBase, Idx, Indexed
+from index_methods import get_contraction_structure, get_indices
@@ -0,0 +1,18 @@
+"""Some utilities that may help.
+"""
+from iterables import (flatten, group, take, subsets,
+    variations, numbered_symbols, cartes, capture, dict_merge,
+    postorder_traversal, preorder_traversal, interactive_traversal,
+    prefixes, postfixes, sift, topological_sort)
+
+from lambdify import lambdify
+from source import source
+
+from decorator import threaded, xthreaded
+
+from runtests import test, doctest
+
+from cythonutils import cythonized
+from timeutils import timed
+
+from misc import default_sort_key
@@ -96,6 +96,15 @@ def randpose(N=1):
 def randlimits(lower,upper):
     return lower+random.rand(len(lower))*(upper-lower)
 
+def randrobotstate(robot,T,translation=1.5):
+    """sets random dof values within the limits, and moves the robot randomly around T in the xy plane by at most translation
+    """
+    lower,upper = robot.GetDOFLimits()
+    robot.SetDOFValues(randlimits(lower,upper))
+    Tnew = array(T)
+    Tnew[0:2,3] += translation*(2*random.rand(2)-1)
+    robot.SetTransform(Tnew)
+
 def bodymaxjointdist(link,localtrans):
     body = link.GetParent()
     joints = body.GetChain(0,link.GetIndex(),returnjoints=True)
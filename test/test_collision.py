@@ -221,7 +221,296 @@ class RunCollision(EnvironmentSetup):
             assert(abs(report.minDistance-0.29193971893003506) < 0.01 )
             assert(report.plink1 == robot.GetLink('wam1'))
             assert(report.plink2 == env.GetKinBody('pole').GetLinks()[0])
-        
+
+    def test_checkcollisionbatch(self):
+        self.log.debug('test that checking a batch of configurations gives the same results as checking them one at a time')
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        with env:
+            checker=env.GetCollisionChecker()
+            robot=env.GetRobots()[0]
+            manip=robot.GetActiveManipulator()
+            T = robot.GetTransform()
+            try:
+                for activedofs in [False,True]:
+                    if activedofs:
+                        # only the active links are checked, the other links still move with the configurations
+                        robot.SetActiveDOFs(manip.GetArmIndices())
+                        checker.SetCollisionOptions(CollisionOptions.ActiveDOFs)
+                        dofindices = manip.GetArmIndices()
+                    else:
+                        checker.SetCollisionOptions(0)
+                        dofindices = range(robot.GetDOF())
+                    lower,upper = robot.GetDOFLimits(dofindices)
+                    numcollisions = 0
+                    for i in range(10):
+                        randrobotstate(robot,T)
+                        values = robot.GetDOFValues()
+                        Trobot = robot.GetTransform()
+                        configs = array([randlimits(lower,upper) for j in range(20)])
+                        expected = []
+                        for config in configs:
+                            robot.SetDOFValues(config,dofindices)
+                            expected.append((env.CheckCollision(robot),robot.CheckSelfCollision()))
+                        robot.SetDOFValues(values)
+                        for batchoptions,index in [(CollisionBatchOptions.CheckEnv,0),(CollisionBatchOptions.CheckSelf,1)]:
+                            collisions = checker.CheckCollisionBatch(robot,dofindices,configs,batchoptions)
+                            assert(list(collisions) == [int(e[index]) for e in expected])
+                        collisions = checker.CheckCollisionBatch(robot,dofindices,configs,CollisionBatchOptions.CheckEnv|CollisionBatchOptions.CheckSelf)
+                        assert(list(collisions) == [int(e[0] or e[1]) for e in expected])
+                        numcollisions += sum(collisions)
+                        # stops at the first colliding configuration
+                        report = CollisionReport()
+                        collisions = checker.CheckCollisionBatch(robot,dofindices,configs,CollisionBatchOptions.CheckEnv|CollisionBatchOptions.CheckSelf|CollisionBatchOptions.StopAtFirstCollision,report)
+                        colliding = [e[0] or e[1] for e in expected]
+                        if True in colliding:
+                            firstindex = colliding.index(True)
+                            assert(list(collisions) == [0]*firstindex+[1] and report.plink1 is not None)
+                        else:
+                            assert(len(collisions) == len(configs) and not any(collisions))
+                        # the state of the body is restored
+                        assert(transdist(robot.GetDOFValues(),values) <= g_epsilon)
+                        assert(transdist(robot.GetTransform(),Trobot) <= g_epsilon)
+                    assert(numcollisions > 0 and numcollisions < 10*len(configs))
+            finally:
+                checker.SetCollisionOptions(0)
+                robot.SetActiveDOFs(range(robot.GetDOF()))
+
+    def test_pqpconcurrentqueries(self):
+        self.log.debug('test that concurrent checks with query contexts agree with serial checks')
+        import threading, time
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        with env:
+            pqp = RaveCreateCollisionChecker(env,'pqp')
+            env.SetCollisionChecker(pqp)
+            robot=env.GetRobots()[0]
+            robot.ReleaseAllGrabbed()
+            T = robot.GetTransform()
+            lower,upper = robot.GetDOFLimits()
+            alllinktransforms = []
+            expected = []
+            for i in range(200):
+                randrobotstate(robot,T)
+                alllinktransforms.append(robot.GetLinkTransformations())
+                expected.append(env.CheckCollision(robot) or robot.CheckSelfCollision())
+            assert(True in expected and False in expected)
+            # the contexts snapshot the other bodies, so the robot state does not matter
+            robot.SetDOFValues(randlimits(lower,upper))
+            for numthreads in [1,2,4]:
+                contexts = [pqp.CreateQueryContext(robot) for ithread in range(numthreads)]
+                results = [None]*len(alllinktransforms)
+                errors = []
+                def querythread(ithread):
+                    try:
+                        for i in range(ithread,len(alllinktransforms),numthreads):
+                            results[i] = pqp.CheckCollisionInContext(contexts[ithread],alllinktransforms[i])
+                    except Exception as e:
+                        errors.append(e)
+                threads = [threading.Thread(target=querythread,args=(ithread,)) for ithread in range(numthreads)]
+                starttime = time.time()
+                for thread in threads:
+                    thread.start()
+                for thread in threads:
+                    thread.join()
+                elapsedtime = time.time()-starttime
+                assert(len(errors) == 0)
+                assert(results == expected)
+                self.log.info('%d threads: %f queries/s',numthreads,len(alllinktransforms)/max(elapsedtime,1e-6))
+            # the report gets the colliding links
+            i = expected.index(True)
+            report = CollisionReport()
+            assert(pqp.CheckCollisionInContext(pqp.CreateQueryContext(robot),alllinktransforms[i],report))
+            assert(report.plink1 is not None)
+
+    def test_pqpcheckcollisionrays(self):
+        self.log.debug('test that casting a batch of rays gives the same hits as casting them one at a time')
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        with env:
+            pqp = RaveCreateCollisionChecker(env,'pqp')
+            env.SetCollisionChecker(pqp)
+            robot=env.GetRobots()[0]
+            center = robot.GetTransform()[0:3,3]
+            # rays start around the robot and point in random directions with random lengths
+            rays = c_[center+(random.rand(2000,3)-0.5)*array([3,3,2]), (random.rand(2000,3)-0.5)*4]
+            for body in [None,robot]:
+                collisions,hits = pqp.CheckCollisionRays(rays,body)
+                assert(len(collisions) == len(rays) and hits.shape == (len(rays),6))
+                assert(True in list(collisions) and False in list(collisions))
+                for i,ray in enumerate(rays):
+                    report = CollisionReport()
+                    if body is None:
+                        collision = pqp.CheckCollision(Ray(ray[0:3],ray[3:6]),report)
+                    else:
+                        collision = pqp.CheckCollision(Ray(ray[0:3],ray[3:6]),body,report)
+                    assert(collision == collisions[i])
+                    if collision:
+                        assert(transdist(hits[i,0:3],report.contacts[0].pos) <= 1e-4)
+                        assert(transdist(hits[i,3:6],report.contacts[0].norm) <= 1e-4)
+                    else:
+                        assert(transdist(hits[i],zeros(6)) == 0)
+                # only rays hitting the front of the surfaces are kept
+                frontcollisions,fronthits = pqp.CheckCollisionRays(rays,body,True)
+                for i,ray in enumerate(rays):
+                    if frontcollisions[i]:
+                        assert(collisions[i] and transdist(fronthits[i],hits[i]) == 0 and dot(hits[i,3:6],ray[3:6]) < 0)
+                    elif collisions[i]:
+                        assert(dot(hits[i,3:6],ray[3:6]) >= 0)
+
+    def test_pqpclonedmodels(self):
+        self.log.debug('test that a cloned body only shares the pqp models of its reference if the meshes are the same')
+        env=self.env
+        with env:
+            env.SetCollisionChecker(RaveCreateCollisionChecker(env,'pqp'))
+            box = RaveCreateKinBody(env,'')
+            box.SetName('box')
+            box.InitFromBoxes(array([[0,0,0,0.1,0.1,0.1]]),True)
+            env.AddKinBody(box)
+            obstacle = RaveCreateKinBody(env,'')
+            obstacle.SetName('obstacle')
+            obstacle.InitFromBoxes(array([[0.3,0,0,0.1,0.1,0.1]]),True)
+            env.AddKinBody(obstacle)
+            assert(not env.CheckCollision(box,obstacle))
+            # the clones carry the collision data of box
+            clone = RaveCreateKinBody(env,'')
+            clone.Clone(box,0)
+            clone.SetName('clone')
+            env.AddKinBody(clone)
+            assert(not env.CheckCollision(clone,obstacle))
+            # same triangles with different vertices
+            largeclone = RaveCreateKinBody(env,'')
+            largeclone.Clone(box,0)
+            largeclone.InitFromBoxes(array([[0,0,0,0.25,0.25,0.25]]),True)
+            largeclone.SetName('largeclone')
+            env.AddKinBody(largeclone)
+            assert(env.CheckCollision(largeclone,obstacle))
+            assert(not env.CheckCollision(box,obstacle))
+
+    def test_pqpselfcollisioncache(self):
+        self.log.debug('test that pqp link pair caching and never colliding filtering do not change self-collision results')
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        with env:
+            pqp = RaveCreateCollisionChecker(env,'pqp')
+            env.SetCollisionChecker(pqp)
+            robot=env.GetRobots()[0]
+            lower,upper = robot.GetDOFLimits()
+            numpairs = int(pqp.SendCommand('SetNeverCollidingLinks %s 100'%robot.GetName()))
+            assert(numpairs > 0 and numpairs < len(robot.GetNonAdjacentLinks(0)))
+            # more samples than the cache was computed with sample again, and can only find more colliding pairs
+            numpairs2 = int(pqp.SendCommand('SetNeverCollidingLinks %s 1000'%robot.GetName()))
+            assert(numpairs2 <= numpairs)
+            assert(int(pqp.SendCommand('SetNeverCollidingLinks %s 100'%robot.GetName())) == numpairs2)
+            skippedindices = [int(s) for s in pqp.SendCommand('GetNeverCollidingLinks %s'%robot.GetName()).split()]
+            assert(len(skippedindices) == 2*numpairs2)
+            skippedpairs = set(zip(skippedindices[0::2],skippedindices[1::2]))
+            checkedpairs = [(robot.GetLinks()[i],robot.GetLinks()[j]) for i,j in robot.GetNonAdjacentLinks(0) if not (i,j) in skippedpairs]
+            values = robot.GetDOFValues()
+            for i in range(100):
+                if i%10 == 0:
+                    values = lower+random.rand(len(lower))*(upper-lower)
+                else:
+                    # only move the last joints so most pairs keep their relative transforms
+                    values[-2:] = lower[-2:]+random.rand(2)*(upper[-2:]-lower[-2:])
+                robot.SetDOFValues(values)
+                pqp.SendCommand('SetNeverCollidingLinks %s 100'%robot.GetName())
+                # the sampled pairs can miss collisions of random configurations, so only the checked pairs are compared
+                check = robot.CheckSelfCollision()
+                assert(check == any([env.CheckCollision(link1,link2) for link1,link2 in checkedpairs]))
+                # setting the options clears the cached pairs
+                pqp.SendCommand('ClearNeverCollidingLinks %s'%robot.GetName())
+                pqp.SetCollisionOptions(0)
+                assert(robot.CheckSelfCollision() == any([env.CheckCollision(robot.GetLinks()[i],robot.GetLinks()[j]) for i,j in robot.GetNonAdjacentLinks(0)]))
+
+    def test_pqpspheretrees(self):
+        self.log.debug('test that rejecting link pairs with sphere trees does not change pqp results')
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        with env:
+            pqp = RaveCreateCollisionChecker(env,'pqp')
+            env.SetCollisionChecker(pqp)
+            robot=env.GetRobots()[0]
+            T = robot.GetTransform()
+            for i in range(100):
+                randrobotstate(robot,T)
+                results = []
+                for spheretrees in [1,0]:
+                    pqp.SendCommand('SetSphereTrees %d'%spheretrees)
+                    # setting the options clears the cached free link pairs
+                    pqp.SetCollisionOptions(0)
+                    results.append((env.CheckCollision(robot),robot.CheckSelfCollision()))
+                assert(results[0] == results[1])
+
+    def test_pqpbroadphase(self):
+        self.log.debug('test that the broad phase of the pqp environment checks does not change results on a cluttered scene')
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        with env:
+            pqp = RaveCreateCollisionChecker(env,'pqp')
+            env.SetCollisionChecker(pqp)
+            robot=env.GetRobots()[0]
+            boxes = []
+            for i in range(40):
+                box=RaveCreateKinBody(env,'')
+                box.SetName('box%d'%i)
+                box.InitFromBoxes(array([r_[zeros(3),0.02+0.1*random.rand(3)]]),True)
+                env.Add(box)
+                boxes.append(box)
+            T = robot.GetTransform()
+            def randomizescene():
+                for box in boxes:
+                    if box.GetEnvironmentId():
+                        box.SetTransform(matrixFromPose(r_[quatFromAxisAngle(random.rand(3)),T[0:3,3]+array([3,3,1.5])*random.rand(3)-array([1.5,1.5,0])]))
+                randrobotstate(robot,T)
+            numcollisions = 0
+            try:
+                for i in range(100):
+                    randomizescene()
+                    if i == 30:
+                        env.Remove(boxes[0])
+                    elif i == 60:
+                        env.Add(boxes[0])
+                    link = robot.GetLinks()[random.randint(len(robot.GetLinks()))]
+                    results = []
+                    for broadphase in [1,0]:
+                        pqp.SendCommand('SetBroadPhase %d'%broadphase)
+                        results.append((env.CheckCollision(robot),env.CheckCollision(link),env.CheckCollision(boxes[1]),env.CheckCollision(robot,boxes[2]),boxes[0].GetEnvironmentId() and env.CheckCollision(boxes[0])))
+                    assert(results[0] == results[1])
+                    numcollisions += results[0][0]
+            finally:
+                pqp.SendCommand('SetBroadPhase 1')
+            assert(numcollisions > 0)
+
+    def test_sdfcollision(self):
+        self.log.debug('test that the distance field checker gives the same results as pqp')
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        with env:
+            pqp = RaveCreateCollisionChecker(env,'pqp')
+            pqp.InitEnvironment()
+            sdf = RaveCreateCollisionChecker(env,'sdf')
+            env.SetCollisionChecker(sdf)
+            robot=env.GetRobots()[0]
+            staticnames = [body.GetName() for body in env.GetBodies() if body != robot]
+            assert(int(sdf.SendCommand('BuildDistanceField cellsize 0.03 bodies '+' '.join(staticnames))) > 0)
+            lower,upper = robot.GetDOFLimits()
+            T = robot.GetTransform()
+            for i in range(100):
+                randrobotstate(robot,T)
+                assert(sdf.CheckCollision(robot) == pqp.CheckCollision(robot))
+                link = robot.GetLinks()[random.randint(len(robot.GetLinks()))]
+                assert(sdf.CheckCollision(link) == pqp.CheckCollision(link))
+            assert(len(sdf.SendCommand('GetClearance %s'%robot.GetName()).split()) == 2)
+            # moving a static body stops using the field
+            body = env.GetKinBody(staticnames[0])
+            Tbody = body.GetTransform()
+            Tbody[2,3] += 0.01
+            body.SetTransform(Tbody)
+            for i in range(10):
+                robot.SetDOFValues(randlimits(lower,upper))
+                assert(sdf.CheckCollision(robot) == pqp.CheckCollision(robot))
+
 #generate_classes(RunCollision, globals(), [('ode','ode'),('bullet','bullet')])
 
 class test_ode(RunCollision):
@@ -209,6 +209,103 @@ class TestEnvironment(EnvironmentSetup):
         for t in threads:
             t.join()
 
+    def test_camerasoftwarerenderer(self):
+        self.log.info('the software renderer of the camera is only used when requested, its depth agrees with collision rays')
+        env=self.env
+        self.LoadEnv('data/pa10calib_envcamera.env.xml')
+        sensor=env.GetRobot('ceilingcamera').GetAttachedSensor('camera').GetSensor()
+        sensor.Configure(Sensor.ConfigureCommand.PowerOn)
+        try:
+            # without a viewer the default renderer produces no images
+            env.StepSimulation(0.5)
+            try:
+                sensor.GetSensorData(Sensor.Type.Camera)
+                assert(False)
+            except openrave_exception:
+                pass
+            for renderer in ['auto','software']:
+                assert(sensor.SendCommand('SetRenderer %s'%renderer) is not None)
+                env.StepSimulation(0.5)
+                data=sensor.GetSensorData(Sensor.Type.Camera)
+                height,width = data.imagedata.shape[0:2]
+                assert(data.depthdata.shape == (height,width) and data.imagedata.max() > 0)
+            with env:
+                Tcamera=sensor.GetTransform()
+                KK=data.KK
+                numcompared = 0
+                for v in range(1,height-1,20):
+                    for u in range(1,width-1,20):
+                        depth=data.depthdata[v,u]
+                        # skip pixels on the boundaries of objects
+                        if abs(data.depthdata[v-1:v+2,u-1:u+2]-depth).max() > 0.01:
+                            continue
+                        direction=dot(Tcamera[0:3,0:3],[(u+0.5-KK[0,2])/KK[0,0],(v+0.5-KK[1,2])/KK[1,1],1])
+                        report=CollisionReport()
+                        # start in front of the box of the camera
+                        if env.CheckCollision(Ray(Tcamera[0:3,3]+0.01*direction,10*direction),report):
+                            assert(abs(dot(report.contacts[0].pos-Tcamera[0:3,3],Tcamera[0:3,2])-depth) <= 1e-3)
+                            numcompared += 1
+                        else:
+                            assert(depth == 0)
+                assert(numcompared > 100)
+        finally:
+            sensor.Configure(Sensor.ConfigureCommand.PowerOff)
+
+    def test_parallelsensorstep(self):
+        self.log.info('stepping the sensors with several threads gives the same laser data as stepping them serially')
+        env=self.env
+        self.LoadEnv('data/testwamcamera.env.xml')
+        env.SetCollisionChecker(RaveCreateCollisionChecker(env,'pqp'))
+        robot=env.GetRobots()[0]
+        # the spinning laser depends on the simulation time
+        sensors=[attsensor.GetSensor() for attsensor in robot.GetAttachedSensors() if attsensor.GetSensor().Supports(Sensor.Type.Laser) and attsensor.GetSensor().GetXMLId().lower() != 'basespinninglaser2d']
+        assert(len(sensors) >= 2)
+        with env:
+            obstacle=RaveCreateKinBody(env,'')
+            obstacle.SetName('obstacle')
+            obstacle.InitFromBoxes(array([[0,0,0,0.05,0.05,0.05]]),True)
+            obstacle.SetTransform(matrixFromPose(r_[1,0,0,0,robot.GetTransform()[0:3,3]+array([0.8,0,0])]))
+            env.Add(obstacle)
+            largebox=RaveCreateKinBody(env,'')
+            largebox.InitFromBoxes(array([[0,0,0,0.6,0.6,0.6]]),True)
+            lower,upper = robot.GetDOFLimits()
+        oldnumthreads = env.GetSensorSimulationThreads()
+        for sensor in sensors:
+            sensor.Configure(Sensor.ConfigureCommand.PowerOn)
+        try:
+            env.GetSensorSimulationStats(True)
+            for i in range(6):
+                with env:
+                    robot.SetDOFValues(randlimits(lower,upper))
+                    if i == 3:
+                        # the collision models of changed geometry are updated before the sensors cast their rays
+                        obstacle.GetLinks()[0].GetGeometries()[0].SetCollisionMesh(largebox.GetLinks()[0].GetGeometries()[0].GetCollisionMesh())
+                allranges = []
+                for numthreads in [4,1]:
+                    env.SetSensorSimulationThreads(numthreads)
+                    # long enough for every sensor to scan
+                    env.StepSimulation(0.2)
+                    allranges.append([sensor.GetSensorData(Sensor.Type.Laser).ranges for sensor in sensors])
+                for ranges0,ranges1 in zip(*allranges):
+                    assert(len(ranges0) > 0 and ranges0.shape == ranges1.shape)
+                    assert(abs(ranges0-ranges1).max() <= g_epsilon)
+                with env:
+                    numobstaclehits = 0
+                    for sensor in sensors:
+                        data=sensor.GetSensorData(Sensor.Type.Laser)
+                        for r in data.ranges:
+                            assert(not env.CheckCollision(Ray(data.positions[0],0.99*r),obstacle))
+                            numobstaclehits += env.CheckCollision(Ray(data.positions[0],1.01*r),obstacle)
+                    assert(i < 3 or numobstaclehits > 0)
+            stats = env.GetSensorSimulationStats()
+            for sensor in sensors:
+                sensorstats = [s for s in stats if s[0] == sensor]
+                assert(len(sensorstats) == 1 and sensorstats[0][1] == 12 and sensorstats[0][2] > 0 and sensorstats[0][3] > 0)
+        finally:
+            env.SetSensorSimulationThreads(oldnumthreads)
+            for sensor in sensors:
+                sensor.Configure(Sensor.ConfigureCommand.PowerOff)
+
     def test_dataccess(self):
         RaveDestroy()
         OPENRAVE_DATA = os.environ.get('OPENRAVE_DATA','')
@@ -244,3 +341,28 @@ class TestEnvironment(EnvironmentSetup):
         finally:
             os.chdir(oldcwd)
     
+    def test_bodylookup(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        oldname = robot.GetName()
+        assert(env.GetRobot(oldname)==robot and env.GetKinBody(oldname)==robot)
+        robot.SetName('renamedrobot')
+        assert(env.GetRobot(oldname) is None and env.GetKinBody(oldname) is None)
+        assert(env.GetRobot('renamedrobot')==robot and env.GetKinBody('renamedrobot')==robot)
+        assert(env.GetBodyFromEnvironmentId(robot.GetEnvironmentId())==robot)
+        body=env.ReadKinBodyXMLFile('data/mug1.kinbody.xml')
+        env.AddKinBody(body,True)
+        assert(env.GetKinBody(body.GetName())==body)
+        env.Remove(body)
+        assert(env.GetKinBody(body.GetName()) is None)
+        body.SetName('removedbody')
+        assert(env.GetKinBody('removedbody') is None)
+        env2=env.CloneSelf(CloningOptions.Bodies)
+        try:
+            robot2=env2.GetRobot('renamedrobot')
+            robot2.SetName('clonedrobot')
+            assert(env2.GetRobot('clonedrobot')==robot2 and env2.GetRobot('renamedrobot') is None)
+            assert(env.GetRobot('renamedrobot')==robot)
+        finally:
+            env2.Destroy()
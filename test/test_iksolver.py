@@ -266,3 +266,127 @@ class TestIkSolver(EnvironmentSetup):
                     raise ValueError('%s!=%s, robot=%s, manip=%s, values=%r'%(numsolutions,numexpected,robotfilename,manipname, values))
                 
                 assert(numsolutions==numexpected)
+
+    def test_freesearchstrategies(self):
+        self.log.info('every free parameter search strategy visits the same free values, so SolveAll returns the same solutions')
+        env=self.env
+        robot=self.LoadRobot('robots/barrettwam.robot.xml')
+        manip=robot.GetActiveManipulator()
+        iksolver=manip.GetIkSolver()
+        with env:
+            lower,upper = robot.GetDOFLimits(manip.GetArmIndices())
+            oldsettings = iksolver.SendCommand('GetFreeSearch').split()
+            try:
+                numtested = 0
+                while numtested < 3:
+                    robot.SetDOFValues(randlimits(lower,upper),manip.GetArmIndices())
+                    ikparam = manip.GetIkParameterization(IkParameterization.Type.Transform6D)
+                    assert(iksolver.SendCommand('SetFreeSearch linear warmstart 0') is not None)
+                    allsolutions = manip.FindIKSolutions(ikparam,0)
+                    if len(allsolutions) == 0:
+                        # the free joint value of the pose falls between the discretized values
+                        continue
+                    numtested += 1
+                    for strategy in ['linear','lowdiscrepancy','coarsetofine']:
+                        for warmstart in [0,1]:
+                            assert(iksolver.SendCommand('SetFreeSearch %s warmstart %d'%(strategy,warmstart)) is not None)
+                            # twice so that the second call is warm started
+                            for j in range(2):
+                                solution = manip.FindIKSolution(ikparam,0)
+                                assert(solution is not None)
+                                with robot:
+                                    robot.SetDOFValues(solution,manip.GetArmIndices())
+                                    assert(transdist(manip.GetTransform(),ikparam.GetTransform6D()) <= g_epsilon)
+                            solutions = manip.FindIKSolutions(ikparam,0)
+                            assert(len(solutions) == len(allsolutions))
+                            for solution in solutions:
+                                assert(min([sum(abs(solution-s)) for s in allsolutions]) <= g_epsilon)
+            finally:
+                iksolver.SendCommand('SetFreeSearch %s warmstart %s firstvalid %s'%tuple(oldsettings))
+
+    def test_ikcache(self):
+        self.log.info('the ik cache is invalidated when the enabled links or the grabbed bodies of the robot change')
+        env=self.env
+        robot=self.LoadRobot('robots/barrettwam.robot.xml')
+        manip=robot.GetActiveManipulator()
+        ikfast=RaveCreateModule(env,'ikfast')
+        def getstats():
+            return [int(s) for s in ikfast.SendCommand('GetIkCacheStats %s %s'%(robot.GetName(),manip.GetName())).split()[0:3]]
+        with env:
+            robot.SetDOFValues([0.5,0.6,0,1.2,0,0.3,0],manip.GetArmIndices())
+            T=manip.GetTransform()
+            assert(ikfast.SendCommand('SetIkCache %s %s 0.001'%(robot.GetName(),manip.GetName())) is not None)
+            try:
+                assert(manip.FindIKSolution(T,IkFilterOptions.CheckEnvCollisions) is not None)
+                assert(manip.FindIKSolution(T,IkFilterOptions.CheckEnvCollisions) is not None)
+                assert(getstats() == [1,1,0])
+                # a small box inside the palm only collides with the hand base
+                obstacle=RaveCreateKinBody(env,'')
+                obstacle.SetName('obstacle')
+                obstacle.InitFromBoxes(array([[0,0,0,0.01,0.01,0.01]]),True)
+                obstacle.SetTransform(matrixFromPose(r_[1,0,0,0,T[0:3,3]-0.06*T[0:3,2]]))
+                env.AddKinBody(obstacle)
+                assert(manip.FindIKSolution(T,IkFilterOptions.CheckEnvCollisions) is None)
+                for link in manip.GetChildLinks():
+                    link.Enable(False)
+                assert(manip.FindIKSolution(T,IkFilterOptions.CheckEnvCollisions) is not None)
+                for link in manip.GetChildLinks():
+                    link.Enable(True)
+                assert(manip.FindIKSolution(T,IkFilterOptions.CheckEnvCollisions) is None)
+                assert(getstats() == [1,4,3])
+
+                # grabbing a box away from the obstacle, then grabbing it again so that it collides
+                obstacle.SetTransform(matrixFromPose(r_[1,0,0,0,T[0:3,3]+0.3*T[0:3,2]]))
+                grabbed=RaveCreateKinBody(env,'')
+                grabbed.SetName('grabbed')
+                grabbed.InitFromBoxes(array([[0,0,0,0.03,0.03,0.03]]),True)
+                grabbed.SetTransform(matrixFromPose(r_[1,0,0,0,T[0:3,3]+0.3*T[0:3,0]]))
+                env.AddKinBody(grabbed)
+                robot.Grab(grabbed)
+                assert(manip.FindIKSolution(T,IkFilterOptions.CheckEnvCollisions) is not None)
+                robot.Release(grabbed)
+                grabbed.SetTransform(matrixFromPose(r_[1,0,0,0,T[0:3,3]+0.3*T[0:3,2]+0.03*T[0:3,0]]))
+                robot.Grab(grabbed)
+                assert(manip.FindIKSolution(T,IkFilterOptions.CheckEnvCollisions) is None)
+                assert(manip.FindIKSolution(T,IkFilterOptions.CheckEnvCollisions) is None)
+                assert(getstats() == [2,6,5])
+            finally:
+                ikfast.SendCommand('SetIkCache %s %s 0'%(robot.GetName(),manip.GetName()))
+
+    def test_solvebatch(self):
+        self.log.info('solving a batch of poses gives the same results as solving them one at a time')
+        env=self.env
+        robot=self.LoadRobot('robots/barrettwam.robot.xml')
+        manip=robot.GetActiveManipulator()
+        with env:
+            # a box in the workspace makes some of the poses collide
+            obstacle=RaveCreateKinBody(env,'')
+            obstacle.SetName('obstacle')
+            obstacle.InitFromBoxes(array([[0.5,0,0.5,0.1,0.3,0.1]]),True)
+            env.AddKinBody(obstacle)
+            iksolver=manip.GetIkSolver()
+            lower,upper = robot.GetDOFLimits(manip.GetArmIndices())
+            ikparams = []
+            with robot:
+                for i in range(40):
+                    robot.SetDOFValues(randlimits(lower,upper),manip.GetArmIndices())
+                    ikparams.append(manip.GetIkParameterization(IkParameterizationType.Transform6D))
+            # out of reach
+            Tfar = array(manip.GetTransform())
+            Tfar[0:3,3] += [3,0,0]
+            ikparams.append(IkParameterization(Tfar,IkParameterizationType.Transform6D))
+            q0 = robot.GetDOFValues(manip.GetArmIndices())
+            values = robot.GetDOFValues()
+            for filteroptions in [0,IkFilterOptions.CheckEnvCollisions]:
+                expected = [iksolver.Solve(ikparam,q0,filteroptions) for ikparam in ikparams]
+                assert(len([ikreturn for ikreturn in expected if ikreturn.GetAction() == IkReturnAction.Success]) > 0)
+                if filteroptions != 0:
+                    assert(len([ikreturn for ikreturn in expected if ikreturn.GetAction() != IkReturnAction.Success]) > 1)
+                for numthreads in [1,4]:
+                    ikreturns = iksolver.SolveBatch(ikparams,q0,filteroptions,numthreads)
+                    assert(len(ikreturns) == len(ikparams))
+                    for ikreturn,expectedreturn in zip(ikreturns,expected):
+                        assert(ikreturn.GetAction() == expectedreturn.GetAction())
+                        if expectedreturn.GetAction() == IkReturnAction.Success:
+                            assert(transdist(ikreturn.GetSolution(),expectedreturn.GetSolution()) <= g_epsilon)
+                    assert(transdist(robot.GetDOFValues(),values) <= g_epsilon)
@@ -1085,3 +1085,67 @@ class TestKinematics(EnvironmentSetup):
             assert(len(body.GetJoints())==1)
             body.SetDOFValues([0.8])
             assert(transdist(body.GetLinks()[1].GetTransform(), array([[ 0.69670671, -0.71735609,  0.        ,  0.34835335], [ 0.71735609,  0.69670671,  0.        ,  0.35867805], [ 0.        ,  0.        ,  1.        ,  0.        ], [ 0.        ,  0.        ,  0.        ,  1.        ]])) <= 1e-7)
+
+    def test_computelinktransformationsbatch(self):
+        env=self.env
+        with env:
+            for robotfile in g_robotfiles:
+                env.Reset()
+                self.LoadEnv(robotfile,{'skipgeometry':'1'})
+                body = env.GetBodies()[0]
+                lower,upper = body.GetDOFLimits()
+                lower = numpy.maximum(-3*ones(body.GetDOF()),lower)
+                upper = numpy.minimum(3*ones(body.GetDOF()),upper)
+                # enough configurations to split them between threads
+                configs = array([randlimits(lower,upper) for i in range(200)])
+                Tlinks = body.GetLinkTransformations()
+                for numthreads in [1,4]:
+                    poses = body.ComputeLinkTransformationsBatch(configs,numthreads)
+                    assert(poses.shape == (len(configs),len(body.GetLinks()),7))
+                    # the body is not moved
+                    assert(transdist(Tlinks,body.GetLinkTransformations()) <= g_epsilon)
+                    for i in range(0,len(configs),20):
+                        with body:
+                            body.SetDOFValues(configs[i])
+                            for ilink,link in enumerate(body.GetLinks()):
+                                assert(transdist(matrixFromPose(poses[i,ilink]),link.GetTransform()) <= g_epsilon)
+
+    def test_fastkinematics(self):
+        self.log.info('test that the forward kinematics fast path gives the same link transforms as the general one on all stock robots and scenes')
+        env=self.env
+        filenames = []
+        for dirname,knownfile,extensions in [('robots','barrettwam.robot.xml',['.robot.xml','.kinbody.xml','.zae']),('data','lab1.env.xml',['.env.xml','.kinbody.xml'])]:
+            fulldirname = os.path.dirname(RaveFindLocalFile(dirname+'/'+knownfile))
+            for filename in sorted(os.listdir(fulldirname)):
+                if len([ext for ext in extensions if filename.endswith(ext)]) > 0:
+                    filenames.append(dirname+'/'+filename)
+        numfastbodies = 0
+        with env:
+            for filename in filenames:
+                env.Reset()
+                # a few files reference missing resources, the bodies that could be loaded are still compared
+                env.Load(filename,{'skipgeometry':'1'})
+                for body in env.GetBodies():
+                    if body.GetDOF() == 0:
+                        continue
+                    fastkinematics = body.IsFastKinematics()
+                    numfastbodies += fastkinematics
+                    lower,upper = body.GetDOFLimits()
+                    lower = numpy.maximum(-3*ones(body.GetDOF()),lower)
+                    upper = numpy.minimum(3*ones(body.GetDOF()),upper)
+                    for i in range(10):
+                        values = randlimits(lower,upper)
+                        # both paths start from the same link transforms. the joints of some bodies like pumabarrett are not
+                        # sorted from the root, so their links depend on the previous transforms of their parents
+                        Tstart = body.GetLinkTransformations()
+                        body.SetFastKinematics(True)
+                        body.SetDOFValues(values)
+                        Tlinks = body.GetLinkTransformations()
+                        body.SetFastKinematics(False)
+                        assert(not body.IsFastKinematics())
+                        body.SetLinkTransformations(Tstart)
+                        body.SetDOFValues(values)
+                        assert(transdist(Tlinks,body.GetLinkTransformations()) <= g_epsilon)
+                    body.SetFastKinematics(True)
+                    assert(body.IsFastKinematics() == fastkinematics)
+        assert(numfastbodies > 0)
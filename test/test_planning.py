@@ -603,6 +603,223 @@ class RunPlanning(EnvironmentSetup):
             assert(success)
             assert(not env.CheckCollision(collisionbody))
 
+    def test_lazyprm(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot = env.GetRobots()[0]
+        with env:
+            robot.SetActiveDOFs(robot.GetActiveManipulator().GetArmIndices())
+            lower,upper = robot.GetActiveDOFLimits()
+            goals = []
+            with robot:
+                while len(goals) < 2:
+                    robot.SetActiveDOFValues(lower+random.rand(len(lower))*(upper-lower))
+                    if not env.CheckCollision(robot) and not robot.CheckSelfCollision():
+                        goals.append(robot.GetActiveDOFValues())
+            planner = RaveCreatePlanner(env,'lazyprm')
+            params = Planner.PlannerParameters()
+            params.SetRobotActiveJoints(robot)
+            params.SetExtraParameters('<roadmapsize>500</roadmapsize><saveroadmap>0</saveroadmap>')
+            numvalid = 0
+            for goal in goals:
+                params.SetGoalConfig(goal)
+                assert(planner.InitPlan(robot,params))
+                traj = RaveCreateTrajectory(env,'')
+                assert(planner.PlanPath(traj) == PlannerStatus.HasSolution)
+                assert(transdist(traj.GetWaypoint(-1,robot.GetActiveConfigurationSpecification()),goal) <= g_epsilon)
+                planningutils.VerifyTrajectory(params,traj,samplingstep=0.002)
+                # the collision status of the roadmap is kept between queries
+                info = [int(x) for x in planner.SendCommand('GetRoadmapInfo').split()]
+                assert(info[0] >= 500 and info[2] >= numvalid)
+                numvalid = info[2]
+            assert(planner.SendCommand('ClearRoadmap') is not None)
+
+    def test_lazyprmclone(self):
+        # the roadmap is shared by all environments of the process, and a clone has the same body ids. check that the
+        # collision status is not reused in a clone whose obstacles have the same update stamps but a different layout.
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot = env.GetRobots()[0]
+        env2 = env.CloneSelf(CloningOptions.Bodies)
+        try:
+            env2.SetCollisionChecker(RaveCreateCollisionChecker(env2,self.collisioncheckername))
+            robot2 = env2.GetRobot(robot.GetName())
+            with env:
+                robot.SetActiveDOFs(robot.GetActiveManipulator().GetArmIndices())
+                robot2.SetActiveDOFs(robot.GetActiveDOFIndices())
+                lower,upper = robot.GetActiveDOFLimits()
+                extraparameters = '<roadmapsize>500</roadmapsize><saveroadmap>0</saveroadmap><_postprocessing planner=""></_postprocessing>'
+                planner = RaveCreatePlanner(env,'lazyprm')
+                params = Planner.PlannerParameters()
+                params.SetRobotActiveJoints(robot)
+                params.SetExtraParameters(extraparameters)
+                while True:
+                    with robot:
+                        robot.SetActiveDOFValues(randlimits(lower,upper))
+                        if env.CheckCollision(robot) or robot.CheckSelfCollision():
+                            continue
+                        goal = robot.GetActiveDOFValues()
+                    params.SetGoalConfig(goal)
+                    assert(planner.InitPlan(robot,params))
+                    traj = RaveCreateTrajectory(env,'')
+                    if planner.PlanPath(traj) == PlannerStatus.HasSolution and traj.GetNumWaypoints() > 2:
+                        break
+                # put a mug on the elbow at the middle of the path, the same query in the clone has to avoid it
+                mug = env2.GetKinBody('mug1')
+                with robot:
+                    robot.SetActiveDOFValues(traj.GetWaypoint(traj.GetNumWaypoints()/2,robot.GetActiveConfigurationSpecification()))
+                    Tmug = mug.GetTransform()
+                    Tmug[0:3,3] = robot.GetJoints()[robot.GetActiveDOFIndices()[3]].GetAnchor()
+                mug.SetTransform(Tmug)
+                # make the update stamps of the clone equal to the original ones
+                for body2 in env2.GetBodies():
+                    body = env.GetKinBody(body2.GetName())
+                    for b0,b1 in [(body,body2),(body2,body)]:
+                        while b0.GetUpdateStamp() < b1.GetUpdateStamp():
+                            b0.GetLinks()[0].SetTransform(b0.GetLinks()[0].GetTransform())
+            with env2:
+                planner2 = RaveCreatePlanner(env2,'lazyprm')
+                params2 = Planner.PlannerParameters()
+                params2.SetRobotActiveJoints(robot2)
+                params2.SetExtraParameters(extraparameters)
+                params2.SetGoalConfig(goal)
+                assert(planner2.InitPlan(robot2,params2))
+                traj2 = RaveCreateTrajectory(env2,'')
+                if planner2.PlanPath(traj2) == PlannerStatus.HasSolution:
+                    planningutils.VerifyTrajectory(params2,traj2,samplingstep=0.002)
+        finally:
+            env2.Destroy()
+
+    def test_parallelbirrt(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot = env.GetRobots()[0]
+        with env:
+            robot.SetActiveDOFs(robot.GetActiveManipulator().GetArmIndices())
+            lower,upper = robot.GetActiveDOFLimits()
+            start = robot.GetActiveDOFValues()
+            goals = []
+            with robot:
+                while len(goals) < 3:
+                    robot.SetActiveDOFValues(randlimits(lower,upper))
+                    if not env.CheckCollision(robot) and not robot.CheckSelfCollision():
+                        goals.append(robot.GetActiveDOFValues())
+            planner = RaveCreatePlanner(env,'parallelbirrt')
+            params = Planner.PlannerParameters()
+            params.SetRobotActiveJoints(robot)
+            for numthreads in [1,4]:
+                assert(planner.SendCommand('SetNumThreads %d'%numthreads) is not None)
+                for goal in goals:
+                    params.SetGoalConfig(goal)
+                    assert(planner.InitPlan(robot,params))
+                    traj = RaveCreateTrajectory(env,'')
+                    assert(planner.PlanPath(traj) == PlannerStatus.HasSolution)
+                    spec = robot.GetActiveConfigurationSpecification()
+                    assert(transdist(traj.GetWaypoint(0,spec),start) <= g_epsilon)
+                    assert(transdist(traj.GetWaypoint(-1,spec),goal) <= g_epsilon)
+                    # planning does not move the robot
+                    assert(transdist(robot.GetActiveDOFValues(),start) <= g_epsilon)
+                    planningutils.VerifyTrajectory(params,traj,samplingstep=0.002)
+                    robot.SetActiveDOFValues(start)
+            # put a mug on the elbow at the middle of the last path, the clones have to be updated in InitPlan to avoid it
+            mug = env.GetKinBody('mug1')
+            with robot:
+                robot.SetActiveDOFValues(traj.GetWaypoint(int(traj.GetNumWaypoints()/2),spec))
+                Tmug = mug.GetTransform()
+                Tmug[0:3,3] = robot.GetJoints()[robot.GetActiveDOFIndices()[3]].GetAnchor()
+            mug.SetTransform(Tmug)
+            with robot:
+                validquery = True
+                for config in [start,goals[-1]]:
+                    robot.SetActiveDOFValues(config)
+                    if env.CheckCollision(robot):
+                        validquery = False
+            if validquery:
+                assert(planner.InitPlan(robot,params))
+                traj = RaveCreateTrajectory(env,'')
+                if planner.PlanPath(traj) == PlannerStatus.HasSolution:
+                    planningutils.VerifyTrajectory(params,traj,samplingstep=0.002)
+
+    def test_continuouscheck(self):
+        # a thin plate cuts the straight path of the hand in half. the joint resolutions are so coarse that the discretized
+        # check only looks at the ends of each segment, so only the continuous check can find the plate
+        env=self.env
+        robot = env.ReadRobotURI('robots/barrettwam.robot.xml')
+        env.AddRobot(robot)
+        with env:
+            manip = robot.GetActiveManipulator()
+            robot.SetActiveDOFs(manip.GetArmIndices())
+            q0 = array([0,0.6,0,1.2,0,0,0])
+            q1 = array(q0)
+            q1[0] += 0.6
+            robot.SetActiveDOFValues(q0)
+            p0 = manip.GetTransform()[0:3,3]
+            robot.SetActiveDOFValues(q1)
+            p1 = manip.GetTransform()[0:3,3]
+            robot.SetActiveDOFValues(0.5*(q0+q1))
+            Tplate = matrixFromQuat(quatRotateDirection([1,0,0],p1-p0))
+            Tplate[0:3,3] = manip.GetTransform()[0:3,3]
+            plate = RaveCreateKinBody(env,'')
+            plate.SetName('plate')
+            plate.InitFromBoxes(array([[0,0,0,0.001,0.06,0.06]]),True)
+            plate.SetTransform(Tplate)
+            env.AddKinBody(plate)
+            assert(env.CheckCollision(robot))
+            for q in [q0,q1]:
+                robot.SetActiveDOFValues(q)
+                assert(not env.CheckCollision(robot) and not robot.CheckSelfCollision())
+
+            verifyparams = Planner.PlannerParameters()
+            verifyparams.SetRobotActiveJoints(robot)
+            for joint in robot.GetJoints():
+                joint.SetResolution(0.7)
+            robot.SetActiveDOFValues(q0)
+            params = Planner.PlannerParameters()
+            params.SetRobotActiveJoints(robot)
+            params.SetExtraParameters('<_fsteplength>10</_fsteplength><_postprocessing planner=""></_postprocessing>')
+            params.SetGoalConfig(q1)
+            params.SetContinuousCheck(True)
+            planner = RaveCreatePlanner(env,'birrt')
+            assert(planner.InitPlan(robot,params))
+            traj = RaveCreateTrajectory(env,'')
+            assert(planner.PlanPath(traj) == PlannerStatus.HasSolution)
+            planningutils.RetimeActiveDOFTrajectory(traj,robot)
+            planningutils.VerifyTrajectory(verifyparams,traj,samplingstep=0.002)
+
+    def test_nearestneighborindex(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot = env.GetRobots()[0]
+        with env:
+            robot.SetActiveDOFs(robot.GetActiveManipulator().GetArmIndices())
+            lower,upper = robot.GetActiveDOFLimits()
+            goals = []
+            with robot:
+                while len(goals) < 3:
+                    robot.SetActiveDOFValues(randlimits(lower,upper))
+                    if not env.CheckCollision(robot) and not robot.CheckSelfCollision():
+                        goals.append(robot.GetActiveDOFValues())
+            start = robot.GetActiveDOFValues()
+            for goal in goals:
+                # the samplers are seeded the same way for every InitPlan and the post-processing planners are disabled since they use the global
+                # random generator, so the paths can only differ if gnat returns a neighbor that is not the nearest.
+                # the small step length grows trees that are deep enough for gnat to prune.
+                waypoints = []
+                for nearestneighborindex in ['gnat','bruteforce']:
+                    with robot:
+                        planner = RaveCreatePlanner(env,'birrt')
+                        params = Planner.PlannerParameters()
+                        params.SetRobotActiveJoints(robot)
+                        params.SetInitialConfig(start)
+                        params.SetGoalConfig(goal)
+                        params.SetExtraParameters('<nearestneighborindex>%s</nearestneighborindex><_fsteplength>0.002</_fsteplength><_postprocessing planner=""></_postprocessing>'%nearestneighborindex)
+                        assert(planner.InitPlan(robot,params))
+                        traj = RaveCreateTrajectory(env,'')
+                        assert(planner.PlanPath(traj) == PlannerStatus.HasSolution)
+                        planningutils.VerifyTrajectory(params,traj,samplingstep=0.002)
+                        waypoints.append(traj.GetWaypoints(0,traj.GetNumWaypoints()))
+                assert(len(waypoints[0]) == len(waypoints[1]) and all(waypoints[0] == waypoints[1]))
+
 #generate_classes(RunPlanning, globals(), [('ode','ode'),('bullet','bullet')])
 
 class test_ode(RunPlanning):
@@ -673,3 +673,45 @@ class TestTrajectory(EnvironmentSetup):
                 expectedaccel=array([  0.00000000e+00,   7.50000000e+00,   1.00000000e+01, 1.00000000e+01,   1.00000000e+01,   0.00000000e+00, 3.50596745e-16,   4.67462326e-16,   4.67462326e-16, 4.67462326e-16,   0.00000000e+00,  -7.50000000e+00, -1.00000000e+01,  -1.00000000e+01,  -1.00000000e+01, 0.00000000e+00,   0.00000000e+00,   0.00000000e+00, 0.00000000e+00,   0.00000000e+00])
                 assert(transdist(expectedaccel,acceldata) <= g_epsilon)
 
+    def test_binaryserialization(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        with env:
+            spec=robot.GetActiveConfigurationSpecification()
+            spec.AddDeltaTimeGroup()
+            traj = RaveCreateTrajectory(env,'')
+            traj.Init(spec)
+            data = random.rand(100*spec.GetDOF())
+            traj.Insert(0,data)
+            traj.SetDescription('binary test')
+            for options in [TrajectorySerializationOptions.Binary, TrajectorySerializationOptions.Binary|TrajectorySerializationOptions.Compressed]:
+                traj2 = RaveCreateTrajectory(env,'').deserialize(traj.serialize(options))
+                assert(traj2.GetConfigurationSpecification() == spec)
+                assert(traj2.GetNumWaypoints() == 100)
+                assert(transdist(traj2.GetWaypoints(0,traj2.GetNumWaypoints()),data) <= g_epsilon)
+                assert(traj2.GetDescription() == 'binary test')
+                # the binary form has to convert back to xml
+                traj3 = RaveCreateTrajectory(env,'').deserialize(traj2.serialize(0))
+                assert(transdist(traj3.GetWaypoints(0,traj3.GetNumWaypoints()),data) <= g_epsilon)
+
+    def test_bulksampling(self):
+        env=self.env
+        self.LoadEnv('data/lab1.env.xml')
+        robot=env.GetRobots()[0]
+        with env:
+            robot.SetActiveDOFs(range(7))
+            traj = RaveCreateTrajectory(env,'')
+            traj.Init(robot.GetActiveConfigurationSpecification())
+            values = robot.GetActiveDOFValues()
+            for i in range(10):
+                traj.Insert(traj.GetNumWaypoints(),values+0.1*i)
+            planningutils.RetimeActiveDOFTrajectory(traj,robot,False,1,1,'ParabolicTrajectoryRetimer')
+            times = r_[linspace(0,traj.GetDuration(),50),[0.5*traj.GetDuration(),2*traj.GetDuration()]]
+            data = reshape(traj.SamplePoints(times),(len(times),-1))
+            for time,point in izip(times,data):
+                assert(transdist(traj.Sample(time),point) <= g_epsilon)
+            spec = robot.GetActiveConfigurationSpecification()
+            data = reshape(traj.SampleRange(0,traj.GetDuration(),0.01,spec),(-1,spec.GetDOF()))
+            assert(transdist(data[-1],traj.Sample(0.01*(len(data)-1),spec)) <= g_epsilon)
+            assert(transdist(data[1],traj.Sample(0.01,spec)) <= g_epsilon)